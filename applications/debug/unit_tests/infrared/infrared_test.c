@@ -2,11 +2,15 @@
 #include <flipper_format.h>
 #include <infrared.h>
 #include <common/infrared_common_i.h>
+#include <infrared/infrared_brute_force.h>
+#include <infrared/infrared_signal.h>
 #include "../minunit.h"
 
 #define IR_TEST_FILES_DIR EXT_PATH("unit_tests/infrared/")
 #define IR_TEST_FILE_PREFIX "test_"
 #define IR_TEST_FILE_SUFFIX ".irtest"
+#define IR_TEST_BRUTE_FORCE_PATH EXT_PATH("unit_tests/infrared/brute_force.ir")
+#define IR_TEST_BRUTE_FORCE_INDEX_PATH (IR_TEST_BRUTE_FORCE_PATH ".idx")
 
 typedef struct {
     InfraredDecoderHandler* decoder_handler;
@@ -522,6 +526,95 @@ MU_TEST(infrared_test_encoder_decoder_all) {
     infrared_test_run_encoder_decoder(InfraredProtocolRCA, 1);
 }
 
+// Signals alternate between "Power" and "Mute", NEC commands go up from 0
+static void infrared_test_brute_force_write_db(size_t signals_count) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* ff = flipper_format_file_alloc(storage);
+    InfraredSignal* signal = infrared_signal_alloc();
+
+    mu_check(flipper_format_file_open_always(ff, IR_TEST_BRUTE_FORCE_PATH));
+    mu_check(flipper_format_write_header_cstr(ff, "IR library file", 1));
+    for(size_t i = 0; i < signals_count; i++) {
+        InfraredMessage message = {
+            .protocol = InfraredProtocolNEC,
+            .address = 0x04,
+            .command = i,
+            .repeat = false,
+        };
+        infrared_signal_set_message(signal, &message);
+        mu_check(infrared_signal_save(signal, ff, (i % 2) ? "Mute" : "Power"));
+    }
+
+    infrared_signal_free(signal);
+    flipper_format_free(ff);
+    furi_record_close(RECORD_STORAGE);
+}
+
+// Last byte of the index file, optionally replaced with a new value
+static uint8_t infrared_test_brute_force_index_last_byte(bool replace, uint8_t value) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    uint8_t data = 0;
+
+    mu_check(storage_file_open(
+        file, IR_TEST_BRUTE_FORCE_INDEX_PATH, FSAM_READ_WRITE, FSOM_OPEN_EXISTING));
+    uint64_t size = storage_file_size(file);
+    mu_check(size > 0);
+    mu_check(storage_file_seek(file, size - 1, true));
+    if(replace) {
+        mu_assert_int_eq(1, storage_file_write(file, &value, 1));
+        data = value;
+    } else {
+        mu_assert_int_eq(1, storage_file_read(file, &data, 1));
+    }
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    return data;
+}
+
+MU_TEST(infrared_test_brute_force_index) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    InfraredBruteForce* brute_force = infrared_brute_force_alloc();
+    uint32_t record_count = 0;
+
+    storage_simply_remove(storage, IR_TEST_BRUTE_FORCE_INDEX_PATH);
+    infrared_test_brute_force_write_db(5);
+
+    infrared_brute_force_set_db_filename(brute_force, IR_TEST_BRUTE_FORCE_PATH);
+    infrared_brute_force_add_record(brute_force, 0, "Power");
+    infrared_brute_force_add_record(brute_force, 1, "Mute");
+
+    // Index is built on first use
+    mu_check(infrared_brute_force_calculate_messages(brute_force));
+    mu_check(infrared_brute_force_start(brute_force, 0, &record_count));
+    infrared_brute_force_stop(brute_force);
+    mu_assert_int_eq(3, record_count);
+    mu_assert_int_eq(0, infrared_test_brute_force_index_last_byte(false, 0));
+
+    // Index of the same database is reused, so the mark survives
+    infrared_test_brute_force_index_last_byte(true, 0xA5);
+    mu_check(infrared_brute_force_calculate_messages(brute_force));
+    mu_check(infrared_brute_force_start(brute_force, 1, &record_count));
+    infrared_brute_force_stop(brute_force);
+    mu_assert_int_eq(2, record_count);
+    mu_assert_int_eq(0xA5, infrared_test_brute_force_index_last_byte(false, 0));
+
+    // Changed database invalidates the index
+    infrared_test_brute_force_write_db(7);
+    mu_check(infrared_brute_force_calculate_messages(brute_force));
+    mu_check(infrared_brute_force_start(brute_force, 1, &record_count));
+    infrared_brute_force_stop(brute_force);
+    mu_assert_int_eq(3, record_count);
+    mu_assert_int_eq(0, infrared_test_brute_force_index_last_byte(false, 0));
+
+    infrared_brute_force_free(brute_force);
+
+    mu_check(storage_simply_remove(storage, IR_TEST_BRUTE_FORCE_INDEX_PATH));
+    mu_check(storage_simply_remove(storage, IR_TEST_BRUTE_FORCE_PATH));
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(infrared_test) {
     MU_SUITE_CONFIGURE(&infrared_test_alloc, &infrared_test_free);
 
@@ -541,6 +634,7 @@ MU_TEST_SUITE(infrared_test) {
     MU_RUN_TEST(infrared_test_decoder_rca);
     MU_RUN_TEST(infrared_test_decoder_mixed);
     MU_RUN_TEST(infrared_test_encoder_decoder_all);
+    MU_RUN_TEST(infrared_test_brute_force_index);
 }
 
 int run_minunit_test_infrared(void) {
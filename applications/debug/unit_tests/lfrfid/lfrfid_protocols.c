@@ -531,6 +531,59 @@ MU_TEST(test_lfrfid_protocol_fdxb_read_simple) {
     protocol_dict_free(dict);
 }
 
+#define LFRFID_TEST_FEED_REPEATS (20)
+
+static ProtocolId
+    test_lfrfid_protocol_feed_each(ProtocolDict* dict, bool level, uint32_t duration) {
+    ProtocolId protocol = PROTOCOL_NO;
+    for(size_t i = 0; i < LFRFIDProtocolMax; i++) {
+        ProtocolId ready = protocol_dict_decoders_feed_by_id(dict, i, level, duration);
+        if(protocol == PROTOCOL_NO) protocol = ready;
+    }
+    return protocol;
+}
+
+MU_TEST(test_lfrfid_protocol_dict_feed_shared) {
+    // Shared demodulation must decode exactly as every decoder on its own
+    ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    ProtocolDict* dict_each = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    protocol_dict_decoders_start(dict);
+    protocol_dict_decoders_start(dict_each);
+
+    PulseGlue* pulse_glue = pulse_glue_alloc();
+    size_t decoded = 0;
+
+    for(size_t i = 0; i < HID10301_TEST_EMULATION_TIMINGS_COUNT * LFRFID_TEST_FEED_REPEATS; i++) {
+        bool pulse_pop = pulse_glue_push(
+            pulse_glue,
+            hid10301_test_timings[i % HID10301_TEST_EMULATION_TIMINGS_COUNT] >= 0,
+            abs(hid10301_test_timings[i % HID10301_TEST_EMULATION_TIMINGS_COUNT]) *
+                LF_RFID_READ_TIMING_MULTIPLIER);
+
+        if(pulse_pop) {
+            uint32_t length, period;
+            pulse_glue_pop(pulse_glue, &length, &period);
+
+            ProtocolId protocol = protocol_dict_decoders_feed(dict, true, period);
+            ProtocolId protocol_low = protocol_dict_decoders_feed(dict, false, length - period);
+
+            ProtocolId protocol_each = test_lfrfid_protocol_feed_each(dict_each, true, period);
+            ProtocolId protocol_each_low =
+                test_lfrfid_protocol_feed_each(dict_each, false, length - period);
+
+            mu_assert_int_eq(protocol_each, protocol);
+            mu_assert_int_eq(protocol_each_low, protocol_low);
+            if(protocol == LFRFIDProtocolH10301) decoded++;
+        }
+    }
+
+    pulse_glue_free(pulse_glue);
+    mu_check(decoded > 0);
+
+    protocol_dict_free(dict_each);
+    protocol_dict_free(dict);
+}
+
 MU_TEST_SUITE(test_lfrfid_protocols_suite) {
     MU_RUN_TEST(test_lfrfid_protocol_em_read_simple);
     MU_RUN_TEST(test_lfrfid_protocol_em_emulate_simple);
@@ -545,6 +598,8 @@ MU_TEST_SUITE(test_lfrfid_protocols_suite) {
 
     MU_RUN_TEST(test_lfrfid_protocol_fdxb_read_simple);
     MU_RUN_TEST(test_lfrfid_protocol_fdxb_emulate_simple);
+
+    MU_RUN_TEST(test_lfrfid_protocol_dict_feed_shared);
 }
 
 int run_minunit_test_lfrfid_protocols(void) {
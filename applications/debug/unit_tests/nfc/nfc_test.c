@@ -4,6 +4,7 @@
 
 #include <nfc/nfc_device.h>
 #include <nfc/helpers/nfc_data_generator.h>
+#include <nfc/helpers/nfc_supported_cards_cache.h>
 #include <nfc/nfc_poller.h>
 #include <nfc/nfc_listener.h>
 #include <nfc/protocols/iso14443_3a/iso14443_3a.h>
@@ -11,8 +12,11 @@
 #include <nfc/protocols/mf_ultralight/mf_ultralight.h>
 #include <nfc/protocols/mf_ultralight/mf_ultralight_poller_sync.h>
 #include <nfc/protocols/mf_classic/mf_classic_poller_sync.h>
+#include <nfc/protocols/mf_classic/crypto1.h>
+#include <nfc/protocols/mf_classic/crypto1_batch.h>
 
 #include <toolbox/keys_dict.h>
+#include <flipper_format/flipper_format.h>
 #include <nfc/nfc.h>
 
 #include "../minunit.h"
@@ -21,6 +25,11 @@
 
 #define NFC_TEST_NFC_DEV_PATH EXT_PATH("unit_tests/nfc/nfc_device_test.nfc")
 #define NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH EXT_PATH("unit_tests/mf_dict.nfc")
+#define NFC_APP_MF_CLASSIC_DICT_INDEX_UNIT_TEST_PATH \
+    NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH KEYS_DICT_INDEX_EXTENSION
+#define NFC_TEST_PLUGINS_PATH EXT_PATH("unit_tests/nfc/plugins")
+#define NFC_TEST_PLUGINS_CACHE_PATH EXT_PATH("unit_tests/nfc/plugins.cache")
+#define NFC_TEST_PLUGIN_SUFFIX "_parser.fal"
 
 typedef struct {
     Storage* storage;
@@ -41,11 +50,18 @@ static void nfc_test_free(void) {
     nfc_test = NULL;
 }
 
-static void nfc_test_save_and_load(NfcDevice* nfc_device_ref) {
+static void nfc_test_save_and_load_ex(NfcDevice* nfc_device_ref, bool packed) {
     NfcDevice* nfc_device_dut = nfc_device_alloc();
 
-    mu_assert(
-        nfc_device_save(nfc_device_ref, NFC_TEST_NFC_DEV_PATH), "nfc_device_save() failed\r\n");
+    if(packed) {
+        mu_assert(
+            nfc_device_save_packed(nfc_device_ref, NFC_TEST_NFC_DEV_PATH),
+            "nfc_device_save_packed() failed\r\n");
+    } else {
+        mu_assert(
+            nfc_device_save(nfc_device_ref, NFC_TEST_NFC_DEV_PATH),
+            "nfc_device_save() failed\r\n");
+    }
 
     mu_assert(
         nfc_device_load(nfc_device_dut, NFC_TEST_NFC_DEV_PATH), "nfc_device_load() failed\r\n");
@@ -61,6 +77,11 @@ static void nfc_test_save_and_load(NfcDevice* nfc_device_ref) {
     nfc_device_free(nfc_device_dut);
 }
 
+static void nfc_test_save_and_load(NfcDevice* nfc_device_ref) {
+    nfc_test_save_and_load_ex(nfc_device_ref, false);
+    nfc_test_save_and_load_ex(nfc_device_ref, true);
+}
+
 static void iso14443_3a_file_test(uint8_t uid_len) {
     NfcDevice* nfc_device = nfc_device_alloc();
 
@@ -166,6 +187,144 @@ MU_TEST(mf_classic_4k_7b_file_test) {
     nfc_file_test_with_generator(NfcDataGeneratorTypeMfClassic4k_7b);
 }
 
+static uint32_t nfc_test_mf_classic_data_format_version(void) {
+    FlipperFormat* ff = flipper_format_file_alloc(nfc_test->storage);
+    uint32_t version = 0;
+    mu_assert(flipper_format_file_open_existing(ff, NFC_TEST_NFC_DEV_PATH), "open failed");
+    mu_assert(
+        flipper_format_read_uint32(ff, "Data format version", &version, 1),
+        "read data format version failed");
+    flipper_format_free(ff);
+
+    return version;
+}
+
+static void nfc_test_mf_classic_set_block_not_read(MfClassicData* data, uint8_t block_num) {
+    FURI_BIT_CLEAR(data->block_read_mask[block_num / 32], block_num % 32);
+    if(mf_classic_is_sector_trailer(block_num)) {
+        MfClassicSectorTrailer* sec_tr = (MfClassicSectorTrailer*)&data->block[block_num];
+        memset(&sec_tr->access_bits, 0, sizeof(sec_tr->access_bits));
+    } else {
+        memset(&data->block[block_num], 0, sizeof(MfClassicBlock));
+    }
+}
+
+static void nfc_test_mf_classic_set_key_unknown(
+    MfClassicData* data,
+    uint8_t sector_num,
+    MfClassicKeyType key_type) {
+    MfClassicSectorTrailer* sec_tr = mf_classic_get_sector_trailer_by_sector(data, sector_num);
+    mf_classic_set_key_not_found(data, sector_num, key_type);
+    if(key_type == MfClassicKeyTypeA) {
+        memset(&sec_tr->key_a, 0, sizeof(sec_tr->key_a));
+    } else {
+        memset(&sec_tr->key_b, 0, sizeof(sec_tr->key_b));
+    }
+}
+
+static void mf_classic_partial_file_test_run(bool packed) {
+    NfcDevice* nfc_device = nfc_device_alloc();
+    nfc_data_generator_fill_data(NfcDataGeneratorTypeMfClassic1k_4b, nfc_device);
+
+    MfClassicData* data = mf_classic_alloc();
+    mf_classic_copy(data, nfc_device_get_data(nfc_device, NfcProtocolMfClassic));
+
+    // Unknown data is zero after load, same in reference
+    nfc_test_mf_classic_set_block_not_read(data, 5);
+    nfc_test_mf_classic_set_key_unknown(data, 1, MfClassicKeyTypeB);
+    nfc_test_mf_classic_set_block_not_read(data, 11);
+    nfc_test_mf_classic_set_key_unknown(data, 2, MfClassicKeyTypeA);
+    for(uint8_t block_num = 12; block_num < 16; block_num++) {
+        nfc_test_mf_classic_set_block_not_read(data, block_num);
+    }
+    nfc_test_mf_classic_set_key_unknown(data, 3, MfClassicKeyTypeA);
+    nfc_test_mf_classic_set_key_unknown(data, 3, MfClassicKeyTypeB);
+    nfc_device_set_data(nfc_device, NfcProtocolMfClassic, data);
+
+    NfcDevice* nfc_device_dut = nfc_device_alloc();
+    if(packed) {
+        mu_assert(
+            nfc_device_save_packed(nfc_device, NFC_TEST_NFC_DEV_PATH),
+            "nfc_device_save_packed() failed");
+        mu_assert_int_eq(3, nfc_test_mf_classic_data_format_version());
+    } else {
+        mu_assert(nfc_device_save(nfc_device, NFC_TEST_NFC_DEV_PATH), "nfc_device_save() failed");
+        mu_assert_int_eq(2, nfc_test_mf_classic_data_format_version());
+    }
+    mu_assert(nfc_device_load(nfc_device_dut, NFC_TEST_NFC_DEV_PATH), "nfc_device_load() failed");
+
+    const MfClassicData* data_dut = nfc_device_get_data(nfc_device_dut, NfcProtocolMfClassic);
+    mu_assert(mf_classic_is_equal(data, data_dut), "partial data mismatch");
+    mu_check(!mf_classic_is_block_read(data_dut, 5));
+    mu_check(mf_classic_is_block_read(data_dut, 6));
+    mu_check(mf_classic_is_key_found(data_dut, 1, MfClassicKeyTypeA));
+    mu_check(!mf_classic_is_key_found(data_dut, 1, MfClassicKeyTypeB));
+    mu_check(!mf_classic_is_key_found(data_dut, 3, MfClassicKeyTypeA));
+
+    mu_assert(
+        storage_simply_remove(nfc_test->storage, NFC_TEST_NFC_DEV_PATH),
+        "storage_simply_remove() failed");
+
+    nfc_device_free(nfc_device_dut);
+    mf_classic_free(data);
+    nfc_device_free(nfc_device);
+}
+
+MU_TEST(mf_classic_partial_file_test) {
+    mf_classic_partial_file_test_run(false);
+}
+
+MU_TEST(mf_classic_partial_packed_file_test) {
+    mf_classic_partial_file_test_run(true);
+}
+
+static void nfc_test_mf_classic_load(MfClassicData* data, bool key_index) {
+    FlipperFormat* ff = flipper_format_buffered_file_alloc(nfc_test->storage);
+    flipper_format_set_key_index(ff, key_index);
+    FuriString* temp_str = furi_string_alloc();
+
+    // Same sequence as nfc_device_load()
+    uint32_t version = 0;
+    uint32_t uid_len = 0;
+    uint8_t uid[10];
+    mu_assert(
+        flipper_format_buffered_file_open_existing(ff, NFC_TEST_NFC_DEV_PATH), "open failed");
+    mu_assert(flipper_format_read_header(ff, temp_str, &version), "read header failed");
+    mu_assert(flipper_format_read_string(ff, "Device type", temp_str), "read type failed");
+    mu_assert(flipper_format_get_value_count(ff, "UID", &uid_len), "get UID length failed");
+    mu_assert(uid_len <= sizeof(uid), "wrong UID length");
+    mu_assert(flipper_format_read_hex(ff, "UID", uid, uid_len), "read UID failed");
+    mu_assert(mf_classic_load(data, ff, version), "mf_classic_load() failed");
+    mu_assert(mf_classic_set_uid(data, uid, uid_len), "mf_classic_set_uid() failed");
+
+    furi_string_free(temp_str);
+    flipper_format_free(ff);
+}
+
+MU_TEST(mf_classic_4k_key_index_load_test) {
+    NfcDevice* nfc_device = nfc_device_alloc();
+    nfc_data_generator_fill_data(NfcDataGeneratorTypeMfClassic4k_7b, nfc_device);
+    mu_assert(nfc_device_save(nfc_device, NFC_TEST_NFC_DEV_PATH), "nfc_device_save() failed");
+    const MfClassicData* mfc_ref = nfc_device_get_data(nfc_device, NfcProtocolMfClassic);
+
+    MfClassicData* mfc_scan = mf_classic_alloc();
+    MfClassicData* mfc_index = mf_classic_alloc();
+
+    nfc_test_mf_classic_load(mfc_scan, false);
+    nfc_test_mf_classic_load(mfc_index, true);
+
+    mu_assert(mf_classic_is_equal(mfc_scan, mfc_ref), "Scan load data mismatch");
+    mu_assert(mf_classic_is_equal(mfc_index, mfc_ref), "Key index load data mismatch");
+
+    mf_classic_free(mfc_index);
+    mf_classic_free(mfc_scan);
+    nfc_device_free(nfc_device);
+
+    mu_assert(
+        storage_simply_remove(nfc_test->storage, NFC_TEST_NFC_DEV_PATH),
+        "storage_simply_remove() failed");
+}
+
 MU_TEST(iso14443_3a_reader) {
     Nfc* poller = nfc_alloc();
     Nfc* listener = nfc_alloc();
@@ -504,6 +663,224 @@ MU_TEST(mf_classic_dict_test) {
         "Remove test dict failed");
 }
 
+MU_TEST(mf_classic_dict_index_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH);
+    storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_INDEX_UNIT_TEST_PATH);
+
+    KeysDict* dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+    mu_assert(dict != NULL, "keys_dict_alloc() failed");
+
+    const uint32_t test_key_num = 200;
+    MfClassicKey* key_arr_ref = malloc(test_key_num * sizeof(MfClassicKey));
+    for(size_t i = 0; i < test_key_num; i++) {
+        furi_hal_random_fill_buf(key_arr_ref[i].data, sizeof(MfClassicKey));
+        mu_assert(
+            keys_dict_add_key(dict, key_arr_ref[i].data, sizeof(MfClassicKey)), "add key failed");
+    }
+    keys_dict_free(dict);
+
+    // First open builds the index, second one uses it
+    for(size_t pass = 0; pass < 2; pass++) {
+        dict = keys_dict_alloc(
+            NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH,
+            KeysDictModeOpenExisting,
+            sizeof(MfClassicKey));
+        mu_assert(dict != NULL, "keys_dict_alloc() failed");
+        mu_assert(
+            storage_common_stat(storage, NFC_APP_MF_CLASSIC_DICT_INDEX_UNIT_TEST_PATH, NULL) ==
+                FSE_OK,
+            "Index not created");
+        mu_assert(keys_dict_get_total_keys(dict) == test_key_num, "keys_dict_keys_total() failed");
+
+        MfClassicKey key_dut = {};
+        size_t key_idx = 0;
+        while(keys_dict_get_next_key(dict, key_dut.data, sizeof(MfClassicKey))) {
+            mu_assert(key_idx < test_key_num, "Too many keys loaded");
+            mu_assert(
+                memcmp(key_arr_ref[key_idx].data, key_dut.data, sizeof(MfClassicKey)) == 0,
+                "Loaded key data mismatch");
+            key_idx++;
+        }
+        mu_assert(key_idx == test_key_num, "Not all keys loaded");
+
+        for(size_t i = 0; i < test_key_num; i += 7) {
+            mu_assert(
+                keys_dict_is_key_present(dict, key_arr_ref[i].data, sizeof(MfClassicKey)),
+                "keys_dict_is_key_present() failed");
+        }
+        keys_dict_free(dict);
+    }
+
+    // Changing the list invalidates the index
+    dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+    mu_assert(
+        keys_dict_delete_key(dict, key_arr_ref[42].data, sizeof(MfClassicKey)),
+        "keys_dict_delete_key() failed");
+    keys_dict_free(dict);
+
+    dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+    mu_assert(
+        keys_dict_get_total_keys(dict) == test_key_num - 1, "keys_dict_keys_total() failed");
+    mu_assert(
+        !keys_dict_is_key_present(dict, key_arr_ref[42].data, sizeof(MfClassicKey)),
+        "Deleted key is present");
+    mu_assert(
+        keys_dict_is_key_present(dict, key_arr_ref[43].data, sizeof(MfClassicKey)),
+        "keys_dict_is_key_present() failed");
+    keys_dict_free(dict);
+
+    free(key_arr_ref);
+
+    mu_assert(
+        storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
+        "Remove test dict failed");
+    mu_assert(
+        storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_INDEX_UNIT_TEST_PATH),
+        "Remove test dict index failed");
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(mf_classic_crypto1_batch_test) {
+    const size_t keys_num = 1024;
+    uint64_t* keys = malloc(keys_num * sizeof(uint64_t));
+    size_t* ref_matches = malloc(keys_num * sizeof(size_t));
+    size_t* matches = malloc(keys_num * sizeof(size_t));
+    Crypto1* crypto = crypto1_alloc();
+
+    for(size_t i = 0; i < keys_num; i++) {
+        furi_hal_random_fill_buf((uint8_t*)&keys[i], 6);
+        keys[i] &= 0xFFFFFFFFFFFFULL;
+    }
+    // Make sure there are several matches, including the last partial batch
+    keys[keys_num - 1] = keys[7];
+    keys[100] = keys[7];
+
+    uint32_t cuid = furi_hal_random_get();
+    uint32_t nt = furi_hal_random_get();
+    uint32_t nr = furi_hal_random_get();
+
+    // Reader side authentication with key 7
+    crypto1_init(crypto, keys[7]);
+    crypto1_word(crypto, cuid ^ nt, 0);
+    uint32_t nr_enc = crypto1_word(crypto, nr, 0) ^ nr;
+    uint32_t ar_enc = crypto1_word(crypto, 0, 0) ^ prng_successor(nt, 64);
+
+    // Card side verification, one key at a time
+    size_t ref_matches_num = 0;
+    for(size_t i = 0; i < keys_num; i++) {
+        crypto1_init(crypto, keys[i]);
+        crypto1_word(crypto, cuid ^ nt, 0);
+        crypto1_word(crypto, nr_enc, 1);
+        if((ar_enc ^ crypto1_word(crypto, 0, 0)) == prng_successor(nt, 64)) {
+            ref_matches[ref_matches_num++] = i;
+        }
+    }
+
+    size_t matches_num = crypto1_batch_check_reader_auth(
+        keys, keys_num, cuid, nt, nr_enc, ar_enc, matches, keys_num);
+
+    mu_assert(ref_matches_num >= 3, "Reference key check failed");
+    mu_assert(matches_num == ref_matches_num, "Batch matches count mismatch");
+    mu_assert(
+        memcmp(matches, ref_matches, matches_num * sizeof(size_t)) == 0,
+        "Batch matches mismatch");
+
+    crypto1_free(crypto);
+    free(matches);
+    free(ref_matches);
+    free(keys);
+}
+
+static void nfc_test_plugin_write(const char* name, const char* data) {
+    FuriString* path = furi_string_alloc_printf("%s/%s", NFC_TEST_PLUGINS_PATH, name);
+    File* file = storage_file_alloc(nfc_test->storage);
+
+    mu_assert(
+        storage_file_open(file, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS),
+        "storage_file_open() failed");
+    mu_assert(
+        storage_file_write(file, data, strlen(data)) == strlen(data),
+        "storage_file_write() failed");
+
+    storage_file_free(file);
+    furi_string_free(path);
+}
+
+static bool nfc_test_plugin_map_callback(
+    const FuriString* path,
+    NfcSupportedCardsPluginCache* plugin_cache,
+    void* context) {
+    UNUSED(path);
+    UNUSED(context);
+
+    plugin_cache->protocol = NfcProtocolMfClassic;
+    plugin_cache->feature = 0;
+
+    return true;
+}
+
+static size_t nfc_test_plugins_cache_load(NfcSupportedCardsPluginCache_t cache_arr) {
+    nfc_supported_cards_cache_reset(cache_arr);
+    return nfc_supported_cards_cache_load(
+        cache_arr,
+        nfc_test->storage,
+        NFC_TEST_PLUGINS_PATH,
+        NFC_TEST_PLUGIN_SUFFIX,
+        NFC_TEST_PLUGINS_CACHE_PATH,
+        nfc_test_plugin_map_callback,
+        NULL);
+}
+
+MU_TEST(nfc_supported_cards_cache_test) {
+    NfcSupportedCardsPluginCache_t cache_arr;
+    NfcSupportedCardsPluginCache_init(cache_arr);
+
+    storage_simply_remove_recursive(nfc_test->storage, NFC_TEST_PLUGINS_PATH);
+    storage_simply_remove(nfc_test->storage, NFC_TEST_PLUGINS_CACHE_PATH);
+    mu_assert(
+        storage_simply_mkdir(nfc_test->storage, NFC_TEST_PLUGINS_PATH),
+        "storage_simply_mkdir() failed");
+
+    nfc_test_plugin_write("a" NFC_TEST_PLUGIN_SUFFIX, "plugin a");
+    nfc_test_plugin_write("b" NFC_TEST_PLUGIN_SUFFIX, "plugin b");
+    nfc_test_plugin_write("c" NFC_TEST_PLUGIN_SUFFIX, "plugin c");
+    nfc_test_plugin_write("readme.txt", "not a plugin");
+
+    mu_assert_int_eq(3, nfc_test_plugins_cache_load(cache_arr));
+    mu_assert_int_eq(3, NfcSupportedCardsPluginCache_size(cache_arr));
+
+    // Second load takes everything from the cache file
+    mu_assert_int_eq(0, nfc_test_plugins_cache_load(cache_arr));
+    mu_assert_int_eq(3, NfcSupportedCardsPluginCache_size(cache_arr));
+
+    // Same size, different contents
+    nfc_test_plugin_write("b" NFC_TEST_PLUGIN_SUFFIX, "plugin B");
+    mu_assert_int_eq(1, nfc_test_plugins_cache_load(cache_arr));
+    mu_assert_int_eq(0, nfc_test_plugins_cache_load(cache_arr));
+
+    // Removed plugin is dropped from the cache
+    mu_assert(
+        storage_simply_remove(
+            nfc_test->storage, NFC_TEST_PLUGINS_PATH "/c" NFC_TEST_PLUGIN_SUFFIX),
+        "storage_simply_remove() failed");
+    mu_assert_int_eq(0, nfc_test_plugins_cache_load(cache_arr));
+    mu_assert_int_eq(2, NfcSupportedCardsPluginCache_size(cache_arr));
+
+    nfc_supported_cards_cache_reset(cache_arr);
+    NfcSupportedCardsPluginCache_clear(cache_arr);
+
+    mu_assert(
+        storage_simply_remove_recursive(nfc_test->storage, NFC_TEST_PLUGINS_PATH),
+        "storage_simply_remove_recursive() failed");
+    mu_assert(
+        storage_simply_remove(nfc_test->storage, NFC_TEST_PLUGINS_CACHE_PATH),
+        "storage_simply_remove() failed");
+}
+
 MU_TEST_SUITE(nfc) {
     nfc_test_alloc();
 
@@ -538,12 +915,18 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(mf_classic_1k_7b_file_test);
     MU_RUN_TEST(mf_classic_4k_4b_file_test);
     MU_RUN_TEST(mf_classic_4k_7b_file_test);
+    MU_RUN_TEST(mf_classic_partial_file_test);
+    MU_RUN_TEST(mf_classic_partial_packed_file_test);
+    MU_RUN_TEST(mf_classic_4k_key_index_load_test);
     MU_RUN_TEST(mf_classic_reader);
 
     MU_RUN_TEST(mf_classic_write);
     MU_RUN_TEST(mf_classic_value_block);
 
     MU_RUN_TEST(mf_classic_dict_test);
+    MU_RUN_TEST(mf_classic_dict_index_test);
+    MU_RUN_TEST(mf_classic_crypto1_batch_test);
+    MU_RUN_TEST(nfc_supported_cards_cache_test);
 
     nfc_test_free();
 }
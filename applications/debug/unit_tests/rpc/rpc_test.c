@@ -8,6 +8,8 @@
 
 #include <rpc/rpc.h>
 #include <rpc/rpc_i.h>
+#include <rpc/rpc_gui_stream.h>
+#include <gui/gui_i.h>
 #include <cli/cli.h>
 #include <storage/storage.h>
 #include <loader/loader.h>
@@ -1096,6 +1098,85 @@ MU_TEST(test_storage_write) {
     test_storage_write_run(TEST_DIR "test2.txt", 512, 3, ++command_id, PB_CommandStatus_OK);
 }
 
+#define TEST_STORAGE_BLOCKS_FILE TEST_DIR "blocks.bin"
+#define TEST_STORAGE_BLOCKS_CHUNKS (128U)
+
+static uint8_t test_storage_blocks_byte(size_t offset) {
+    return (offset * 7) ^ (offset >> 9);
+}
+
+MU_TEST(test_storage_write_read_blocks) {
+    const size_t file_size = TEST_STORAGE_BLOCKS_CHUNKS * MAX_DATA_SIZE;
+
+    // Messages are fed and decoded one by one, lists of 64K would not fit
+    uint32_t write_command_id = ++command_id;
+    for(size_t i = 0; i < TEST_STORAGE_BLOCKS_CHUNKS; i++) {
+        PB_Main request = {0};
+        test_rpc_fill_basic_message(&request, PB_Main_storage_write_request_tag, write_command_id);
+        request.content.storage_write_request.path = strdup(TEST_STORAGE_BLOCKS_FILE);
+        request.content.storage_write_request.has_file = true;
+        PB_Storage_File* msg_file = &request.content.storage_write_request.file;
+        msg_file->data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(MAX_DATA_SIZE));
+        msg_file->data->size = MAX_DATA_SIZE;
+        for(size_t j = 0; j < MAX_DATA_SIZE; j++) {
+            msg_file->data->bytes[j] = test_storage_blocks_byte(i * MAX_DATA_SIZE + j);
+        }
+        request.has_next = (i + 1 < TEST_STORAGE_BLOCKS_CHUNKS);
+        test_rpc_encode_and_feed_one(&request, 0);
+    }
+
+    MsgList_t expected_msg_list;
+    MsgList_init(expected_msg_list);
+    test_rpc_add_empty_to_list(expected_msg_list, PB_CommandStatus_OK, write_command_id);
+    test_rpc_decode_and_compare(expected_msg_list, 0);
+    test_rpc_free_msg_list(expected_msg_list);
+
+    PB_Main request;
+    test_rpc_create_simple_message(
+        &request, PB_Main_storage_read_request_tag, TEST_STORAGE_BLOCKS_FILE, ++command_id);
+
+    test_rpc_encode_and_feed_one(&request, 0);
+
+    rpc_session[0].timeout = furi_get_tick() + MAX_RECEIVE_OUTPUT_TIMEOUT;
+    pb_istream_t istream = {
+        .callback = test_rpc_pb_stream_read,
+        .state = &rpc_session[0],
+        .errmsg = NULL,
+        .bytes_left = 0x7FFFFFFF,
+    };
+    PB_Main result = {.cb_content.funcs.decode = NULL};
+
+    size_t offset = 0;
+    bool has_next = true;
+    while(has_next) {
+        if(!pb_decode_ex(&istream, &PB_Main_msg, &result, PB_DECODE_DELIMITED)) {
+            mu_fail("read response is not received");
+            break;
+        }
+
+        mu_assert_int_eq(command_id, result.command_id);
+        mu_assert_int_eq(PB_CommandStatus_OK, result.command_status);
+        mu_assert_int_eq(PB_Main_storage_read_response_tag, result.which_content);
+        const pb_bytes_array_t* data = result.content.storage_read_response.file.data;
+        mu_check(data != NULL);
+        if(data) {
+            mu_check(offset + data->size <= file_size);
+            for(size_t j = 0; (j < data->size) && (offset + j < file_size); j++) {
+                if(data->bytes[j] != test_storage_blocks_byte(offset + j)) {
+                    mu_fail("read data mismatch");
+                    break;
+                }
+            }
+            offset += data->size;
+        }
+
+        has_next = result.has_next;
+        pb_release(&PB_Main_msg, &result);
+        rpc_session[0].timeout = furi_get_tick() + MAX_RECEIVE_OUTPUT_TIMEOUT;
+    }
+    mu_assert_int_eq(file_size, offset);
+}
+
 MU_TEST(test_storage_interrupt_continuous_same_system) {
     MsgList_t input_msg_list;
     MsgList_init(input_msg_list);
@@ -1500,6 +1581,7 @@ MU_TEST_SUITE(test_rpc_storage) {
     MU_RUN_TEST(test_storage_read);
     MU_RUN_TEST(test_storage_write_read);
     MU_RUN_TEST(test_storage_write);
+    MU_RUN_TEST(test_storage_write_read_blocks);
     MU_RUN_TEST(test_storage_delete);
     MU_RUN_TEST(test_storage_delete_recursive);
     MU_RUN_TEST(test_storage_mkdir);
@@ -1840,6 +1922,153 @@ MU_TEST_SUITE(test_rpc_session) {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define TEST_GUI_STREAM_FRAME_SIZE (1024U)
+#define TEST_GUI_STREAM_PAGE_SIZE (128U)
+#define TEST_GUI_STREAM_FRAMES (256U)
+
+// Static dithered background with a 16x16 box moving over it
+static void test_rpc_gui_stream_frame_render(uint8_t* frame, size_t index) {
+    for(size_t i = 0; i < TEST_GUI_STREAM_FRAME_SIZE; i++) {
+        frame[i] = (i / TEST_GUI_STREAM_PAGE_SIZE) % 2 ? 0xAA : 0x55;
+    }
+
+    size_t x = (index * 3) % (TEST_GUI_STREAM_PAGE_SIZE - 16);
+    size_t page = (index / 16) % 7;
+    for(size_t i = 0; i < 16; i++) {
+        frame[page * TEST_GUI_STREAM_PAGE_SIZE + x + i] = 0xFF;
+        frame[(page + 1) * TEST_GUI_STREAM_PAGE_SIZE + x + i] = 0xFF;
+    }
+}
+
+MU_TEST(test_rpc_gui_stream_codec) {
+    uint8_t* frame = malloc(TEST_GUI_STREAM_FRAME_SIZE);
+    uint8_t* encoded = malloc(TEST_GUI_STREAM_FRAME_SIZE + RPC_GUI_STREAM_OVERHEAD);
+    RpcGuiStreamEncoder* encoder = rpc_gui_stream_encoder_alloc(TEST_GUI_STREAM_FRAME_SIZE);
+    RpcGuiStreamDecoder* decoder = rpc_gui_stream_decoder_alloc(TEST_GUI_STREAM_FRAME_SIZE);
+
+    // Delta can't be decoded without a key frame
+    test_rpc_gui_stream_frame_render(frame, 0);
+    rpc_gui_stream_encoder_encode(encoder, frame, encoded);
+    size_t size = rpc_gui_stream_encoder_encode(encoder, frame, encoded);
+    mu_assert_int_eq(RpcGuiStreamFrameTypeDelta, encoded[0]);
+    mu_check(rpc_gui_stream_decoder_decode(decoder, encoded, size) == NULL);
+    rpc_gui_stream_encoder_reset(encoder);
+
+    size_t encoded_size = 0;
+    size_t key_frames = 0;
+    for(size_t i = 0; i < TEST_GUI_STREAM_FRAMES; i++) {
+        test_rpc_gui_stream_frame_render(frame, i);
+
+        size = rpc_gui_stream_encoder_encode(encoder, frame, encoded);
+        mu_check(size <= TEST_GUI_STREAM_FRAME_SIZE + RPC_GUI_STREAM_OVERHEAD);
+        encoded_size += size;
+        if(encoded[0] == RpcGuiStreamFrameTypeKey) key_frames++;
+
+        const uint8_t* decoded = rpc_gui_stream_decoder_decode(decoder, encoded, size);
+        mu_check(decoded != NULL);
+        mu_assert_mem_eq(frame, decoded, TEST_GUI_STREAM_FRAME_SIZE);
+    }
+
+    mu_assert_int_eq(TEST_GUI_STREAM_FRAMES / RPC_GUI_STREAM_KEYFRAME_INTERVAL, key_frames);
+    // Moving box is a small part of the screen
+    mu_check(encoded_size * 4 < TEST_GUI_STREAM_FRAMES * TEST_GUI_STREAM_FRAME_SIZE);
+
+    rpc_gui_stream_decoder_free(decoder);
+    rpc_gui_stream_encoder_free(encoder);
+    free(encoded);
+    free(frame);
+}
+
+static bool test_rpc_receive_one(PB_Main* result, uint8_t session) {
+    rpc_session[session].timeout = furi_get_tick() + MAX_RECEIVE_OUTPUT_TIMEOUT;
+    pb_istream_t istream = {
+        .callback = test_rpc_pb_stream_read,
+        .state = &rpc_session[session],
+        .errmsg = NULL,
+        .bytes_left = 0x7FFFFFFF,
+    };
+    result->cb_content.funcs.decode = NULL;
+    return pb_decode_ex(&istream, &PB_Main_msg, result, PB_DECODE_DELIMITED);
+}
+
+static void test_rpc_gui_screen_stream_run(bool delta) {
+    PB_Main request;
+    PB_Main result;
+
+    // Client opts in or out with property assignment, older firmware rejects the key
+    test_rpc_fill_basic_message(&request, PB_Main_property_get_request_tag, ++command_id);
+    request.content.property_get_request.key =
+        strdup(delta ? "rpc.screen_stream.delta=1" : "rpc.screen_stream.delta=0");
+    test_rpc_encode_and_feed_one(&request, 0);
+    mu_check(test_rpc_receive_one(&result, 0));
+    mu_assert_int_eq(PB_Main_property_get_response_tag, result.which_content);
+    mu_assert_string_eq(delta ? "1" : "0", result.content.property_get_response.value);
+    pb_release(&PB_Main_msg, &result);
+    mu_check(test_rpc_receive_one(&result, 0));
+    mu_assert_int_eq(PB_Main_empty_tag, result.which_content);
+    mu_check(!result.has_next);
+    pb_release(&PB_Main_msg, &result);
+
+    test_rpc_fill_basic_message(
+        &request, PB_Main_gui_start_screen_stream_request_tag, ++command_id);
+    test_rpc_encode_and_feed_one(&request, 0);
+    mu_check(test_rpc_receive_one(&result, 0));
+    mu_assert_int_eq(command_id, result.command_id);
+    mu_assert_int_eq(PB_CommandStatus_OK, result.command_status);
+    pb_release(&PB_Main_msg, &result);
+
+    // New framebuffer listener gets the current frame on the next redraw
+    Gui* gui = furi_record_open(RECORD_GUI);
+    const size_t frame_size = gui_get_framebuffer_size(gui);
+    gui_update(gui);
+    furi_record_close(RECORD_GUI);
+
+    mu_check(test_rpc_receive_one(&result, 0));
+    mu_assert_int_eq(PB_Main_gui_screen_frame_tag, result.which_content);
+    const pb_bytes_array_t* data = result.content.gui_screen_frame.data;
+    mu_check(data != NULL);
+    if(delta) {
+        RpcGuiStreamDecoder* decoder = rpc_gui_stream_decoder_alloc(frame_size);
+        mu_assert_int_eq(RpcGuiStreamFrameTypeKey, data->bytes[0]);
+        mu_check(rpc_gui_stream_decoder_decode(decoder, data->bytes, data->size) != NULL);
+        rpc_gui_stream_decoder_free(decoder);
+    } else {
+        mu_assert_int_eq(frame_size, data->size);
+    }
+    pb_release(&PB_Main_msg, &result);
+
+    // Frames may still arrive before the stop response
+    test_rpc_fill_basic_message(
+        &request, PB_Main_gui_stop_screen_stream_request_tag, ++command_id);
+    test_rpc_encode_and_feed_one(&request, 0);
+    bool stopped = false;
+    while(!stopped && test_rpc_receive_one(&result, 0)) {
+        if(result.which_content != PB_Main_gui_screen_frame_tag) {
+            mu_assert_int_eq(command_id, result.command_id);
+            mu_assert_int_eq(PB_CommandStatus_OK, result.command_status);
+            stopped = true;
+        }
+        pb_release(&PB_Main_msg, &result);
+    }
+    mu_check(stopped);
+}
+
+MU_TEST(test_rpc_gui_screen_stream) {
+    test_rpc_gui_screen_stream_run(false);
+}
+
+MU_TEST(test_rpc_gui_screen_stream_delta) {
+    test_rpc_gui_screen_stream_run(true);
+}
+
+MU_TEST_SUITE(test_rpc_gui) {
+    MU_SUITE_CONFIGURE(&test_rpc_setup, &test_rpc_teardown);
+
+    MU_RUN_TEST(test_rpc_gui_stream_codec);
+    MU_RUN_TEST(test_rpc_gui_screen_stream);
+    MU_RUN_TEST(test_rpc_gui_screen_stream_delta);
+}
+
 int run_minunit_test_rpc(void) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     if(storage_sd_status(storage) != FSE_OK) {
@@ -1851,6 +2080,7 @@ int run_minunit_test_rpc(void) {
     MU_RUN_SUITE(test_rpc_system);
     MU_RUN_SUITE(test_rpc_app);
     MU_RUN_SUITE(test_rpc_session);
+    MU_RUN_SUITE(test_rpc_gui);
 
     return MU_EXIT_CODE;
 }
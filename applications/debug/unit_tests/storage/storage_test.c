@@ -6,6 +6,8 @@
 // This is a hack to access internal storage functions and definitions
 #include <storage/storage_i.h>
 
+#include <sector_cache.h>
+
 #define UNIT_TESTS_PATH(path) EXT_PATH("unit_tests/" path)
 
 #define STORAGE_LOCKED_FILE EXT_PATH("locked_file.test")
@@ -13,6 +15,17 @@
 
 #define STORAGE_TEST_DIR UNIT_TESTS_PATH("test_dir")
 
+#define STORAGE_DIR_BATCH_DIR UNIT_TESTS_PATH("dir_batch")
+#define STORAGE_DIR_BATCH_FILES (100U)
+#define STORAGE_DIR_BATCH_SIZE (16U)
+#define STORAGE_DIR_BATCH_NAME_LENGTH (32U)
+
+#define STORAGE_SECTOR_CACHE_FILE UNIT_TESTS_PATH("storage_sector_cache.test")
+#define STORAGE_SECTOR_CACHE_FILE_SIZE (32U * 1024U)
+#define STORAGE_SECTOR_CACHE_CHUNK_SIZE (64U)
+#define STORAGE_SECTOR_CACHE_PATCH_OFFSET (10000U)
+#define STORAGE_SECTOR_CACHE_PATCH_SIZE (600U)
+
 static bool storage_file_create(Storage* storage, const char* path, const char* data) {
     File* file = storage_file_alloc(storage);
     bool result = false;
@@ -175,6 +188,78 @@ MU_TEST(storage_file_read_write_64k) {
     furi_record_close(RECORD_STORAGE);
 }
 
+static uint8_t storage_sector_cache_byte(size_t offset, bool patched) {
+    if(patched && offset >= STORAGE_SECTOR_CACHE_PATCH_OFFSET &&
+       offset < STORAGE_SECTOR_CACHE_PATCH_OFFSET + STORAGE_SECTOR_CACHE_PATCH_SIZE) {
+        return (offset * 3) ^ 0x5A;
+    }
+    return offset % 251;
+}
+
+static bool storage_sector_cache_read_check(File* file, uint8_t* data, bool patched) {
+    bool result =
+        storage_file_open(file, STORAGE_SECTOR_CACHE_FILE, FSAM_READ, FSOM_OPEN_EXISTING);
+
+    // Small reads go sector by sector, that is what read ahead is for
+    for(size_t offset = 0; result && offset < STORAGE_SECTOR_CACHE_FILE_SIZE;
+        offset += STORAGE_SECTOR_CACHE_CHUNK_SIZE) {
+        result = storage_file_read(file, data, STORAGE_SECTOR_CACHE_CHUNK_SIZE) ==
+                 STORAGE_SECTOR_CACHE_CHUNK_SIZE;
+        for(size_t i = 0; result && i < STORAGE_SECTOR_CACHE_CHUNK_SIZE; i++) {
+            result = data[i] == storage_sector_cache_byte(offset + i, patched);
+        }
+    }
+
+    storage_file_close(file);
+    return result;
+}
+
+MU_TEST(storage_sector_cache_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    uint8_t* data = malloc(STORAGE_SECTOR_CACHE_PATCH_SIZE);
+
+    mu_check(
+        storage_file_open(file, STORAGE_SECTOR_CACHE_FILE, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    for(size_t offset = 0; offset < STORAGE_SECTOR_CACHE_FILE_SIZE;
+        offset += STORAGE_SECTOR_CACHE_CHUNK_SIZE) {
+        for(size_t i = 0; i < STORAGE_SECTOR_CACHE_CHUNK_SIZE; i++) {
+            data[i] = storage_sector_cache_byte(offset + i, false);
+        }
+        mu_check(
+            storage_file_write(file, data, STORAGE_SECTOR_CACHE_CHUNK_SIZE) ==
+            STORAGE_SECTOR_CACHE_CHUNK_SIZE);
+    }
+    storage_file_close(file);
+
+    SectorCacheStats before, after;
+    sector_cache_get_stats(&before);
+    mu_check(storage_sector_cache_read_check(file, data, false));
+    sector_cache_get_stats(&after);
+
+    // Sequential sector reads are served by read ahead
+    mu_check(after.read_ahead_hits > before.read_ahead_hits);
+
+    // Write over sectors that are cached or read ahead, they must not be served stale
+    mu_check(storage_file_open(
+        file, STORAGE_SECTOR_CACHE_FILE, FSAM_READ_WRITE, FSOM_OPEN_EXISTING));
+    mu_check(storage_file_seek(file, STORAGE_SECTOR_CACHE_PATCH_OFFSET, true));
+    for(size_t i = 0; i < STORAGE_SECTOR_CACHE_PATCH_SIZE; i++) {
+        data[i] = storage_sector_cache_byte(STORAGE_SECTOR_CACHE_PATCH_OFFSET + i, true);
+    }
+    mu_check(
+        storage_file_write(file, data, STORAGE_SECTOR_CACHE_PATCH_SIZE) ==
+        STORAGE_SECTOR_CACHE_PATCH_SIZE);
+    storage_file_close(file);
+
+    mu_check(storage_sector_cache_read_check(file, data, true));
+    mu_check(storage_simply_remove(storage, STORAGE_SECTOR_CACHE_FILE));
+
+    free(data);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_file) {
     storage_file_open_lock_setup();
     MU_RUN_TEST(storage_file_open_close);
@@ -186,6 +271,10 @@ MU_TEST_SUITE(storage_file_64k) {
     MU_RUN_TEST(storage_file_read_write_64k);
 }
 
+MU_TEST_SUITE(storage_sector_cache) {
+    MU_RUN_TEST(storage_sector_cache_test);
+}
+
 MU_TEST(storage_dir_open_close) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     File* file;
@@ -258,10 +347,67 @@ MU_TEST(storage_dir_exists_test) {
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST(storage_dir_read_batch_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    FuriString* path = furi_string_alloc();
+
+    storage_simply_remove_recursive(storage, STORAGE_DIR_BATCH_DIR);
+    mu_assert_int_eq(FSE_OK, storage_common_mkdir(storage, STORAGE_DIR_BATCH_DIR));
+    for(uint32_t i = 0; i < STORAGE_DIR_BATCH_FILES; i++) {
+        furi_string_printf(path, "%s/file_%03lu.test", STORAGE_DIR_BATCH_DIR, i);
+        mu_check(storage_file_open(file, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_NEW));
+        storage_file_close(file);
+    }
+
+    char(*names)[STORAGE_DIR_BATCH_NAME_LENGTH] =
+        malloc(STORAGE_DIR_BATCH_FILES * STORAGE_DIR_BATCH_NAME_LENGTH);
+    char(*batch_names)[STORAGE_DIR_BATCH_NAME_LENGTH] =
+        malloc(STORAGE_DIR_BATCH_SIZE * STORAGE_DIR_BATCH_NAME_LENGTH);
+    FileInfo* fileinfo = malloc(sizeof(FileInfo) * STORAGE_DIR_BATCH_SIZE);
+
+    // Item by item
+    size_t count = 0;
+    mu_check(storage_dir_open(file, STORAGE_DIR_BATCH_DIR));
+    while(storage_dir_read(file, NULL, names[count], STORAGE_DIR_BATCH_NAME_LENGTH)) {
+        count++;
+        if(count == STORAGE_DIR_BATCH_FILES) break;
+    }
+    storage_dir_close(file);
+    mu_assert_int_eq(STORAGE_DIR_BATCH_FILES, count);
+
+    // Batched, same items in the same order
+    count = 0;
+    mu_check(storage_dir_open(file, STORAGE_DIR_BATCH_DIR));
+    while(true) {
+        size_t read = storage_dir_read_batch(
+            file, fileinfo, batch_names[0], STORAGE_DIR_BATCH_NAME_LENGTH, STORAGE_DIR_BATCH_SIZE);
+        for(size_t i = 0; (i < read) && (count < STORAGE_DIR_BATCH_FILES); i++) {
+            mu_check(!file_info_is_dir(&fileinfo[i]));
+            mu_assert_string_eq(names[count], batch_names[i]);
+            count++;
+        }
+        if(read < STORAGE_DIR_BATCH_SIZE) break;
+    }
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_file_get_error(file));
+    storage_dir_close(file);
+    mu_assert_int_eq(STORAGE_DIR_BATCH_FILES, count);
+
+    free(fileinfo);
+    free(batch_names);
+    free(names);
+    mu_check(storage_simply_remove_recursive(storage, STORAGE_DIR_BATCH_DIR));
+
+    furi_string_free(path);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_dir) {
     MU_RUN_TEST(storage_dir_open_close);
     MU_RUN_TEST(storage_dir_open_lock);
     MU_RUN_TEST(storage_dir_exists_test);
+    MU_RUN_TEST(storage_dir_read_batch_test);
 }
 
 static const char* const storage_copy_test_paths[] = {
@@ -705,6 +851,7 @@ MU_TEST_SUITE(test_md5_calc_suite) {
 int run_minunit_test_storage(void) {
     MU_RUN_SUITE(storage_file);
     MU_RUN_SUITE(storage_file_64k);
+    MU_RUN_SUITE(storage_sector_cache);
     MU_RUN_SUITE(storage_dir);
     MU_RUN_SUITE(storage_rename);
     MU_RUN_SUITE(test_data_path);
@@ -411,6 +411,91 @@ MU_TEST(stream_split_test) {
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST_1(stream_read_line_view_subtest, Stream* stream) {
+    const size_t long_line_size = 2000;
+    const char* line = NULL;
+    size_t line_size = 0;
+
+    stream_clean(stream);
+    stream_write_cstring(stream, "first\r\nsecond\n\nin\rner\r\n");
+    // Only trailing '\r' is stripped, line copy fallback included
+    for(size_t i = 0; i < long_line_size; i++) {
+        stream_write_char(stream, (i == long_line_size / 2) ? '\r' : 'L');
+    }
+    stream_write_cstring(stream, "\r\nlast");
+    mu_check(stream_rewind(stream));
+
+    mu_check(stream_read_line_view(stream, &line, &line_size));
+    mu_assert_int_eq(5, line_size);
+    mu_check(strncmp(line, "first", line_size) == 0);
+
+    mu_check(stream_read_line_view(stream, &line, &line_size));
+    mu_assert_int_eq(6, line_size);
+    mu_check(strncmp(line, "second", line_size) == 0);
+
+    mu_check(stream_read_line_view(stream, &line, &line_size));
+    mu_assert_int_eq(0, line_size);
+
+    mu_check(stream_read_line_view(stream, &line, &line_size));
+    mu_assert_int_eq(6, line_size);
+    mu_check(strncmp(line, "in\rner", line_size) == 0);
+
+    // Longer than the stream buffer
+    mu_check(stream_read_line_view(stream, &line, &line_size));
+    mu_assert_int_eq(long_line_size, line_size);
+    mu_check(line[0] == 'L' && line[long_line_size - 1] == 'L');
+    mu_check(line[long_line_size / 2] == '\r');
+
+    mu_check(stream_read_line_view(stream, &line, &line_size));
+    mu_assert_int_eq(4, line_size);
+    mu_check(strncmp(line, "last", line_size) == 0);
+
+    mu_check(!stream_read_line_view(stream, &line, &line_size));
+    mu_check(stream_eof(stream));
+
+    // Stream stays at the line ending
+    uint8_t eol = 0;
+    mu_check(stream_rewind(stream));
+    mu_check(stream_read_line_view_keep_eol(stream, &line, &line_size));
+    mu_assert_int_eq(5, line_size);
+    mu_check(strncmp(line, "first", line_size) == 0);
+    mu_assert_int_eq(1, stream_read(stream, &eol, 1));
+    mu_assert_int_eq('\n', eol);
+
+    for(size_t i = 0; i < 3; i++) {
+        mu_check(stream_read_line_view(stream, &line, &line_size));
+    }
+    mu_check(stream_read_line_view_keep_eol(stream, &line, &line_size));
+    mu_assert_int_eq(long_line_size, line_size);
+    mu_assert_int_eq(1, stream_read(stream, &eol, 1));
+    mu_assert_int_eq('\n', eol);
+}
+
+MU_TEST(stream_read_line_view_test) {
+    // test string stream
+    Stream* stream;
+    stream = string_stream_alloc();
+    MU_RUN_TEST_1(stream_read_line_view_subtest, stream);
+    stream_free(stream);
+
+    // test file stream
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    stream = file_stream_alloc(storage);
+    mu_check(
+        file_stream_open(stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    MU_RUN_TEST_1(stream_read_line_view_subtest, stream);
+    stream_free(stream);
+
+    // test buffered stream
+    stream = buffered_file_stream_alloc(storage);
+    mu_check(buffered_file_stream_open(
+        stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    MU_RUN_TEST_1(stream_read_line_view_subtest, stream);
+    stream_free(stream);
+
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST(stream_buffered_write_after_read_test) {
     const char* prefix = "I write ";
     const char* substr = "Hello there";
@@ -522,6 +607,7 @@ MU_TEST_SUITE(stream_suite) {
     MU_RUN_TEST(stream_write_read_save_load_test);
     MU_RUN_TEST(stream_composite_test);
     MU_RUN_TEST(stream_split_test);
+    MU_RUN_TEST(stream_read_line_view_test);
     MU_RUN_TEST(stream_buffered_write_after_read_test);
     MU_RUN_TEST(stream_buffered_large_file_test);
 }
@@ -5,18 +5,27 @@
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/subghz_keystore.h>
 #include <lib/subghz/subghz_file_encoder_worker.h>
+#include <lib/subghz/subghz_raw_file.h>
 #include <lib/subghz/protocols/protocol_items.h>
+#include <lib/subghz/protocols/keeloq_search.h>
 #include <flipper_format/flipper_format_i.h>
+#include <toolbox/stream/buffered_file_stream.h>
 #include <lib/subghz/devices/devices.h>
 #include <lib/subghz/devices/cc1101_configs.h>
 
 #define TAG "SubGhzTest"
 #define KEYSTORE_DIR_NAME EXT_PATH("subghz/assets/keeloq_mfcodes")
+#define KEYSTORE_CACHE_NAME EXT_PATH("unit_tests/subghz/keeloq_mfcodes.cache")
 #define CAME_ATOMO_DIR_NAME EXT_PATH("subghz/assets/came_atomo")
 #define NICE_FLOR_S_DIR_NAME EXT_PATH("subghz/assets/nice_flor_s")
 #define ALUTECH_AT_4N_DIR_NAME EXT_PATH("subghz/assets/alutech_at_4n")
 #define TEST_RANDOM_DIR_NAME EXT_PATH("unit_tests/subghz/test_random_raw.sub")
+#define TEST_RANDOM_VARINT_DIR_NAME EXT_PATH("unit_tests/subghz/test_random_raw_varint.sub")
 #define TEST_RANDOM_COUNT_PARSE 329
+#define TEST_RAW_PARSE_BATCH 512
+#define TEST_RAW_PARSE_DURATIONS 37
+#define TEST_RAW_PARSE_LINE_SIZE_MIN 1024
+#define TEST_KEELOQ_SEARCH_KEYS 500
 #define TEST_TIMEOUT 10000
 
 static SubGhzEnvironment* environment_handler;
@@ -148,6 +157,378 @@ static bool subghz_decode_random_test(const char* path) {
     }
 }
 
+static void subghz_decode_dispatch_replay(const char* path, bool fan_out, size_t* pulses) {
+    subghz_test_decoder_count = 0;
+    subghz_receiver_reset(receiver_handler);
+    uint32_t test_start = furi_get_tick();
+    *pulses = 0;
+
+    // Plain fan-out: every decodable protocol gets every pulse
+    size_t decoders_count = subghz_protocol_registry_count(&subghz_protocol_registry);
+    SubGhzProtocolDecoderBase** decoders =
+        malloc(sizeof(SubGhzProtocolDecoderBase*) * decoders_count);
+    for(size_t i = 0; i < decoders_count; i++) {
+        const SubGhzProtocol* protocol =
+            subghz_protocol_registry_get_by_index(&subghz_protocol_registry, i);
+        decoders[i] = NULL;
+        if(protocol->flag & SubGhzProtocolFlag_Decodable) {
+            decoders[i] =
+                subghz_receiver_search_decoder_base_by_name(receiver_handler, protocol->name);
+        }
+    }
+
+    file_worker_encoder_handler = subghz_file_encoder_worker_alloc();
+    if(subghz_file_encoder_worker_start(file_worker_encoder_handler, path, NULL)) {
+        // the worker needs a file in order to open and read part of the file
+        furi_delay_ms(100);
+
+        LevelDuration level_duration;
+        while(furi_get_tick() - test_start < TEST_TIMEOUT * 10) {
+            level_duration =
+                subghz_file_encoder_worker_get_level_duration(file_worker_encoder_handler);
+            if(!level_duration_is_reset(level_duration)) {
+                bool level = level_duration_get_level(level_duration);
+                uint32_t duration = level_duration_get_duration(level_duration);
+                // Yield, to load data inside the worker
+                furi_thread_yield();
+
+                if(fan_out) {
+                    for(size_t i = 0; i < decoders_count; i++) {
+                        if(decoders[i]) {
+                            decoders[i]->protocol->decoder->feed(decoders[i], level, duration);
+                        }
+                    }
+                } else {
+                    subghz_receiver_decode(receiver_handler, level, duration);
+                }
+                (*pulses)++;
+            } else {
+                break;
+            }
+        }
+        furi_delay_ms(10);
+        if(subghz_file_encoder_worker_is_running(file_worker_encoder_handler)) {
+            subghz_file_encoder_worker_stop(file_worker_encoder_handler);
+        }
+        subghz_file_encoder_worker_free(file_worker_encoder_handler);
+    }
+    free(decoders);
+}
+
+static bool subghz_decode_dispatch_test(const char* path) {
+    size_t fan_out_pulses = 0;
+    subghz_decode_dispatch_replay(path, true, &fan_out_pulses);
+    uint16_t fan_out_count = subghz_test_decoder_count;
+
+    size_t indexed_pulses = 0;
+    subghz_decode_dispatch_replay(path, false, &indexed_pulses);
+    uint16_t indexed_count = subghz_test_decoder_count;
+
+    return (fan_out_pulses == indexed_pulses) && (fan_out_count == indexed_count) &&
+           (indexed_count == TEST_RANDOM_COUNT_PARSE);
+}
+
+// Reference parser: the strchr/atoi walk used by the file encoder worker before,
+// without the zero it made of a trailing space
+static size_t subghz_raw_data_parse_reference(const char* str, int32_t* durations, size_t max) {
+    size_t count = 0;
+    str = strstr(str, "RAW_Data: ");
+    if(str) {
+        str = strchr(str, ' ');
+        while((count < max) && strchr(str, ' ')) {
+            str = strchr(str, ' ') + 1;
+            if((*str != '\0') && (*str != ' ')) durations[count++] = atoi(str);
+        }
+    }
+    return count;
+}
+
+static bool subghz_raw_data_parse_test(const char* path, size_t chunk_size) {
+    bool result = false;
+    size_t line_size_max = 0;
+    size_t durations_total = 0;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    Stream* line_stream = buffered_file_stream_alloc(storage);
+    Stream* chunk_stream = buffered_file_stream_alloc(storage);
+    FuriString* line_copy = furi_string_alloc();
+    char* chunk = malloc(chunk_size);
+    int32_t* durations = malloc(sizeof(int32_t) * TEST_RAW_PARSE_DURATIONS);
+    int32_t* reference = malloc(sizeof(int32_t) * TEST_RAW_PARSE_BATCH);
+    size_t reference_count = 0;
+    size_t reference_position = 0;
+    SubGhzFileEncoderWorkerParser parser;
+    subghz_file_encoder_worker_parser_reset(&parser);
+
+    do {
+        if(!buffered_file_stream_open(line_stream, path, FSAM_READ, FSOM_OPEN_EXISTING) ||
+           !buffered_file_stream_open(chunk_stream, path, FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+
+        // Tokenizer gets RAW_Data lines only, the reference skips the header itself
+        const char* line = NULL;
+        size_t line_size = 0;
+        size_t data_start = 0;
+        while(stream_read_line_view(chunk_stream, &line, &line_size) &&
+              (strncmp(line, "RAW_Data:", MIN(line_size, strlen("RAW_Data:"))) != 0)) {
+            data_start = stream_tell(chunk_stream);
+        }
+        if(!stream_seek(chunk_stream, data_start, StreamOffsetFromStart)) break;
+
+        // Chunks cut values and lines at any place, the parser carries them over
+        result = true;
+        bool is_end = false;
+        while(result && !is_end) {
+            size_t size = stream_read(chunk_stream, (uint8_t*)chunk, chunk_size);
+            if(size == 0) {
+                chunk[0] = '\n';
+                size = 1;
+                is_end = true;
+            }
+
+            size_t position = 0;
+            while(result && (position < size)) {
+                size_t count = 0;
+                result = subghz_file_encoder_worker_parse_raw_data(
+                    &parser, chunk, size, &position, durations, TEST_RAW_PARSE_DURATIONS, &count);
+
+                for(size_t i = 0; result && (i < count); i++) {
+                    while(result && (reference_position == reference_count)) {
+                        result = stream_read_line_view(line_stream, &line, &line_size);
+                        line_size_max = MAX(line_size_max, line_size);
+                        furi_string_set_strn(line_copy, line, line_size);
+                        reference_count = subghz_raw_data_parse_reference(
+                            furi_string_get_cstr(line_copy), reference, TEST_RAW_PARSE_BATCH);
+                        reference_position = 0;
+                    }
+                    result = result && (durations[i] == reference[reference_position++]);
+                }
+                durations_total += count;
+            }
+        }
+
+        // Both parsers got to the end of file, over lines longer than the stream cache
+        result = result && (reference_position == reference_count) &&
+                 (stream_tell(line_stream) == stream_size(line_stream)) &&
+                 (durations_total > 0) && (line_size_max > TEST_RAW_PARSE_LINE_SIZE_MIN);
+    } while(false);
+
+    free(reference);
+    free(durations);
+    free(chunk);
+    furi_string_free(line_copy);
+    stream_free(chunk_stream);
+    stream_free(line_stream);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+static bool subghz_raw_data_parse_malformed_test(void) {
+    const char* malformed[] = {
+        "RAW_Data: 12a\n",
+        "RAW_Data: -\n",
+        "RAW_Data: 1-2\n",
+        "RAW_Data: 1234567890\n",
+        "RAW_Data 1\n",
+        "Protocol: RAW\n",
+    };
+    int32_t durations[4];
+    bool result = true;
+
+    for(size_t i = 0; result && (i < COUNT_OF(malformed)); i++) {
+        SubGhzFileEncoderWorkerParser parser;
+        subghz_file_encoder_worker_parser_reset(&parser);
+        size_t position = 0;
+        size_t count = 0;
+        result = !subghz_file_encoder_worker_parse_raw_data(
+            &parser,
+            malformed[i],
+            strlen(malformed[i]),
+            &position,
+            durations,
+            COUNT_OF(durations),
+            &count);
+    }
+
+    return result;
+}
+
+static bool subghz_raw_varint_test(void) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FileInfo text_info = {};
+    FileInfo varint_info = {};
+    bool result = false;
+
+    do {
+        if(!subghz_raw_file_convert_to_varint(
+               storage, TEST_RANDOM_DIR_NAME, TEST_RANDOM_VARINT_DIR_NAME))
+            break;
+        if(storage_common_stat(storage, TEST_RANDOM_DIR_NAME, &text_info) != FSE_OK) break;
+        if(storage_common_stat(storage, TEST_RANDOM_VARINT_DIR_NAME, &varint_info) != FSE_OK)
+            break;
+        // Converted file decodes exactly as the text one
+        result = subghz_decode_random_test(TEST_RANDOM_VARINT_DIR_NAME) &&
+                 (varint_info.size < text_info.size);
+    } while(false);
+
+    storage_simply_remove(storage, TEST_RANDOM_VARINT_DIR_NAME);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+typedef struct {
+    uint8_t btn;
+    uint8_t end_serial;
+} SubGhzTestKeeloqSearch;
+
+static bool subghz_keeloq_search_test_check(
+    void* context,
+    const SubGhzKey* key,
+    uint8_t step,
+    uint32_t decrypt) {
+    UNUSED(key);
+    UNUSED(step);
+    SubGhzTestKeeloqSearch* search = context;
+    return ((decrypt >> 28) == search->btn) && (((decrypt >> 16) & 0xFF) == search->end_serial);
+}
+
+static const uint8_t subghz_keeloq_search_test_steps_simple[] = {SubGhzKeeloqStepSimple};
+static const uint8_t subghz_keeloq_search_test_steps_normal[] = {SubGhzKeeloqStepNormal};
+
+static const SubGhzKeeloqSearchSteps subghz_keeloq_search_test_learning[] = {
+    [KEELOQ_LEARNING_UNKNOWN] = {NULL, 0},
+    [KEELOQ_LEARNING_SIMPLE] = {subghz_keeloq_search_test_steps_simple, 1},
+    [KEELOQ_LEARNING_NORMAL] = {subghz_keeloq_search_test_steps_normal, 1},
+};
+
+static const SubGhzKeeloqSearch subghz_keeloq_search_test_search = {
+    .learning = subghz_keeloq_search_test_learning,
+    .learning_count = COUNT_OF(subghz_keeloq_search_test_learning),
+    .check = subghz_keeloq_search_test_check,
+};
+
+// Key by key, as protocols used to search
+static const SubGhzKey* subghz_keeloq_search_reference(
+    SubGhzKeystore* keystore,
+    uint32_t fix,
+    uint32_t hop,
+    SubGhzTestKeeloqSearch* search) {
+    size_t keys_count = 0;
+    const SubGhzKey* keys = subghz_keystore_get_keys(keystore, &keys_count);
+    for(size_t i = 0; i < keys_count; i++) {
+        uint64_t man = keys[i].key;
+        if(keys[i].type == KEELOQ_LEARNING_NORMAL) {
+            man = subghz_protocol_keeloq_common_normal_learning(fix, man);
+        }
+        uint32_t decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_keeloq_search_test_check(search, &keys[i], 0, decrypt)) {
+            return &keys[i];
+        }
+    }
+    return NULL;
+}
+
+static bool subghz_keeloq_search_test(void) {
+    SubGhzKeystore* keystore = subghz_keystore_alloc();
+    FuriString* name = furi_string_alloc();
+    SubGhzKeeloqSearchCache* cache = malloc(sizeof(SubGhzKeeloqSearchCache));
+    uint32_t random = 0x12345678;
+
+    // Synthetic keystore, simple and normal learning keys
+    for(size_t i = 0; i < TEST_KEELOQ_SEARCH_KEYS; i++) {
+        uint64_t key = 0;
+        for(size_t j = 0; j < 2; j++) {
+            random ^= random << 13;
+            random ^= random >> 17;
+            random ^= random << 5;
+            key = (key << 32) | random;
+        }
+        furi_string_printf(name, "Test %zu", i);
+        subghz_keystore_add_key(
+            keystore,
+            furi_string_get_cstr(name),
+            key,
+            (i % 2) ? KEELOQ_LEARNING_NORMAL : KEELOQ_LEARNING_SIMPLE);
+    }
+
+    // Parcel of a remote with one of the last keys, so the whole keystore is walked
+    size_t keys_count = 0;
+    const SubGhzKey* expected =
+        &subghz_keystore_get_keys(keystore, &keys_count)[TEST_KEELOQ_SEARCH_KEYS - 3];
+    uint32_t fix = 0x20ABCDEF;
+    SubGhzTestKeeloqSearch search = {.btn = fix >> 28, .end_serial = fix & 0xFF};
+    uint64_t man = subghz_protocol_keeloq_common_normal_learning(fix, expected->key);
+    uint32_t hop = subghz_protocol_keeloq_common_encrypt(
+        ((uint32_t)search.btn << 28) | ((uint32_t)search.end_serial << 16) | 0x0123, man);
+
+    const SubGhzKey* reference = subghz_keeloq_search_reference(keystore, fix, hop, &search);
+    const SubGhzKey* found = subghz_keeloq_search(
+        &subghz_keeloq_search_test_search, keystore, cache, fix, hop, fix & 0x0FFFFFFF, &search);
+    // Second search goes through the cache filled by the first one
+    const SubGhzKey* cached = subghz_keeloq_search(
+        &subghz_keeloq_search_test_search, keystore, cache, fix, hop, fix & 0x0FFFFFFF, &search);
+
+    // Earlier key may match by chance, both searches must agree on it anyway
+    bool result = reference && (found == reference) && (cached == reference);
+
+    free(cache);
+    furi_string_free(name);
+    subghz_keystore_free(keystore);
+
+    return result;
+}
+
+static bool subghz_keystore_cache_test(void) {
+    SubGhzKeystore* keystore = subghz_keystore_alloc();
+    SubGhzKeystore* keystore_cached = subghz_keystore_alloc();
+    SubGhzKeystore* keystore_from_cache = subghz_keystore_alloc();
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+
+    storage_simply_remove(storage, KEYSTORE_CACHE_NAME);
+
+    do {
+        if(!subghz_keystore_load(keystore, KEYSTORE_DIR_NAME)) break;
+        // First load makes the cache, the second one reads it
+        if(!subghz_keystore_load_cached(keystore_cached, KEYSTORE_DIR_NAME, KEYSTORE_CACHE_NAME))
+            break;
+        if(!subghz_keystore_load_cached(
+               keystore_from_cache, KEYSTORE_DIR_NAME, KEYSTORE_CACHE_NAME))
+            break;
+
+        size_t keys_count = 0;
+        size_t keys_cached_count = 0;
+        const SubGhzKey* keys = subghz_keystore_get_keys(keystore, &keys_count);
+        const SubGhzKey* keys_cached =
+            subghz_keystore_get_keys(keystore_from_cache, &keys_cached_count);
+
+        if(!keys_count || (keys_count != keys_cached_count)) break;
+        size_t i = 0;
+        for(; i < keys_count; i++) {
+            if((keys[i].key != keys_cached[i].key) || (keys[i].type != keys_cached[i].type) ||
+               (strcmp(keys[i].name, keys_cached[i].name) != 0))
+                break;
+            // The first key with the name is found by name
+            const SubGhzKey* found = subghz_keystore_find_by_name(keystore, keys[i].name);
+            if(!found || (found > &keys[i]) || (strcmp(found->name, keys[i].name) != 0)) break;
+        }
+        if(i != keys_count) break;
+
+        result = !subghz_keystore_find_by_name(keystore, "Unit test unknown manufacture");
+    } while(false);
+
+    storage_simply_remove(storage, KEYSTORE_CACHE_NAME);
+    furi_record_close(RECORD_STORAGE);
+
+    subghz_keystore_free(keystore_from_cache);
+    subghz_keystore_free(keystore_cached);
+    subghz_keystore_free(keystore);
+
+    return result;
+}
+
 static bool subghz_encoder_test(const char* path) {
     subghz_test_decoder_count = 0;
     uint32_t test_start = furi_get_tick();
@@ -825,9 +1206,34 @@ MU_TEST(subghz_random_test) {
     mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME), "Random test error\r\n");
 }
 
+MU_TEST(subghz_dispatch_test) {
+    mu_assert(subghz_decode_dispatch_test(TEST_RANDOM_DIR_NAME), "Dispatch test error\r\n");
+}
+
+MU_TEST(subghz_raw_data_parse_test) {
+    mu_assert(
+        subghz_raw_data_parse_test(TEST_RANDOM_DIR_NAME, 7), "RAW_Data parse test error\r\n");
+    mu_assert(
+        subghz_raw_data_parse_test(TEST_RANDOM_DIR_NAME, 512), "RAW_Data parse test error\r\n");
+    mu_assert(subghz_raw_data_parse_malformed_test(), "RAW_Data malformed test error\r\n");
+}
+
+MU_TEST(subghz_raw_varint_test) {
+    mu_assert(subghz_raw_varint_test(), "RAW varint test error\r\n");
+}
+
+MU_TEST(subghz_keystore_cache_test) {
+    mu_assert(subghz_keystore_cache_test(), "Keystore cache test error\r\n");
+}
+
+MU_TEST(subghz_keeloq_search_test) {
+    mu_assert(subghz_keeloq_search_test(), "KeeLoq search test error\r\n");
+}
+
 MU_TEST_SUITE(subghz) {
     subghz_test_init();
     MU_RUN_TEST(subghz_keystore_test);
+    MU_RUN_TEST(subghz_keystore_cache_test);
 
     MU_RUN_TEST(subghz_hal_async_tx_test);
 
@@ -901,6 +1307,10 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_encoder_mastercode_test);
 
     MU_RUN_TEST(subghz_random_test);
+    MU_RUN_TEST(subghz_dispatch_test);
+    MU_RUN_TEST(subghz_raw_data_parse_test);
+    MU_RUN_TEST(subghz_raw_varint_test);
+    MU_RUN_TEST(subghz_keeloq_search_test);
     subghz_test_deinit();
 }
 
@@ -50,6 +50,14 @@ bool ducky_is_line_end(const char chr) {
     return ((chr == ' ') || (chr == '\0') || (chr == '\r') || (chr == '\n'));
 }
 
+int ducky_word_cmp(const char* word, size_t word_len, const char* name) {
+    int cmp = strncmp(word, name, word_len);
+    if((cmp == 0) && (name[word_len] != '\0')) {
+        cmp = -1; // Word is a prefix of the name
+    }
+    return cmp;
+}
+
 uint16_t ducky_get_keycode(BadUsbScript* bad_usb, const char* param, bool accept_chars) {
     uint16_t keycode = ducky_get_keycode_by_name(param);
     if(keycode != HID_KEYBOARD_NONE) {
@@ -133,42 +141,63 @@ int32_t ducky_error(BadUsbScript* bad_usb, const char* text, ...) {
     return SCRIPT_STATE_ERROR;
 }
 
-bool ducky_string(BadUsbScript* bad_usb, const char* param) {
-    uint32_t i = 0;
+static uint16_t ducky_string_keycode(BadUsbScript* bad_usb, char chr) {
+    if(chr == '\n') {
+        return HID_KEYBOARD_RETURN;
+    }
+    return BADUSB_ASCII_TO_KEY(bad_usb, chr);
+}
 
-    while(param[i] != '\0') {
-        if(param[i] != '\n') {
-            uint16_t keycode = BADUSB_ASCII_TO_KEY(bad_usb, param[i]);
-            if(keycode != HID_KEYBOARD_NONE) {
-                furi_hal_hid_kb_press(keycode);
-                furi_hal_hid_kb_release(keycode);
-            }
-        } else {
-            furi_hal_hid_kb_press(HID_KEYBOARD_RETURN);
-            furi_hal_hid_kb_release(HID_KEYBOARD_RETURN);
+static void ducky_string_stats(BadUsbScript* bad_usb, size_t chars, uint32_t start) {
+    uint32_t ticks = furi_get_tick() - start;
+    if(ticks > 0) {
+        bad_usb->st.cps = (chars * furi_kernel_get_tick_frequency()) / ticks;
+    }
+}
+
+bool ducky_string(BadUsbScript* bad_usb, const char* param) {
+    uint16_t keycodes[DUCKY_STRING_BATCH_LEN];
+    size_t keycodes_nb = 0;
+    size_t chars = 0;
+    uint32_t start = furi_get_tick();
+
+    // Keys are typed by the HAL, a batch is one call
+    for(uint32_t i = 0; param[i] != '\0'; i++) {
+        uint16_t keycode = ducky_string_keycode(bad_usb, param[i]);
+        if(keycode != HID_KEYBOARD_NONE) {
+            keycodes[keycodes_nb++] = keycode;
+        }
+        if(keycodes_nb == DUCKY_STRING_BATCH_LEN) {
+            furi_hal_hid_kb_type(keycodes, keycodes_nb);
+            chars += keycodes_nb;
+            keycodes_nb = 0;
         }
-        i++;
     }
+    if(keycodes_nb > 0) {
+        furi_hal_hid_kb_type(keycodes, keycodes_nb);
+        chars += keycodes_nb;
+    }
+
+    ducky_string_stats(bad_usb, chars, start);
     bad_usb->stringdelay = 0;
     return true;
 }
 
 static bool ducky_string_next(BadUsbScript* bad_usb) {
     if(bad_usb->string_print_pos >= furi_string_size(bad_usb->string_print)) {
+        ducky_string_stats(
+            bad_usb, furi_string_size(bad_usb->string_print), bad_usb->string_print_start);
         return true;
     }
 
-    char print_char = furi_string_get_char(bad_usb->string_print, bad_usb->string_print_pos);
+    if(bad_usb->string_print_pos == 0) {
+        bad_usb->string_print_start = furi_get_tick();
+    }
 
-    if(print_char != '\n') {
-        uint16_t keycode = BADUSB_ASCII_TO_KEY(bad_usb, print_char);
-        if(keycode != HID_KEYBOARD_NONE) {
-            furi_hal_hid_kb_press(keycode);
-            furi_hal_hid_kb_release(keycode);
-        }
-    } else {
-        furi_hal_hid_kb_press(HID_KEYBOARD_RETURN);
-        furi_hal_hid_kb_release(HID_KEYBOARD_RETURN);
+    char print_char = furi_string_get_char(bad_usb->string_print, bad_usb->string_print_pos);
+    uint16_t keycode = ducky_string_keycode(bad_usb, print_char);
+    if(keycode != HID_KEYBOARD_NONE) {
+        furi_hal_hid_kb_type(&keycode, 1);
     }
 
     bad_usb->string_print_pos++;
@@ -176,36 +205,48 @@ static bool ducky_string_next(BadUsbScript* bad_usb) {
     return false;
 }
 
-static int32_t ducky_parse_line(BadUsbScript* bad_usb, FuriString* line) {
-    uint32_t line_len = furi_string_size(line);
-    const char* line_tmp = furi_string_get_cstr(line);
-
-    if(line_len == 0) {
-        return SCRIPT_STATE_NEXT_LINE; // Skip empty lines
+static int32_t ducky_compile_line(BadUsbScript* bad_usb, const char* line, DuckyOp* op) {
+    if(line[0] == '\0') {
+        op->opcode = DuckyOpEmpty; // Skip empty lines
+        return 0;
     }
-    FURI_LOG_D(WORKER_TAG, "line:%s", line_tmp);
 
     // Ducky Lang Functions
-    int32_t cmd_result = ducky_execute_cmd(bad_usb, line_tmp);
+    int32_t cmd_result = ducky_compile_cmd(bad_usb, line, op);
     if(cmd_result != SCRIPT_STATE_CMD_UNKNOWN) {
         return cmd_result;
     }
 
     // Special keys + modifiers
-    uint16_t key = ducky_get_keycode(bad_usb, line_tmp, false);
+    uint16_t key = ducky_get_keycode(bad_usb, line, false);
     if(key == HID_KEYBOARD_NONE) {
-        return ducky_error(bad_usb, "No keycode defined for %s", line_tmp);
+        return ducky_error(bad_usb, "No keycode defined for %s", line);
     }
     if((key & 0xFF00) != 0) {
         // It's a modifier key
-        line_tmp = &line_tmp[ducky_get_command_len(line_tmp) + 1];
-        key |= ducky_get_keycode(bad_usb, line_tmp, true);
+        key |= ducky_get_keycode(bad_usb, &line[ducky_get_command_len(line) + 1], true);
     }
-    furi_hal_hid_kb_press(key);
-    furi_hal_hid_kb_release(key);
+    op->opcode = DuckyOpKey;
+    op->keycode = key;
+    op->arg = 0;
     return 0;
 }
 
+static int32_t ducky_parse_line(BadUsbScript* bad_usb, FuriString* line, DuckyOp* op) {
+    const char* line_tmp = furi_string_get_cstr(line);
+    if(line_tmp[0] != '\0') {
+        FURI_LOG_D(WORKER_TAG, "line:%s", line_tmp);
+    }
+
+    int32_t result = ducky_compile_line(bad_usb, line_tmp, op);
+    if(result < 0) {
+        op->opcode = DuckyOpEmpty;
+        return result;
+    }
+
+    return ducky_execute_cmd(bad_usb, line_tmp, op);
+}
+
 static bool ducky_set_usb_id(BadUsbScript* bad_usb, const char* line) {
     if(sscanf(line, "%lX:%lX", &bad_usb->hid_cfg.vid, &bad_usb->hid_cfg.pid) == 2) {
         bad_usb->hid_cfg.manuf[0] = '\0';
@@ -281,7 +322,9 @@ static int32_t ducky_script_execute_next(BadUsbScript* bad_usb, File* script_fil
 
     if(bad_usb->repeat_cnt > 0) {
         bad_usb->repeat_cnt--;
-        delay_val = ducky_parse_line(bad_usb, bad_usb->line_prev);
+        // Compiled with the previous line, no parsing here
+        delay_val = ducky_execute_cmd(
+            bad_usb, furi_string_get_cstr(bad_usb->line_prev), &bad_usb->op_prev);
         if(delay_val == SCRIPT_STATE_NEXT_LINE) { // Empty line
             return 0;
         } else if(delay_val == SCRIPT_STATE_STRING_START) { // Print string with delays
@@ -299,6 +342,8 @@ static int32_t ducky_script_execute_next(BadUsbScript* bad_usb, File* script_fil
 
     furi_string_set(bad_usb->line_prev, bad_usb->line);
     furi_string_reset(bad_usb->line);
+    bad_usb->op_prev = bad_usb->op;
+    bad_usb->op.opcode = DuckyOpEmpty;
 
     while(1) {
         if(bad_usb->buf_len == 0) {
@@ -320,7 +365,7 @@ static int32_t ducky_script_execute_next(BadUsbScript* bad_usb, File* script_fil
                 bad_usb->buf_len = bad_usb->buf_len + bad_usb->buf_start - (i + 1);
                 bad_usb->buf_start = i + 1;
                 furi_string_trim(bad_usb->line);
-                delay_val = ducky_parse_line(bad_usb, bad_usb->line);
+                delay_val = ducky_parse_line(bad_usb, bad_usb->line, &bad_usb->op);
                 if(delay_val == SCRIPT_STATE_NEXT_LINE) { // Empty line
                     return 0;
                 } else if(delay_val == SCRIPT_STATE_STRING_START) { // Print string with delays
@@ -433,6 +478,7 @@ static int32_t bad_usb_worker(void* context) {
                 bad_usb->defdelay = 0;
                 bad_usb->stringdelay = 0;
                 bad_usb->repeat_cnt = 0;
+                bad_usb->st.cps = 0;
                 bad_usb->key_hold_nb = 0;
                 bad_usb->file_end = false;
                 storage_file_seek(script_file, 0, true);
@@ -456,6 +502,7 @@ static int32_t bad_usb_worker(void* context) {
                 bad_usb->defdelay = 0;
                 bad_usb->stringdelay = 0;
                 bad_usb->repeat_cnt = 0;
+                bad_usb->st.cps = 0;
                 bad_usb->file_end = false;
                 storage_file_seek(script_file, 0, true);
                 // extra time for PC to recognize Flipper as keyboard
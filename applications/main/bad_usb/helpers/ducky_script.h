@@ -27,6 +27,7 @@ typedef struct {
     size_t line_cur;
     size_t line_nb;
     uint32_t delay_remain;
+    uint32_t cps; /**< Typing speed of the last string, characters per second */
     size_t error_line;
     char error[64];
 } BadUsbState;
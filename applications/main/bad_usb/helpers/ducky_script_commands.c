@@ -3,60 +3,107 @@
 #include "ducky_script.h"
 #include "ducky_script_i.h"
 
-typedef int32_t (*DuckyCmdCallback)(BadUsbScript* bad_usb, const char* line, int32_t param);
-
 typedef struct {
     char* name;
-    DuckyCmdCallback callback;
-    int32_t param;
+    DuckyOpcode opcode;
 } DuckyCmd;
 
-static int32_t ducky_fnc_delay(BadUsbScript* bad_usb, const char* line, int32_t param) {
-    UNUSED(param);
+// Sorted by name, looked up with binary search
+static const DuckyCmd ducky_commands[] = {
+    {"ALTCHAR", DuckyOpAltchar},
+    {"ALTCODE", DuckyOpAltstring},
+    {"ALTSTRING", DuckyOpAltstring},
+    {"DEFAULTDELAY", DuckyOpDefaultDelay},
+    {"DEFAULT_DELAY", DuckyOpDefaultDelay},
+    {"DELAY", DuckyOpDelay},
+    {"HOLD", DuckyOpHold},
+    {"ID", DuckyOpNone},
+    {"RELEASE", DuckyOpRelease},
+    {"REM", DuckyOpNone},
+    {"REPEAT", DuckyOpRepeat},
+    {"STRING", DuckyOpString},
+    {"STRINGDELAY", DuckyOpStringDelay},
+    {"STRINGLN", DuckyOpStringLn},
+    {"STRING_DELAY", DuckyOpStringDelay},
+    {"SYSRQ", DuckyOpSysrq},
+    {"WAIT_FOR_BUTTON_PRESS", DuckyOpWaitForButton},
+};
+
+#define TAG "BadUsb"
+#define WORKER_TAG TAG "Worker"
 
-    line = &line[ducky_get_command_len(line) + 1];
-    uint32_t delay_val = 0;
-    bool state = ducky_get_number(line, &delay_val);
-    if((state) && (delay_val > 0)) {
-        return (int32_t)delay_val;
+static const DuckyCmd* ducky_find_cmd(const char* line) {
+    size_t cmd_word_len = strcspn(line, " ");
+    size_t low = 0;
+    size_t high = COUNT_OF(ducky_commands);
+
+    while(low < high) {
+        size_t mid = (low + high) / 2;
+        int cmp = ducky_word_cmp(line, cmd_word_len, ducky_commands[mid].name);
+        if(cmp == 0) {
+            return &ducky_commands[mid];
+        } else if(cmp < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
     }
 
-    return ducky_error(bad_usb, "Invalid number %s", line);
+    return NULL;
 }
 
-static int32_t ducky_fnc_defdelay(BadUsbScript* bad_usb, const char* line, int32_t param) {
-    UNUSED(param);
-
-    line = &line[ducky_get_command_len(line) + 1];
-    bool state = ducky_get_number(line, &bad_usb->defdelay);
-    if(!state) {
-        return ducky_error(bad_usb, "Invalid number %s", line);
+int32_t ducky_compile_cmd(BadUsbScript* bad_usb, const char* line, DuckyOp* op) {
+    const DuckyCmd* cmd = ducky_find_cmd(line);
+    if(cmd == NULL) {
+        return SCRIPT_STATE_CMD_UNKNOWN;
     }
-    return 0;
-}
 
-static int32_t ducky_fnc_strdelay(BadUsbScript* bad_usb, const char* line, int32_t param) {
-    UNUSED(param);
-
-    line = &line[ducky_get_command_len(line) + 1];
-    bool state = ducky_get_number(line, &bad_usb->stringdelay);
-    if(!state) {
-        return ducky_error(bad_usb, "Invalid number %s", line);
+    op->opcode = cmd->opcode;
+    op->keycode = HID_KEYBOARD_NONE;
+    op->value = 0;
+    op->arg = ducky_get_command_len(line) + 1;
+    const char* param = &line[op->arg];
+
+    switch(op->opcode) {
+    case DuckyOpDefaultDelay:
+    case DuckyOpStringDelay:
+        if(!ducky_get_number(param, &op->value)) {
+            return ducky_error(bad_usb, "Invalid number %s", param);
+        }
+        break;
+    case DuckyOpDelay:
+    case DuckyOpRepeat:
+        if((!ducky_get_number(param, &op->value)) || (op->value == 0)) {
+            return ducky_error(bad_usb, "Invalid number %s", param);
+        }
+        break;
+    case DuckyOpSysrq:
+        op->keycode = ducky_get_keycode(bad_usb, param, true);
+        break;
+    case DuckyOpHold:
+    case DuckyOpRelease:
+        op->keycode = ducky_get_keycode(bad_usb, param, true);
+        if(op->keycode == HID_KEYBOARD_NONE) {
+            return ducky_error(bad_usb, "No keycode defined for %s", param);
+        }
+        break;
+    default:
+        break;
     }
+
     return 0;
 }
 
-static int32_t ducky_fnc_string(BadUsbScript* bad_usb, const char* line, int32_t param) {
-    line = &line[ducky_get_command_len(line) + 1];
-    furi_string_set_str(bad_usb->string_print, line);
-    if(param == 1) {
+static int32_t ducky_fnc_string(BadUsbScript* bad_usb, const char* param, bool new_line) {
+    furi_string_set_str(bad_usb->string_print, param);
+    if(new_line) {
         furi_string_cat(bad_usb->string_print, "\n");
     }
 
     if(bad_usb->stringdelay == 0) { // stringdelay not set - run command immediately
         bool state = ducky_string(bad_usb, furi_string_get_cstr(bad_usb->string_print));
         if(!state) {
-            return ducky_error(bad_usb, "Invalid string %s", line);
+            return ducky_error(bad_usb, "Invalid string %s", param);
         }
     } else { // stringdelay is set - run command in thread to keep handling external events
         return SCRIPT_STATE_STRING_START;
@@ -65,60 +112,32 @@ static int32_t ducky_fnc_string(BadUsbScript* bad_usb, const char* line, int32_t
     return 0;
 }
 
-static int32_t ducky_fnc_repeat(BadUsbScript* bad_usb, const char* line, int32_t param) {
-    UNUSED(param);
-
-    line = &line[ducky_get_command_len(line) + 1];
-    bool state = ducky_get_number(line, &bad_usb->repeat_cnt);
-    if((!state) || (bad_usb->repeat_cnt == 0)) {
-        return ducky_error(bad_usb, "Invalid number %s", line);
-    }
-    return 0;
-}
-
-static int32_t ducky_fnc_sysrq(BadUsbScript* bad_usb, const char* line, int32_t param) {
-    UNUSED(param);
-
-    line = &line[ducky_get_command_len(line) + 1];
-    uint16_t key = ducky_get_keycode(bad_usb, line, true);
+static int32_t ducky_fnc_sysrq(uint16_t key) {
     furi_hal_hid_kb_press(KEY_MOD_LEFT_ALT | HID_KEYBOARD_PRINT_SCREEN);
     furi_hal_hid_kb_press(key);
     furi_hal_hid_kb_release_all();
     return 0;
 }
 
-static int32_t ducky_fnc_altchar(BadUsbScript* bad_usb, const char* line, int32_t param) {
-    UNUSED(param);
-
-    line = &line[ducky_get_command_len(line) + 1];
+static int32_t ducky_fnc_altchar(BadUsbScript* bad_usb, const char* param) {
     ducky_numlock_on();
-    bool state = ducky_altchar(line);
+    bool state = ducky_altchar(param);
     if(!state) {
-        return ducky_error(bad_usb, "Invalid altchar %s", line);
+        return ducky_error(bad_usb, "Invalid altchar %s", param);
     }
     return 0;
 }
 
-static int32_t ducky_fnc_altstring(BadUsbScript* bad_usb, const char* line, int32_t param) {
-    UNUSED(param);
-
-    line = &line[ducky_get_command_len(line) + 1];
+static int32_t ducky_fnc_altstring(BadUsbScript* bad_usb, const char* param) {
     ducky_numlock_on();
-    bool state = ducky_altstring(line);
+    bool state = ducky_altstring(param);
     if(!state) {
-        return ducky_error(bad_usb, "Invalid altstring %s", line);
+        return ducky_error(bad_usb, "Invalid altstring %s", param);
     }
     return 0;
 }
 
-static int32_t ducky_fnc_hold(BadUsbScript* bad_usb, const char* line, int32_t param) {
-    UNUSED(param);
-
-    line = &line[ducky_get_command_len(line) + 1];
-    uint16_t key = ducky_get_keycode(bad_usb, line, true);
-    if(key == HID_KEYBOARD_NONE) {
-        return ducky_error(bad_usb, "No keycode defined for %s", line);
-    }
+static int32_t ducky_fnc_hold(BadUsbScript* bad_usb, uint16_t key) {
     bad_usb->key_hold_nb++;
     if(bad_usb->key_hold_nb > (HID_KB_MAX_KEYS - 1)) {
         return ducky_error(bad_usb, "Too many keys are hold");
@@ -127,14 +146,7 @@ static int32_t ducky_fnc_hold(BadUsbScript* bad_usb, const char* line, int32_t p
     return 0;
 }
 
-static int32_t ducky_fnc_release(BadUsbScript* bad_usb, const char* line, int32_t param) {
-    UNUSED(param);
-
-    line = &line[ducky_get_command_len(line) + 1];
-    uint16_t key = ducky_get_keycode(bad_usb, line, true);
-    if(key == HID_KEYBOARD_NONE) {
-        return ducky_error(bad_usb, "No keycode defined for %s", line);
-    }
+static int32_t ducky_fnc_release(BadUsbScript* bad_usb, uint16_t key) {
     if(bad_usb->key_hold_nb == 0) {
         return ducky_error(bad_usb, "No keys are hold");
     }
@@ -143,54 +155,44 @@ static int32_t ducky_fnc_release(BadUsbScript* bad_usb, const char* line, int32_
     return 0;
 }
 
-static int32_t ducky_fnc_waitforbutton(BadUsbScript* bad_usb, const char* line, int32_t param) {
-    UNUSED(param);
-    UNUSED(bad_usb);
-    UNUSED(line);
-
-    return SCRIPT_STATE_WAIT_FOR_BTN;
-}
-
-static const DuckyCmd ducky_commands[] = {
-    {"REM", NULL, -1},
-    {"ID", NULL, -1},
-    {"DELAY", ducky_fnc_delay, -1},
-    {"STRING", ducky_fnc_string, 0},
-    {"STRINGLN", ducky_fnc_string, 1},
-    {"DEFAULT_DELAY", ducky_fnc_defdelay, -1},
-    {"DEFAULTDELAY", ducky_fnc_defdelay, -1},
-    {"STRINGDELAY", ducky_fnc_strdelay, -1},
-    {"STRING_DELAY", ducky_fnc_strdelay, -1},
-    {"REPEAT", ducky_fnc_repeat, -1},
-    {"SYSRQ", ducky_fnc_sysrq, -1},
-    {"ALTCHAR", ducky_fnc_altchar, -1},
-    {"ALTSTRING", ducky_fnc_altstring, -1},
-    {"ALTCODE", ducky_fnc_altstring, -1},
-    {"HOLD", ducky_fnc_hold, -1},
-    {"RELEASE", ducky_fnc_release, -1},
-    {"WAIT_FOR_BUTTON_PRESS", ducky_fnc_waitforbutton, -1},
-};
-
-#define TAG "BadUsb"
-#define WORKER_TAG TAG "Worker"
-
-int32_t ducky_execute_cmd(BadUsbScript* bad_usb, const char* line) {
-    size_t cmd_word_len = strcspn(line, " ");
-    for(size_t i = 0; i < COUNT_OF(ducky_commands); i++) {
-        size_t cmd_compare_len = strlen(ducky_commands[i].name);
-
-        if(cmd_compare_len != cmd_word_len) {
-            continue;
-        }
-
-        if(strncmp(line, ducky_commands[i].name, cmd_compare_len) == 0) {
-            if(ducky_commands[i].callback == NULL) {
-                return 0;
-            } else {
-                return ((ducky_commands[i].callback)(bad_usb, line, ducky_commands[i].param));
-            }
-        }
+int32_t ducky_execute_cmd(BadUsbScript* bad_usb, const char* line, const DuckyOp* op) {
+    const char* param = &line[op->arg];
+
+    switch(op->opcode) {
+    case DuckyOpEmpty:
+        return SCRIPT_STATE_NEXT_LINE;
+    case DuckyOpKey:
+        furi_hal_hid_kb_press(op->keycode);
+        furi_hal_hid_kb_release(op->keycode);
+        return 0;
+    case DuckyOpDelay:
+        return (int32_t)op->value;
+    case DuckyOpDefaultDelay:
+        bad_usb->defdelay = op->value;
+        return 0;
+    case DuckyOpStringDelay:
+        bad_usb->stringdelay = op->value;
+        return 0;
+    case DuckyOpString:
+        return ducky_fnc_string(bad_usb, param, false);
+    case DuckyOpStringLn:
+        return ducky_fnc_string(bad_usb, param, true);
+    case DuckyOpRepeat:
+        bad_usb->repeat_cnt = op->value;
+        return 0;
+    case DuckyOpSysrq:
+        return ducky_fnc_sysrq(op->keycode);
+    case DuckyOpAltchar:
+        return ducky_fnc_altchar(bad_usb, param);
+    case DuckyOpAltstring:
+        return ducky_fnc_altstring(bad_usb, param);
+    case DuckyOpHold:
+        return ducky_fnc_hold(bad_usb, op->keycode);
+    case DuckyOpRelease:
+        return ducky_fnc_release(bad_usb, op->keycode);
+    case DuckyOpWaitForButton:
+        return SCRIPT_STATE_WAIT_FOR_BTN;
+    default:
+        return 0;
     }
-
-    return SCRIPT_STATE_CMD_UNKNOWN;
 }
@@ -16,6 +16,33 @@ extern "C" {
 #define SCRIPT_STATE_WAIT_FOR_BTN (-6)
 
 #define FILE_BUFFER_LEN 16
+#define DUCKY_STRING_BATCH_LEN 32
+
+typedef enum {
+    DuckyOpEmpty,
+    DuckyOpNone, /**< REM and ID, only the default delay */
+    DuckyOpKey,
+    DuckyOpDelay,
+    DuckyOpDefaultDelay,
+    DuckyOpStringDelay,
+    DuckyOpString,
+    DuckyOpStringLn,
+    DuckyOpRepeat,
+    DuckyOpSysrq,
+    DuckyOpAltchar,
+    DuckyOpAltstring,
+    DuckyOpHold,
+    DuckyOpRelease,
+    DuckyOpWaitForButton,
+} DuckyOpcode;
+
+/** Script line compiled once, REPEAT runs it again without parsing */
+typedef struct {
+    DuckyOpcode opcode;
+    uint16_t keycode;
+    uint32_t value; /**< Delay or repeat count */
+    uint16_t arg; /**< Offset of the command argument in the line */
+} DuckyOp;
 
 struct BadUsbScript {
     FuriHalUsbHidConfig hid_cfg;
@@ -34,11 +61,14 @@ struct BadUsbScript {
 
     FuriString* line;
     FuriString* line_prev;
+    DuckyOp op;
+    DuckyOp op_prev;
     uint32_t repeat_cnt;
     uint8_t key_hold_nb;
 
     FuriString* string_print;
     size_t string_print_pos;
+    uint32_t string_print_start;
 };
 
 uint16_t ducky_get_keycode(BadUsbScript* bad_usb, const char* param, bool accept_chars);
@@ -47,6 +77,8 @@ uint32_t ducky_get_command_len(const char* line);
 
 bool ducky_is_line_end(const char chr);
 
+int ducky_word_cmp(const char* word, size_t word_len, const char* name);
+
 uint16_t ducky_get_keycode_by_name(const char* param);
 
 bool ducky_get_number(const char* param, uint32_t* val);
@@ -61,7 +93,9 @@ bool ducky_altstring(const char* param);
 
 bool ducky_string(BadUsbScript* bad_usb, const char* param);
 
-int32_t ducky_execute_cmd(BadUsbScript* bad_usb, const char* line);
+int32_t ducky_compile_cmd(BadUsbScript* bad_usb, const char* line, DuckyOp* op);
+
+int32_t ducky_execute_cmd(BadUsbScript* bad_usb, const char* line, const DuckyOp* op);
 
 int32_t ducky_error(BadUsbScript* bad_usb, const char* text, ...);
 
@@ -7,52 +7,30 @@ typedef struct {
     uint16_t keycode;
 } DuckyKey;
 
+// Sorted by name, looked up with binary search
 static const DuckyKey ducky_keys[] = {
-    {"CTRL-ALT", KEY_MOD_LEFT_CTRL | KEY_MOD_LEFT_ALT},
-    {"CTRL-SHIFT", KEY_MOD_LEFT_CTRL | KEY_MOD_LEFT_SHIFT},
-    {"ALT-SHIFT", KEY_MOD_LEFT_ALT | KEY_MOD_LEFT_SHIFT},
-    {"ALT-GUI", KEY_MOD_LEFT_ALT | KEY_MOD_LEFT_GUI},
-    {"GUI-SHIFT", KEY_MOD_LEFT_GUI | KEY_MOD_LEFT_SHIFT},
-    {"GUI-CTRL", KEY_MOD_LEFT_GUI | KEY_MOD_LEFT_CTRL},
-
-    {"CTRL", KEY_MOD_LEFT_CTRL},
-    {"CONTROL", KEY_MOD_LEFT_CTRL},
-    {"SHIFT", KEY_MOD_LEFT_SHIFT},
     {"ALT", KEY_MOD_LEFT_ALT},
-    {"GUI", KEY_MOD_LEFT_GUI},
-    {"WINDOWS", KEY_MOD_LEFT_GUI},
-
-    {"DOWNARROW", HID_KEYBOARD_DOWN_ARROW},
-    {"DOWN", HID_KEYBOARD_DOWN_ARROW},
-    {"LEFTARROW", HID_KEYBOARD_LEFT_ARROW},
-    {"LEFT", HID_KEYBOARD_LEFT_ARROW},
-    {"RIGHTARROW", HID_KEYBOARD_RIGHT_ARROW},
-    {"RIGHT", HID_KEYBOARD_RIGHT_ARROW},
-    {"UPARROW", HID_KEYBOARD_UP_ARROW},
-    {"UP", HID_KEYBOARD_UP_ARROW},
-
-    {"ENTER", HID_KEYBOARD_RETURN},
+    {"ALT-GUI", KEY_MOD_LEFT_ALT | KEY_MOD_LEFT_GUI},
+    {"ALT-SHIFT", KEY_MOD_LEFT_ALT | KEY_MOD_LEFT_SHIFT},
+    {"APP", HID_KEYBOARD_APPLICATION},
+    {"BACKSPACE", HID_KEYBOARD_DELETE},
     {"BREAK", HID_KEYBOARD_PAUSE},
-    {"PAUSE", HID_KEYBOARD_PAUSE},
     {"CAPSLOCK", HID_KEYBOARD_CAPS_LOCK},
+    {"CONTROL", KEY_MOD_LEFT_CTRL},
+    {"CTRL", KEY_MOD_LEFT_CTRL},
+    {"CTRL-ALT", KEY_MOD_LEFT_CTRL | KEY_MOD_LEFT_ALT},
+    {"CTRL-SHIFT", KEY_MOD_LEFT_CTRL | KEY_MOD_LEFT_SHIFT},
     {"DELETE", HID_KEYBOARD_DELETE_FORWARD},
-    {"BACKSPACE", HID_KEYBOARD_DELETE},
+    {"DOWN", HID_KEYBOARD_DOWN_ARROW},
+    {"DOWNARROW", HID_KEYBOARD_DOWN_ARROW},
     {"END", HID_KEYBOARD_END},
+    {"ENTER", HID_KEYBOARD_RETURN},
     {"ESC", HID_KEYBOARD_ESCAPE},
     {"ESCAPE", HID_KEYBOARD_ESCAPE},
-    {"HOME", HID_KEYBOARD_HOME},
-    {"INSERT", HID_KEYBOARD_INSERT},
-    {"NUMLOCK", HID_KEYPAD_NUMLOCK},
-    {"PAGEUP", HID_KEYBOARD_PAGE_UP},
-    {"PAGEDOWN", HID_KEYBOARD_PAGE_DOWN},
-    {"PRINTSCREEN", HID_KEYBOARD_PRINT_SCREEN},
-    {"SCROLLLOCK", HID_KEYBOARD_SCROLL_LOCK},
-    {"SPACE", HID_KEYBOARD_SPACEBAR},
-    {"TAB", HID_KEYBOARD_TAB},
-    {"MENU", HID_KEYBOARD_APPLICATION},
-    {"APP", HID_KEYBOARD_APPLICATION},
-
     {"F1", HID_KEYBOARD_F1},
+    {"F10", HID_KEYBOARD_F10},
+    {"F11", HID_KEYBOARD_F11},
+    {"F12", HID_KEYBOARD_F12},
     {"F2", HID_KEYBOARD_F2},
     {"F3", HID_KEYBOARD_F3},
     {"F4", HID_KEYBOARD_F4},
@@ -61,17 +39,47 @@ static const DuckyKey ducky_keys[] = {
     {"F7", HID_KEYBOARD_F7},
     {"F8", HID_KEYBOARD_F8},
     {"F9", HID_KEYBOARD_F9},
-    {"F10", HID_KEYBOARD_F10},
-    {"F11", HID_KEYBOARD_F11},
-    {"F12", HID_KEYBOARD_F12},
+    {"GUI", KEY_MOD_LEFT_GUI},
+    {"GUI-CTRL", KEY_MOD_LEFT_GUI | KEY_MOD_LEFT_CTRL},
+    {"GUI-SHIFT", KEY_MOD_LEFT_GUI | KEY_MOD_LEFT_SHIFT},
+    {"HOME", HID_KEYBOARD_HOME},
+    {"INSERT", HID_KEYBOARD_INSERT},
+    {"LEFT", HID_KEYBOARD_LEFT_ARROW},
+    {"LEFTARROW", HID_KEYBOARD_LEFT_ARROW},
+    {"MENU", HID_KEYBOARD_APPLICATION},
+    {"NUMLOCK", HID_KEYPAD_NUMLOCK},
+    {"PAGEDOWN", HID_KEYBOARD_PAGE_DOWN},
+    {"PAGEUP", HID_KEYBOARD_PAGE_UP},
+    {"PAUSE", HID_KEYBOARD_PAUSE},
+    {"PRINTSCREEN", HID_KEYBOARD_PRINT_SCREEN},
+    {"RIGHT", HID_KEYBOARD_RIGHT_ARROW},
+    {"RIGHTARROW", HID_KEYBOARD_RIGHT_ARROW},
+    {"SCROLLLOCK", HID_KEYBOARD_SCROLL_LOCK},
+    {"SHIFT", KEY_MOD_LEFT_SHIFT},
+    {"SPACE", HID_KEYBOARD_SPACEBAR},
+    {"TAB", HID_KEYBOARD_TAB},
+    {"UP", HID_KEYBOARD_UP_ARROW},
+    {"UPARROW", HID_KEYBOARD_UP_ARROW},
+    {"WINDOWS", KEY_MOD_LEFT_GUI},
 };
 
 uint16_t ducky_get_keycode_by_name(const char* param) {
-    for(size_t i = 0; i < COUNT_OF(ducky_keys); i++) {
-        size_t key_cmd_len = strlen(ducky_keys[i].name);
-        if((strncmp(param, ducky_keys[i].name, key_cmd_len) == 0) &&
-           (ducky_is_line_end(param[key_cmd_len]))) {
-            return ducky_keys[i].keycode;
+    size_t key_word_len = 0;
+    while(!ducky_is_line_end(param[key_word_len])) {
+        key_word_len++;
+    }
+
+    size_t low = 0;
+    size_t high = COUNT_OF(ducky_keys);
+    while(low < high) {
+        size_t mid = (low + high) / 2;
+        int cmp = ducky_word_cmp(param, key_word_len, ducky_keys[mid].name);
+        if(cmp == 0) {
+            return ducky_keys[mid].keycode;
+        } else if(cmp < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
         }
     }
 
@@ -20,6 +20,15 @@ typedef struct {
     uint8_t anim_frame;
 } BadUsbModel;
 
+static void bad_usb_draw_cps(Canvas* canvas, FuriString* disp_str, uint32_t cps) {
+    if(cps == 0) return;
+    canvas_set_font(canvas, FontSecondary);
+    furi_string_printf(disp_str, "%lu cps", cps);
+    canvas_draw_str_aligned(
+        canvas, 127, 50, AlignRight, AlignBottom, furi_string_get_cstr(disp_str));
+    furi_string_reset(disp_str);
+}
+
 static void bad_usb_draw_callback(Canvas* canvas, void* _model) {
     BadUsbModel* model = _model;
 
@@ -110,12 +119,14 @@ static void bad_usb_draw_callback(Canvas* canvas, void* _model) {
             canvas, 114, 40, AlignRight, AlignBottom, furi_string_get_cstr(disp_str));
         furi_string_reset(disp_str);
         canvas_draw_icon(canvas, 117, 26, &I_Percent_10x14);
+        bad_usb_draw_cps(canvas, disp_str, model->state.cps);
     } else if(state == BadUsbStateDone) {
         canvas_draw_icon(canvas, 4, 23, &I_EviSmile1_18x21);
         canvas_set_font(canvas, FontBigNumbers);
         canvas_draw_str_aligned(canvas, 114, 40, AlignRight, AlignBottom, "100");
         furi_string_reset(disp_str);
         canvas_draw_icon(canvas, 117, 26, &I_Percent_10x14);
+        bad_usb_draw_cps(canvas, disp_str, model->state.cps);
     } else if(state == BadUsbStateDelay) {
         if(model->anim_frame == 0) {
             canvas_draw_icon(canvas, 4, 23, &I_EviWaiting1_18x21);
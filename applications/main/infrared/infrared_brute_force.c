@@ -2,13 +2,83 @@
 
 #include <stdlib.h>
 #include <m-dict.h>
+#include <m-array.h>
 #include <flipper_format/flipper_format.h>
+#include <toolbox/stream/buffered_file_stream.h>
+#include <toolbox/crc32_calc.h>
+#include <infrared_worker.h>
 
 #include "infrared_signal.h"
 
+#define TAG "InfraredBruteForce"
+
+#define INFRARED_BRUTE_FORCE_INDEX_EXTENSION ".idx"
+#define INFRARED_BRUTE_FORCE_INDEX_MAGIC (0x58445249U) // "IRDX"
+#define INFRARED_BRUTE_FORCE_INDEX_VERSION (1U)
+#define INFRARED_BRUTE_FORCE_INDEX_BUFFER_SIZE (512U)
+#define INFRARED_BRUTE_FORCE_INDEX_NAMES_SIZE_MAX (4096U)
+#define INFRARED_BRUTE_FORCE_INDEX_SOURCES_MIN (64U)
+#define INFRARED_BRUTE_FORCE_INDEX_HEAP_RESERVE (4096U)
+
+/*
+ * Index file layout:
+ * - InfraredBruteForceIndexHeader
+ * - names_count InfraredBruteForceIndexName, each followed by name_size chars
+ * - decoded signals grouped by name, InfraredBruteForceIndexSignal each,
+ *   raw signals are followed by timings_size timings
+ */
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t reserved[3];
+    uint32_t source_size;
+    uint32_t source_crc;
+    uint32_t names_count;
+    uint32_t names_size;
+    uint32_t names_crc;
+    uint32_t signals_size;
+} FURI_PACKED InfraredBruteForceIndexHeader;
+
+typedef struct {
+    uint32_t signals_offset;
+    uint32_t signals_count;
+    uint8_t name_size;
+} FURI_PACKED InfraredBruteForceIndexName;
+
+typedef enum {
+    InfraredBruteForceIndexSignalTypeMessage,
+    InfraredBruteForceIndexSignalTypeRaw,
+} InfraredBruteForceIndexSignalType;
+
+typedef struct {
+    uint32_t type;
+    union {
+        struct {
+            uint32_t protocol;
+            uint32_t address;
+            uint32_t command;
+        } message;
+        struct {
+            uint32_t frequency;
+            float duty_cycle;
+            uint32_t timings_size;
+        } raw;
+    } payload;
+} FURI_PACKED InfraredBruteForceIndexSignal;
+
+typedef struct {
+    uint32_t offset;
+    uint32_t name_index;
+} InfraredBruteForceIndexSource;
+
+ARRAY_DEF(InfraredBruteForceNameArray, FuriString*, FURI_STRING_OPLIST); //-V575
+ARRAY_DEF(InfraredBruteForceSourceArray, InfraredBruteForceIndexSource, M_POD_OPLIST); //-V658
+DICT_DEF2(InfraredBruteForceNameDict, FuriString*, FURI_STRING_OPLIST, uint32_t, M_POD_OPLIST);
+
 typedef struct {
     uint32_t index;
     uint32_t count;
+    uint32_t offset; /**< First signal in the index file */
 } InfraredBruteForceRecord;
 
 DICT_DEF2(
@@ -20,19 +90,27 @@ DICT_DEF2(
 
 struct InfraredBruteForce {
     FlipperFormat* ff;
+    Stream* index_stream;
     const char* db_filename;
+    FuriString* index_filename;
     FuriString* current_record_name;
     InfraredSignal* current_signal;
     InfraredBruteForceRecordDict_t records;
+    uint32_t signals_left;
+    bool has_index;
     bool is_started;
 };
 
 InfraredBruteForce* infrared_brute_force_alloc(void) {
     InfraredBruteForce* brute_force = malloc(sizeof(InfraredBruteForce));
     brute_force->ff = NULL;
+    brute_force->index_stream = NULL;
     brute_force->db_filename = NULL;
     brute_force->current_signal = NULL;
+    brute_force->signals_left = 0;
+    brute_force->has_index = false;
     brute_force->is_started = false;
+    brute_force->index_filename = furi_string_alloc();
     brute_force->current_record_name = furi_string_alloc();
     InfraredBruteForceRecordDict_init(brute_force->records);
     return brute_force;
@@ -42,24 +120,364 @@ void infrared_brute_force_free(InfraredBruteForce* brute_force) {
     furi_assert(!brute_force->is_started);
     InfraredBruteForceRecordDict_clear(brute_force->records);
     furi_string_free(brute_force->current_record_name);
+    furi_string_free(brute_force->index_filename);
     free(brute_force);
 }
 
 void infrared_brute_force_set_db_filename(InfraredBruteForce* brute_force, const char* db_filename) {
     furi_assert(!brute_force->is_started);
     brute_force->db_filename = db_filename;
+    brute_force->has_index = false;
 }
 
-bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
-    furi_assert(!brute_force->is_started);
-    furi_assert(brute_force->db_filename);
+static uint32_t infrared_brute_force_stream_crc(Stream* stream, size_t size) {
+    uint8_t* buffer = malloc(INFRARED_BRUTE_FORCE_INDEX_BUFFER_SIZE);
+    uint32_t crc = 0;
+
+    while(size > 0) {
+        size_t to_read = MIN(size, INFRARED_BRUTE_FORCE_INDEX_BUFFER_SIZE);
+        size_t was_read = stream_read(stream, buffer, to_read);
+        crc = crc32_calc_buffer(crc, buffer, was_read);
+        if(was_read != to_read) break;
+        size -= was_read;
+    }
+
+    free(buffer);
+    return crc;
+}
+
+static bool infrared_brute_force_source_crc(
+    InfraredBruteForce* brute_force,
+    Storage* storage,
+    uint32_t* size,
+    uint32_t* crc) {
+    Stream* stream = buffered_file_stream_alloc(storage);
+    bool success = false;
+
+    if(buffered_file_stream_open(
+           stream, brute_force->db_filename, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        *size = stream_size(stream);
+        *crc = infrared_brute_force_stream_crc(stream, *size);
+        success = true;
+    }
+
+    buffered_file_stream_close(stream);
+    stream_free(stream);
+    return success;
+}
+
+static void infrared_brute_force_reset_counts(InfraredBruteForce* brute_force) {
+    InfraredBruteForceRecordDict_it_t it;
+    for(InfraredBruteForceRecordDict_it(it, brute_force->records);
+        !InfraredBruteForceRecordDict_end_p(it);
+        InfraredBruteForceRecordDict_next(it)) {
+        InfraredBruteForceRecordDict_itref_t* record = InfraredBruteForceRecordDict_ref(it);
+        record->value.count = 0;
+        record->value.offset = 0;
+    }
+}
+
+static bool infrared_brute_force_index_load(
+    InfraredBruteForce* brute_force,
+    Storage* storage,
+    uint32_t source_size,
+    uint32_t source_crc) {
+    Stream* stream = buffered_file_stream_alloc(storage);
+    FuriString* signal_name = furi_string_alloc();
+    uint8_t* names = NULL;
+    bool index_loaded = false;
+
+    do {
+        if(!buffered_file_stream_open(
+               stream,
+               furi_string_get_cstr(brute_force->index_filename),
+               FSAM_READ,
+               FSOM_OPEN_EXISTING))
+            break;
+
+        InfraredBruteForceIndexHeader header;
+        if(stream_read(stream, (uint8_t*)&header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != INFRARED_BRUTE_FORCE_INDEX_MAGIC ||
+           header.version != INFRARED_BRUTE_FORCE_INDEX_VERSION || header.names_count == 0 ||
+           header.names_size > INFRARED_BRUTE_FORCE_INDEX_NAMES_SIZE_MAX)
+            break;
+        if(stream_size(stream) != sizeof(header) + header.names_size + header.signals_size)
+            break;
+
+        // Index is only valid for the exact database it was built from
+        if(header.source_size != source_size || header.source_crc != source_crc) break;
+
+        names = malloc(header.names_size);
+        if(stream_read(stream, names, header.names_size) != header.names_size) break;
+        if(crc32_calc_buffer(0, names, header.names_size) != header.names_crc) break;
+
+        infrared_brute_force_reset_counts(brute_force);
+
+        size_t offset = 0;
+        size_t names_read = 0;
+        for(; names_read < header.names_count; names_read++) {
+            InfraredBruteForceIndexName name;
+            if(offset + sizeof(name) > header.names_size) break;
+            memcpy(&name, &names[offset], sizeof(name));
+            offset += sizeof(name);
+            if(offset + name.name_size > header.names_size) break;
+            furi_string_set_strn(signal_name, (const char*)&names[offset], name.name_size);
+            offset += name.name_size;
+
+            InfraredBruteForceRecord* record =
+                InfraredBruteForceRecordDict_get(brute_force->records, signal_name);
+            if(record) {
+                record->count = name.signals_count;
+                record->offset = name.signals_offset;
+            }
+        }
+
+        index_loaded = (names_read == header.names_count) && (offset == header.names_size);
+        if(!index_loaded) infrared_brute_force_reset_counts(brute_force);
+    } while(false);
+
+    free(names);
+    furi_string_free(signal_name);
+    buffered_file_stream_close(stream);
+    stream_free(stream);
+
+    return index_loaded;
+}
+
+static bool infrared_brute_force_index_write_names(
+    Stream* stream,
+    InfraredBruteForceNameArray_t names,
+    const InfraredBruteForceIndexName* entries,
+    uint32_t* crc) {
+    bool success = true;
+
+    for(size_t i = 0; success && i < InfraredBruteForceNameArray_size(names); i++) {
+        const FuriString* name = *InfraredBruteForceNameArray_cget(names, i);
+        success = (stream_write(stream, (const uint8_t*)&entries[i], sizeof(entries[i])) ==
+                   sizeof(entries[i])) &&
+                  (stream_write(
+                       stream, (const uint8_t*)furi_string_get_cstr(name), entries[i].name_size) ==
+                   entries[i].name_size);
+        *crc = crc32_calc_buffer(*crc, &entries[i], sizeof(entries[i]));
+        *crc = crc32_calc_buffer(*crc, furi_string_get_cstr(name), entries[i].name_size);
+    }
+
+    return success;
+}
+
+static bool
+    infrared_brute_force_index_write_signal(Stream* stream, const InfraredSignal* signal) {
+    InfraredBruteForceIndexSignal entry = {0};
+    const uint32_t* timings = NULL;
+
+    if(infrared_signal_is_raw(signal)) {
+        const InfraredRawSignal* raw = infrared_signal_get_raw_signal(signal);
+        entry.type = InfraredBruteForceIndexSignalTypeRaw;
+        entry.payload.raw.frequency = raw->frequency;
+        entry.payload.raw.duty_cycle = raw->duty_cycle;
+        entry.payload.raw.timings_size = raw->timings_size;
+        timings = raw->timings;
+    } else {
+        const InfraredMessage* message = infrared_signal_get_message(signal);
+        entry.type = InfraredBruteForceIndexSignalTypeMessage;
+        entry.payload.message.protocol = message->protocol;
+        entry.payload.message.address = message->address;
+        entry.payload.message.command = message->command;
+    }
+
+    bool success = stream_write(stream, (const uint8_t*)&entry, sizeof(entry)) == sizeof(entry);
+    if(success && timings) {
+        size_t timings_size = entry.payload.raw.timings_size * sizeof(uint32_t);
+        success = stream_write(stream, (const uint8_t*)timings, timings_size) == timings_size;
+    }
+
+    return success;
+}
+
+static int infrared_brute_force_index_source_cmp(const void* a, const void* b) {
+    const InfraredBruteForceIndexSource* source_a = a;
+    const InfraredBruteForceIndexSource* source_b = b;
+    if(source_a->name_index != source_b->name_index) {
+        return source_a->name_index < source_b->name_index ? -1 : 1;
+    }
+    return source_a->offset < source_b->offset ? -1 : (source_a->offset > source_b->offset);
+}
+
+// Index is optional, never let it exhaust the heap: malloc failure is fatal
+static bool infrared_brute_force_index_push_source(
+    InfraredBruteForceSourceArray_t sources,
+    size_t* sources_reserved,
+    const InfraredBruteForceIndexSource* source_signal) {
+    size_t sources_count = InfraredBruteForceSourceArray_size(sources);
+    if(sources_count == *sources_reserved) {
+        size_t reserved = MAX(sources_count * 2, INFRARED_BRUTE_FORCE_INDEX_SOURCES_MIN);
+        if(memmgr_heap_get_max_free_block() <
+           reserved * sizeof(InfraredBruteForceIndexSource) +
+               INFRARED_BRUTE_FORCE_INDEX_HEAP_RESERVE) {
+            FURI_LOG_W(TAG, "Not enough memory to index %zu signals", reserved);
+            return false;
+        }
+        InfraredBruteForceSourceArray_reserve(sources, reserved);
+        *sources_reserved = reserved;
+    }
+
+    InfraredBruteForceSourceArray_push_back(sources, *source_signal);
+    return true;
+}
+
+static bool infrared_brute_force_index_build(
+    InfraredBruteForce* brute_force,
+    Storage* storage,
+    uint32_t source_size,
+    uint32_t source_crc) {
+    FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    Stream* index_stream = buffered_file_stream_alloc(storage);
+    InfraredSignal* signal = infrared_signal_alloc();
+    FuriString* signal_name = furi_string_alloc();
+    InfraredBruteForceIndexName* entries = NULL;
+    bool index_built = false;
+
+    InfraredBruteForceNameArray_t names;
+    InfraredBruteForceNameArray_init(names);
+    InfraredBruteForceNameDict_t name_indexes;
+    InfraredBruteForceNameDict_init(name_indexes);
+    InfraredBruteForceSourceArray_t sources;
+    InfraredBruteForceSourceArray_init(sources);
+    size_t sources_reserved = 0;
+
+    InfraredBruteForceIndexHeader header = {
+        .magic = INFRARED_BRUTE_FORCE_INDEX_MAGIC,
+        .version = INFRARED_BRUTE_FORCE_INDEX_VERSION,
+        .source_size = source_size,
+        .source_crc = source_crc,
+    };
+
+    do {
+        if(!flipper_format_buffered_file_open_existing(ff, brute_force->db_filename)) break;
+        Stream* source = flipper_format_get_raw_stream(ff);
+        if(stream_size(source) != source_size) break;
+
+        // Only names are parsed here, bodies are decoded below grouped by name
+        bool sources_valid = true;
+        while(sources_valid && infrared_signal_read_name(ff, signal_name)) {
+            uint32_t* name_index = InfraredBruteForceNameDict_get(name_indexes, signal_name);
+            InfraredBruteForceIndexSource source_signal = {
+                .offset = stream_tell(source),
+                .name_index = name_index ? *name_index : InfraredBruteForceNameArray_size(names),
+            };
+
+            if(!name_index) {
+                header.names_size +=
+                    sizeof(InfraredBruteForceIndexName) + furi_string_size(signal_name);
+                sources_valid = (furi_string_size(signal_name) <= UINT8_MAX) &&
+                                (header.names_size <= INFRARED_BRUTE_FORCE_INDEX_NAMES_SIZE_MAX);
+                if(!sources_valid) break;
+                InfraredBruteForceNameDict_set_at(
+                    name_indexes, signal_name, source_signal.name_index);
+                InfraredBruteForceNameArray_push_back(names, signal_name);
+            }
+
+            sources_valid =
+                infrared_brute_force_index_push_source(sources, &sources_reserved, &source_signal);
+        }
+        if(!sources_valid) break;
+        if(InfraredBruteForceSourceArray_size(sources) == 0) break;
+
+        // Group signals by name, keeping the database order within a name
+        const size_t sources_count = InfraredBruteForceSourceArray_size(sources);
+        qsort(
+            InfraredBruteForceSourceArray_get(sources, 0),
+            sources_count,
+            sizeof(InfraredBruteForceIndexSource),
+            infrared_brute_force_index_source_cmp);
+
+        header.names_count = InfraredBruteForceNameArray_size(names);
+        entries = malloc(sizeof(InfraredBruteForceIndexName) * header.names_count);
+        for(size_t i = 0; i < header.names_count; i++) {
+            entries[i].name_size =
+                furi_string_size(*InfraredBruteForceNameArray_cget(names, i));
+            entries[i].signals_offset = 0;
+            entries[i].signals_count = 0;
+        }
+
+        if(!buffered_file_stream_open(
+               index_stream,
+               furi_string_get_cstr(brute_force->index_filename),
+               FSAM_READ_WRITE,
+               FSOM_CREATE_ALWAYS))
+            break;
+
+        // Header and names are rewritten once signal offsets are known
+        uint32_t names_crc = 0;
+        if(stream_write(index_stream, (uint8_t*)&header, sizeof(header)) != sizeof(header))
+            break;
+        if(!infrared_brute_force_index_write_names(index_stream, names, entries, &names_crc))
+            break;
+
+        bool signals_valid = true;
+        for(size_t i = 0; signals_valid && i < sources_count; i++) {
+            const InfraredBruteForceIndexSource* source_signal =
+                InfraredBruteForceSourceArray_cget(sources, i);
+            InfraredBruteForceIndexName* entry = &entries[source_signal->name_index];
+            if(entry->signals_count == 0) {
+                entry->signals_offset = stream_tell(index_stream);
+            }
+
+            signals_valid = stream_seek(source, source_signal->offset, StreamOffsetFromStart) &&
+                            infrared_signal_read_body(signal, ff) &&
+                            infrared_signal_is_valid(signal) &&
+                            infrared_brute_force_index_write_signal(index_stream, signal);
+            entry->signals_count++;
+        }
+        if(!signals_valid) break;
+
+        header.signals_size = stream_tell(index_stream) - sizeof(header) - header.names_size;
+        if(!stream_seek(index_stream, sizeof(header), StreamOffsetFromStart)) break;
+        names_crc = 0;
+        if(!infrared_brute_force_index_write_names(index_stream, names, entries, &names_crc))
+            break;
+        header.names_crc = names_crc;
+        if(!stream_rewind(index_stream)) break;
+        if(stream_write(index_stream, (uint8_t*)&header, sizeof(header)) != sizeof(header))
+            break;
+
+        index_built = buffered_file_stream_sync(index_stream) &&
+                      (buffered_file_stream_get_error(index_stream) == FSE_OK);
+    } while(false);
+
+    buffered_file_stream_close(index_stream);
+    stream_free(index_stream);
+
+    if(index_built) {
+        FURI_LOG_I(
+            TAG,
+            "Built index with %zu signals",
+            InfraredBruteForceSourceArray_size(sources));
+    } else {
+        FURI_LOG_W(TAG, "Failed to build index");
+        storage_simply_remove(storage, furi_string_get_cstr(brute_force->index_filename));
+    }
+
+    free(entries);
+    InfraredBruteForceSourceArray_clear(sources);
+    InfraredBruteForceNameDict_clear(name_indexes);
+    InfraredBruteForceNameArray_clear(names);
+    furi_string_free(signal_name);
+    infrared_signal_free(signal);
+    flipper_format_free(ff);
+
+    return index_built;
+}
+
+static bool infrared_brute_force_count_signals(InfraredBruteForce* brute_force, Storage* storage) {
     bool success = false;
 
-    Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
     FuriString* signal_name = furi_string_alloc();
     InfraredSignal* signal = infrared_signal_alloc();
 
+    infrared_brute_force_reset_counts(brute_force);
+
     do {
         if(!flipper_format_buffered_file_open_existing(ff, brute_force->db_filename)) break;
 
@@ -84,6 +502,34 @@ bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
     furi_string_free(signal_name);
 
     flipper_format_free(ff);
+    return success;
+}
+
+bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
+    furi_assert(!brute_force->is_started);
+    furi_assert(brute_force->db_filename);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    furi_string_printf(
+        brute_force->index_filename,
+        "%s%s",
+        brute_force->db_filename,
+        INFRARED_BRUTE_FORCE_INDEX_EXTENSION);
+
+    // Database is parsed once to build the index, signals are read from the index afterwards
+    uint32_t source_size = 0;
+    uint32_t source_crc = 0;
+    brute_force->has_index = false;
+    if(infrared_brute_force_source_crc(brute_force, storage, &source_size, &source_crc)) {
+        brute_force->has_index =
+            infrared_brute_force_index_load(brute_force, storage, source_size, source_crc) ||
+            (infrared_brute_force_index_build(brute_force, storage, source_size, source_crc) &&
+             infrared_brute_force_index_load(brute_force, storage, source_size, source_crc));
+    }
+
+    const bool success = brute_force->has_index ||
+                         infrared_brute_force_count_signals(brute_force, storage);
+
     furi_record_close(RECORD_STORAGE);
     return success;
 }
@@ -94,6 +540,7 @@ bool infrared_brute_force_start(
     uint32_t* record_count) {
     furi_assert(!brute_force->is_started);
     bool success = false;
+    uint32_t record_offset = 0;
     *record_count = 0;
 
     InfraredBruteForceRecordDict_it_t it;
@@ -103,6 +550,7 @@ bool infrared_brute_force_start(
         const InfraredBruteForceRecordDict_itref_t* record = InfraredBruteForceRecordDict_cref(it);
         if(record->value.index == index) {
             *record_count = record->value.count;
+            record_offset = record->value.offset;
             if(*record_count) {
                 furi_string_set(brute_force->current_record_name, record->key);
             }
@@ -112,11 +560,23 @@ bool infrared_brute_force_start(
 
     if(*record_count) {
         Storage* storage = furi_record_open(RECORD_STORAGE);
-        brute_force->ff = flipper_format_buffered_file_alloc(storage);
         brute_force->current_signal = infrared_signal_alloc();
         brute_force->is_started = true;
-        success =
-            flipper_format_buffered_file_open_existing(brute_force->ff, brute_force->db_filename);
+        if(brute_force->has_index) {
+            brute_force->index_stream = buffered_file_stream_alloc(storage);
+            brute_force->signals_left = *record_count;
+            success = buffered_file_stream_open(
+                          brute_force->index_stream,
+                          furi_string_get_cstr(brute_force->index_filename),
+                          FSAM_READ,
+                          FSOM_OPEN_EXISTING) &&
+                      stream_seek(
+                          brute_force->index_stream, record_offset, StreamOffsetFromStart);
+        } else {
+            brute_force->ff = flipper_format_buffered_file_alloc(storage);
+            success = flipper_format_buffered_file_open_existing(
+                brute_force->ff, brute_force->db_filename);
+        }
         if(!success) infrared_brute_force_stop(brute_force);
     }
     return success;
@@ -130,19 +590,81 @@ void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
     furi_string_reset(brute_force->current_record_name);
     infrared_signal_free(brute_force->current_signal);
-    flipper_format_free(brute_force->ff);
+    if(brute_force->index_stream) {
+        buffered_file_stream_close(brute_force->index_stream);
+        stream_free(brute_force->index_stream);
+    }
+    if(brute_force->ff) {
+        flipper_format_free(brute_force->ff);
+    }
     brute_force->current_signal = NULL;
+    brute_force->index_stream = NULL;
     brute_force->ff = NULL;
+    brute_force->signals_left = 0;
     brute_force->is_started = false;
     furi_record_close(RECORD_STORAGE);
 }
 
+static bool infrared_brute_force_index_read_signal(Stream* stream, InfraredSignal* signal) {
+    InfraredBruteForceIndexSignal entry;
+    bool success = false;
+
+    do {
+        if(stream_read(stream, (uint8_t*)&entry, sizeof(entry)) != sizeof(entry)) break;
+
+        if(entry.type == InfraredBruteForceIndexSignalTypeMessage) {
+            InfraredMessage message = {
+                .protocol = (InfraredProtocol)entry.payload.message.protocol,
+                .address = entry.payload.message.address,
+                .command = entry.payload.message.command,
+                .repeat = false,
+            };
+            infrared_signal_set_message(signal, &message);
+        } else if(entry.type == InfraredBruteForceIndexSignalTypeRaw) {
+            const size_t timings_size = entry.payload.raw.timings_size;
+            if(timings_size == 0 || timings_size > MAX_TIMINGS_AMOUNT) break;
+
+            uint32_t* timings = malloc(timings_size * sizeof(uint32_t));
+            const bool timings_read =
+                stream_read(stream, (uint8_t*)timings, timings_size * sizeof(uint32_t)) ==
+                timings_size * sizeof(uint32_t);
+            if(timings_read) {
+                infrared_signal_set_raw_signal(
+                    signal,
+                    timings,
+                    timings_size,
+                    entry.payload.raw.frequency,
+                    entry.payload.raw.duty_cycle);
+            }
+            free(timings);
+            if(!timings_read) break;
+        } else {
+            break;
+        }
+
+        success = infrared_signal_is_valid(signal);
+    } while(false);
+
+    return success;
+}
+
 bool infrared_brute_force_send_next(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
-    const bool success = infrared_signal_search_by_name_and_read(
-        brute_force->current_signal,
-        brute_force->ff,
-        furi_string_get_cstr(brute_force->current_record_name));
+    bool success = false;
+
+    if(brute_force->index_stream) {
+        if(brute_force->signals_left) {
+            brute_force->signals_left--;
+            success = infrared_brute_force_index_read_signal(
+                brute_force->index_stream, brute_force->current_signal);
+        }
+    } else {
+        success = infrared_signal_search_by_name_and_read(
+            brute_force->current_signal,
+            brute_force->ff,
+            furi_string_get_cstr(brute_force->current_record_name));
+    }
+
     if(success) {
         infrared_signal_transmit(brute_force->current_signal);
     }
@@ -44,6 +44,12 @@ void infrared_brute_force_set_db_filename(InfraredBruteForce* brute_force, const
  * This function must be called each time after setting the database via
  * a infrared_brute_force_set_db_filename() call.
  *
+ * Signals are decoded once into a binary index next to the database file
+ * (the database path with ".idx" appended), which is rebuilt whenever the
+ * database changes. Transmission then reads the signals from the index.
+ * If the index can't be built, e.g. when memory is low, signals are read
+ * from the database directly.
+ *
  * @param[in,out] brute_force pointer to the instance to be updated.
  * @returns true on success, false otherwise.
  */
@@ -2,12 +2,15 @@
 
 #include <furi/furi.h>
 #include <storage/storage.h>
+#include <nfc/helpers/nfc_packed_data.h>
 
 #define NFC_APP_KEYS_EXTENSION ".keys"
 #define NFC_APP_KEY_CACHE_FOLDER "/ext/nfc/.cache"
 
 static const char* mf_classic_key_cache_file_header = "Flipper NFC keys";
 static const uint32_t mf_classic_key_cache_file_version = 1;
+// Keys are saved as two packed arrays in this version, only supported on load
+static const uint32_t mf_classic_key_cache_file_version_packed = 2;
 
 struct MfClassicKeyCache {
     MfClassicDeviceKeys keys;
@@ -110,11 +113,23 @@ bool mf_classic_key_cache_load(MfClassicKeyCache* instance, const uint8_t* uid,
         uint32_t version = 0;
         if(!flipper_format_read_header(ff, temp_str, &version)) break;
         if(furi_string_cmp_str(temp_str, mf_classic_key_cache_file_header)) break;
-        if(version != mf_classic_key_cache_file_version) break;
+        if((version != mf_classic_key_cache_file_version) &&
+           (version != mf_classic_key_cache_file_version_packed))
+            break;
 
         if(!flipper_format_read_hex_uint64(ff, "Key A map", &instance->keys.key_a_mask, 1)) break;
         if(!flipper_format_read_hex_uint64(ff, "Key B map", &instance->keys.key_b_mask, 1)) break;
 
+        if(version == mf_classic_key_cache_file_version_packed) {
+            MfClassicDeviceKeys* keys = &instance->keys;
+            if(!nfc_packed_data_read(ff, "Key A", (uint8_t*)keys->key_a, sizeof(keys->key_a)))
+                break;
+            if(!nfc_packed_data_read(ff, "Key B", (uint8_t*)keys->key_b, sizeof(keys->key_b)))
+                break;
+            load_success = true;
+            break;
+        }
+
         bool key_read_success = true;
         for(size_t i = 0; (i < MF_CLASSIC_TOTAL_SECTORS_MAX) && (key_read_success); i++) {
             if(FURI_BIT(instance->keys.key_a_mask, i)) {
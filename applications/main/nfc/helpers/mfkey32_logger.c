@@ -2,6 +2,7 @@
 
 #include <m-array.h>
 
+#include <nfc/protocols/mf_classic/crypto1_batch.h>
 #include <bit_lib/bit_lib.h>
 #include <stream/stream.h>
 #include <stream/buffered_file_stream.h>
@@ -19,6 +20,8 @@ typedef struct {
     uint32_t nt1;
     uint32_t nr1;
     uint32_t ar1;
+    bool is_key_found;
+    uint64_t key;
 } Mfkey32LoggerParams;
 
 ARRAY_DEF(Mfkey32LoggerParams, Mfkey32LoggerParams, M_POD_OPLIST);
@@ -105,6 +108,71 @@ size_t mfkey32_logger_get_params_num(Mfkey32Logger* instance) {
     return instance->params_collected;
 }
 
+static bool mfkey32_logger_check_params_keys(
+    Mfkey32LoggerParams* params,
+    const uint64_t* keys,
+    size_t keys_num) {
+    size_t matches[CRYPTO1_BATCH_SIZE];
+    size_t matches_num = crypto1_batch_check_reader_auth(
+        keys,
+        keys_num,
+        params->cuid,
+        params->nt0,
+        params->nr0,
+        params->ar0,
+        matches,
+        COUNT_OF(matches));
+
+    // Second nonce pair rules out false positives of the first one
+    for(size_t i = 0; i < matches_num; i++) {
+        size_t match = 0;
+        const uint64_t* key = &keys[matches[i]];
+        if(crypto1_batch_check_reader_auth(
+               key, 1, params->cuid, params->nt1, params->nr1, params->ar1, &match, 1)) {
+            params->key = *key;
+            params->is_key_found = true;
+            break;
+        }
+    }
+
+    return params->is_key_found;
+}
+
+size_t mfkey32_logger_check_dict(Mfkey32Logger* instance, KeysDict* dict) {
+    furi_assert(instance);
+    furi_assert(dict);
+
+    uint64_t keys[CRYPTO1_BATCH_SIZE];
+    MfClassicKey key = {};
+    size_t keys_found = 0;
+    bool dict_end = !keys_dict_rewind(dict);
+
+    while(!dict_end) {
+        size_t keys_num = 0;
+        while(keys_num < COUNT_OF(keys)) {
+            if(!keys_dict_get_next_key(dict, key.data, sizeof(MfClassicKey))) {
+                dict_end = true;
+                break;
+            }
+            keys[keys_num++] = bit_lib_bytes_to_num_be(key.data, sizeof(MfClassicKey));
+        }
+        if(keys_num == 0) break;
+
+        Mfkey32LoggerParams_it_t it;
+        for(Mfkey32LoggerParams_it(it, instance->params_arr); !Mfkey32LoggerParams_end_p(it);
+            Mfkey32LoggerParams_next(it)) {
+            Mfkey32LoggerParams* params = Mfkey32LoggerParams_ref(it);
+            if(!params->is_filled || params->is_key_found) continue;
+
+            if(mfkey32_logger_check_params_keys(params, keys, keys_num)) {
+                keys_found++;
+            }
+        }
+    }
+
+    return keys_found;
+}
+
 bool mfkey32_logger_save_params(Mfkey32Logger* instance, const char* path) {
     furi_assert(instance);
     furi_assert(path);
@@ -168,6 +236,10 @@ void mfkey32_logger_get_params_data(Mfkey32Logger* instance, FuriString* str) {
         if(!params->is_filled) continue;
 
         char key_char = params->key_type == MfClassicKeyTypeA ? 'A' : 'B';
-        furi_string_cat_printf(str, "Sector %d, key %c\n", params->sector_num, key_char);
+        furi_string_cat_printf(str, "Sector %d, key %c", params->sector_num, key_char);
+        if(params->is_key_found) {
+            furi_string_cat_printf(str, ": %012llX", params->key);
+        }
+        furi_string_push_back(str, '\n');
     }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <nfc/protocols/mf_classic/mf_classic.h>
+#include <toolbox/keys_dict.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -16,6 +17,8 @@ void mfkey32_logger_add_nonce(Mfkey32Logger* instance, MfClassicAuthContext* aut
 
 size_t mfkey32_logger_get_params_num(Mfkey32Logger* instance);
 
+size_t mfkey32_logger_check_dict(Mfkey32Logger* instance, KeysDict* dict);
+
 bool mfkey32_logger_save_params(Mfkey32Logger* instance, const char* path);
 
 void mfkey32_logger_get_params_data(Mfkey32Logger* instance, FuriString* str);
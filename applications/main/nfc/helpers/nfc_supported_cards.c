@@ -1,4 +1,5 @@
 #include "nfc_supported_cards.h"
+#include "nfc_supported_cards_cache.h"
 #include "../api/nfc_app_api_interface.h"
 
 #include "../plugins/supported_cards/nfc_supported_card_plugin.h"
@@ -9,28 +10,20 @@
 #include <loader/firmware_api/firmware_api.h>
 
 #include <furi.h>
-#include <path.h>
-#include <m-array.h>
 
 #define TAG "NfcSupportedCards"
 
 #define NFC_SUPPORTED_CARDS_PLUGINS_PATH APP_DATA_PATH("plugins")
 #define NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX "_parser.fal"
 
+#define NFC_SUPPORTED_CARDS_CACHE_PATH APP_DATA_PATH("plugins.cache")
+
 typedef enum {
     NfcSupportedCardsPluginFeatureHasVerify = (1U << 0),
     NfcSupportedCardsPluginFeatureHasRead = (1U << 1),
     NfcSupportedCardsPluginFeatureHasParse = (1U << 2),
 } NfcSupportedCardsPluginFeature;
 
-typedef struct {
-    FuriString* path;
-    NfcProtocol protocol;
-    NfcSupportedCardsPluginFeature feature;
-} NfcSupportedCardsPluginCache;
-
-ARRAY_DEF(NfcSupportedCardsPluginCache, NfcSupportedCardsPluginCache, M_POD_OPLIST);
-
 typedef enum {
     NfcSupportedCardsLoadStateIdle,
     NfcSupportedCardsLoadStateInProgress,
@@ -40,9 +33,6 @@ typedef enum {
 
 typedef struct {
     Storage* storage;
-    File* directory;
-    FuriString* file_path;
-    char file_name[256];
     FlipperApplication* app;
 } NfcSupportedCardsLoadContext;
 
@@ -68,13 +58,7 @@ NfcSupportedCards* nfc_supported_cards_alloc(void) {
 void nfc_supported_cards_free(NfcSupportedCards* instance) {
     furi_assert(instance);
 
-    NfcSupportedCardsPluginCache_it_t iter;
-    for(NfcSupportedCardsPluginCache_it(iter, instance->plugins_cache_arr);
-        !NfcSupportedCardsPluginCache_end_p(iter);
-        NfcSupportedCardsPluginCache_next(iter)) {
-        NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
-        furi_string_free(plugin_cache->path);
-    }
+    nfc_supported_cards_cache_reset(instance->plugins_cache_arr);
     NfcSupportedCardsPluginCache_clear(instance->plugins_cache_arr);
 
     composite_api_resolver_free(instance->api_resolver);
@@ -85,12 +69,6 @@ static NfcSupportedCardsLoadContext* nfc_supported_cards_load_context_alloc(void
     NfcSupportedCardsLoadContext* instance = malloc(sizeof(NfcSupportedCardsLoadContext));
 
     instance->storage = furi_record_open(RECORD_STORAGE);
-    instance->directory = storage_file_alloc(instance->storage);
-    instance->file_path = furi_string_alloc();
-
-    if(!storage_dir_open(instance->directory, NFC_SUPPORTED_CARDS_PLUGINS_PATH)) {
-        FURI_LOG_D(TAG, "Failed to open directory: %s", NFC_SUPPORTED_CARDS_PLUGINS_PATH);
-    }
 
     return instance;
 }
@@ -100,11 +78,6 @@ static void nfc_supported_cards_load_context_free(NfcSupportedCardsLoadContext*
         flipper_application_free(instance->app);
     }
 
-    furi_string_free(instance->file_path);
-
-    storage_dir_close(instance->directory);
-    storage_file_free(instance->directory);
-
     furi_record_close(RECORD_STORAGE);
     free(instance);
 }
@@ -140,27 +113,30 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_plugin(
     return plugin;
 }
 
-static const NfcSupportedCardsPlugin* nfc_supported_cards_get_next_plugin(
-    NfcSupportedCardsLoadContext* instance,
-    const ElfApiInterface* api_interface) {
-    const NfcSupportedCardsPlugin* plugin = NULL;
-
-    do {
-        if(!storage_file_is_open(instance->directory)) break;
-        if(!storage_dir_read(
-               instance->directory, NULL, instance->file_name, sizeof(instance->file_name)))
-            break;
-
-        furi_string_set(instance->file_path, instance->file_name);
-        if(!furi_string_end_with_str(instance->file_path, NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX))
-            continue;
-
-        path_concat(NFC_SUPPORTED_CARDS_PLUGINS_PATH, instance->file_name, instance->file_path);
-
-        plugin = nfc_supported_cards_get_plugin(instance, instance->file_path, api_interface);
-    } while(plugin == NULL); //-V654
+static bool nfc_supported_cards_map_plugin(
+    const FuriString* path,
+    NfcSupportedCardsPluginCache* plugin_cache,
+    void* context) {
+    NfcSupportedCards* instance = context;
+
+    const ElfApiInterface* api_interface = composite_api_resolver_get(instance->api_resolver);
+    const NfcSupportedCardsPlugin* plugin =
+        nfc_supported_cards_get_plugin(instance->load_context, path, api_interface);
+    if(plugin == NULL) return false;
+
+    plugin_cache->protocol = plugin->protocol;
+    plugin_cache->feature = 0;
+    if(plugin->verify) {
+        plugin_cache->feature |= NfcSupportedCardsPluginFeatureHasVerify;
+    }
+    if(plugin->read) {
+        plugin_cache->feature |= NfcSupportedCardsPluginFeatureHasRead;
+    }
+    if(plugin->parse) {
+        plugin_cache->feature |= NfcSupportedCardsPluginFeatureHasParse;
+    }
 
-    return plugin;
+    return true;
 }
 
 void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
@@ -173,27 +149,14 @@ void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
 
         instance->load_context = nfc_supported_cards_load_context_alloc();
 
-        while(true) {
-            const ElfApiInterface* api_interface =
-                composite_api_resolver_get(instance->api_resolver);
-            const NfcSupportedCardsPlugin* plugin =
-                nfc_supported_cards_get_next_plugin(instance->load_context, api_interface);
-            if(plugin == NULL) break; //-V547
-
-            NfcSupportedCardsPluginCache plugin_cache = {}; //-V779
-            plugin_cache.path = furi_string_alloc_set(instance->load_context->file_path);
-            plugin_cache.protocol = plugin->protocol;
-            if(plugin->verify) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasVerify;
-            }
-            if(plugin->read) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasRead;
-            }
-            if(plugin->parse) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasParse;
-            }
-            NfcSupportedCardsPluginCache_push_back(instance->plugins_cache_arr, plugin_cache);
-        }
+        const size_t plugins_mapped = nfc_supported_cards_cache_load(
+            instance->plugins_cache_arr,
+            instance->load_context->storage,
+            NFC_SUPPORTED_CARDS_PLUGINS_PATH,
+            NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX,
+            NFC_SUPPORTED_CARDS_CACHE_PATH,
+            nfc_supported_cards_map_plugin,
+            instance);
 
         nfc_supported_cards_load_context_free(instance->load_context);
 
@@ -202,7 +165,11 @@ void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
             FURI_LOG_D(TAG, "Plugins not found");
             instance->load_state = NfcSupportedCardsLoadStateFail;
         } else {
-            FURI_LOG_D(TAG, "Loaded %zu plugins", plugins_loaded);
+            FURI_LOG_D(
+                TAG,
+                "Loaded %zu plugins, %zu from cache",
+                plugins_loaded,
+                plugins_loaded - plugins_mapped);
             instance->load_state = NfcSupportedCardsLoadStateSuccess;
         }
 
@@ -37,6 +37,9 @@ void nfc_supported_cards_free(NfcSupportedCards* instance);
 /**
  * @brief Load plugins information to cache.
  *
+ * Plugin information is kept in a cache file on the SD card. Only plugins
+ * which are new or changed since the last call are loaded to get it.
+ *
  * @note This function must be called before calling read and parse fanctions.
  *
  * @param[in, out] instance pointer to NfcSupportedCards instance.
@@ -0,0 +1,258 @@
+#include "nfc_supported_cards_cache.h"
+
+#include "../plugins/supported_cards/nfc_supported_card_plugin.h"
+
+#include <furi.h>
+#include <path.h>
+#include <toolbox/crc32_calc.h>
+
+#define TAG "NfcSupportedCardsCache"
+
+#define NFC_SUPPORTED_CARDS_CACHE_MAGIC (0x4350534EU) // "NSPC"
+#define NFC_SUPPORTED_CARDS_CACHE_VERSION (2U)
+#define NFC_SUPPORTED_CARDS_CACHE_PATH_MAX (256U)
+
+/*
+ * Cache file keeps plugin metadata between app launches:
+ * header, then a record and a path for every plugin.
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t plugin_api_version;
+    uint32_t protocol_num;
+    uint32_t count;
+} NfcSupportedCardsCacheHeader;
+
+typedef struct {
+    uint32_t size;
+    uint32_t crc;
+    uint8_t protocol;
+    uint8_t feature;
+    uint16_t path_length;
+} NfcSupportedCardsCacheRecord;
+
+void nfc_supported_cards_cache_reset(NfcSupportedCardsPluginCache_t cache_arr) {
+    NfcSupportedCardsPluginCache_it_t iter;
+    for(NfcSupportedCardsPluginCache_it(iter, cache_arr);
+        !NfcSupportedCardsPluginCache_end_p(iter);
+        NfcSupportedCardsPluginCache_next(iter)) {
+        NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
+        furi_string_free(plugin_cache->path);
+    }
+    NfcSupportedCardsPluginCache_reset(cache_arr);
+}
+
+static bool nfc_supported_cards_cache_file_read(
+    Storage* storage,
+    const char* cache_path,
+    NfcSupportedCardsPluginCache_t cache_arr) {
+    File* file = storage_file_alloc(storage);
+    char* path = malloc(NFC_SUPPORTED_CARDS_CACHE_PATH_MAX);
+    bool success = false;
+
+    do {
+        if(!storage_file_open(file, cache_path, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+
+        NfcSupportedCardsCacheHeader header;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != NFC_SUPPORTED_CARDS_CACHE_MAGIC) break;
+        if(header.version != NFC_SUPPORTED_CARDS_CACHE_VERSION) break;
+        if(header.plugin_api_version != NFC_SUPPORTED_CARD_PLUGIN_API_VERSION) break;
+        if(header.protocol_num != NfcProtocolNum) break;
+
+        uint32_t record_index = 0;
+        for(; record_index < header.count; record_index++) {
+            NfcSupportedCardsCacheRecord record;
+            if(storage_file_read(file, &record, sizeof(record)) != sizeof(record)) break;
+            if(record.path_length >= NFC_SUPPORTED_CARDS_CACHE_PATH_MAX) break;
+            if(record.protocol >= NfcProtocolNum) break;
+            if(storage_file_read(file, path, record.path_length) != record.path_length) break;
+            path[record.path_length] = '\0';
+
+            NfcSupportedCardsPluginCache plugin_cache = {
+                .path = furi_string_alloc_set_str(path),
+                .protocol = record.protocol,
+                .feature = record.feature,
+                .size = record.size,
+                .crc = record.crc,
+            };
+            NfcSupportedCardsPluginCache_push_back(cache_arr, plugin_cache);
+        }
+
+        success = (record_index == header.count);
+    } while(false);
+
+    if(!success) {
+        nfc_supported_cards_cache_reset(cache_arr);
+    }
+
+    free(path);
+    storage_file_free(file);
+
+    return success;
+}
+
+static bool nfc_supported_cards_cache_file_write(
+    Storage* storage,
+    const char* cache_path,
+    const NfcSupportedCardsPluginCache_t cache_arr) {
+    File* file = storage_file_alloc(storage);
+    bool success = false;
+
+    do {
+        if(!storage_file_open(file, cache_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) break;
+
+        NfcSupportedCardsCacheHeader header = {
+            .magic = NFC_SUPPORTED_CARDS_CACHE_MAGIC,
+            .version = NFC_SUPPORTED_CARDS_CACHE_VERSION,
+            .plugin_api_version = NFC_SUPPORTED_CARD_PLUGIN_API_VERSION,
+            .protocol_num = NfcProtocolNum,
+            .count = NfcSupportedCardsPluginCache_size(cache_arr),
+        };
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        NfcSupportedCardsPluginCache_it_t iter;
+        for(NfcSupportedCardsPluginCache_it(iter, cache_arr);
+            !NfcSupportedCardsPluginCache_end_p(iter);
+            NfcSupportedCardsPluginCache_next(iter)) {
+            const NfcSupportedCardsPluginCache* plugin_cache =
+                NfcSupportedCardsPluginCache_cref(iter);
+            NfcSupportedCardsCacheRecord record = {
+                .size = plugin_cache->size,
+                .crc = plugin_cache->crc,
+                .protocol = plugin_cache->protocol,
+                .feature = plugin_cache->feature,
+                .path_length = furi_string_size(plugin_cache->path),
+            };
+            if(storage_file_write(file, &record, sizeof(record)) != sizeof(record)) break;
+            if(storage_file_write(
+                   file, furi_string_get_cstr(plugin_cache->path), record.path_length) !=
+               record.path_length)
+                break;
+        }
+
+        success = NfcSupportedCardsPluginCache_end_p(iter);
+    } while(false);
+
+    storage_file_free(file);
+
+    if(!success) {
+        storage_simply_remove(storage, cache_path);
+    }
+
+    return success;
+}
+
+static const NfcSupportedCardsPluginCache* nfc_supported_cards_cache_find(
+    const NfcSupportedCardsPluginCache_t cache_arr,
+    const NfcSupportedCardsPluginCache* plugin_cache) {
+    const NfcSupportedCardsPluginCache* found = NULL;
+
+    NfcSupportedCardsPluginCache_it_t iter;
+    for(NfcSupportedCardsPluginCache_it(iter, cache_arr);
+        !NfcSupportedCardsPluginCache_end_p(iter);
+        NfcSupportedCardsPluginCache_next(iter)) {
+        const NfcSupportedCardsPluginCache* cached = NfcSupportedCardsPluginCache_cref(iter);
+        if((cached->size == plugin_cache->size) && (cached->crc == plugin_cache->crc) &&
+           furi_string_equal(cached->path, plugin_cache->path)) {
+            found = cached;
+            break;
+        }
+    }
+
+    return found;
+}
+
+static bool nfc_supported_cards_cache_file_crc(Storage* storage, FuriString* path, uint32_t* crc) {
+    File* file = storage_file_alloc(storage);
+
+    bool success =
+        storage_file_open(file, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING);
+    if(success) {
+        *crc = crc32_calc_file(file, NULL, NULL);
+    }
+
+    storage_file_free(file);
+
+    return success;
+}
+
+size_t nfc_supported_cards_cache_load(
+    NfcSupportedCardsPluginCache_t cache_arr,
+    Storage* storage,
+    const char* plugins_path,
+    const char* suffix,
+    const char* cache_path,
+    NfcSupportedCardsCacheMapCallback callback,
+    void* context) {
+    furi_check(storage);
+    furi_check(plugins_path);
+    furi_check(suffix);
+    furi_check(cache_path);
+    furi_check(callback);
+
+    NfcSupportedCardsPluginCache_t stored_arr;
+    NfcSupportedCardsPluginCache_init(stored_arr);
+    nfc_supported_cards_cache_file_read(storage, cache_path, stored_arr);
+
+    File* directory = storage_file_alloc(storage);
+    char* file_name = malloc(NFC_SUPPORTED_CARDS_CACHE_PATH_MAX);
+    NfcSupportedCardsPluginCache plugin_cache = {.path = furi_string_alloc()};
+
+    size_t plugins_cached = 0;
+    size_t plugins_mapped = 0;
+    FileInfo file_info;
+
+    if(!storage_dir_open(directory, plugins_path)) {
+        FURI_LOG_D(TAG, "Failed to open directory: %s", plugins_path);
+    }
+
+    while(storage_file_is_open(directory) &&
+          storage_dir_read(directory, &file_info, file_name, NFC_SUPPORTED_CARDS_CACHE_PATH_MAX)) {
+        if(file_info_is_dir(&file_info)) continue;
+
+        furi_string_set(plugin_cache.path, file_name);
+        if(!furi_string_end_with_str(plugin_cache.path, suffix)) continue;
+        path_concat(plugins_path, file_name, plugin_cache.path);
+
+        // File timestamps are not available, contents CRC tells a changed plugin
+        plugin_cache.size = file_info.size;
+        if(!nfc_supported_cards_cache_file_crc(storage, plugin_cache.path, &plugin_cache.crc))
+            continue;
+
+        // Plugin is only mapped to memory if it is new or changed
+        const NfcSupportedCardsPluginCache* stored =
+            nfc_supported_cards_cache_find(stored_arr, &plugin_cache);
+        if(stored) {
+            plugin_cache.protocol = stored->protocol;
+            plugin_cache.feature = stored->feature;
+            plugins_cached++;
+        } else {
+            // Not a plugin is not cached, it may be a temporary failure
+            if(!callback(plugin_cache.path, &plugin_cache, context)) continue;
+            plugins_mapped++;
+        }
+
+        NfcSupportedCardsPluginCache loaded_cache = plugin_cache;
+        loaded_cache.path = furi_string_alloc_set(plugin_cache.path);
+        NfcSupportedCardsPluginCache_push_back(cache_arr, loaded_cache);
+    }
+
+    storage_dir_close(directory);
+    storage_file_free(directory);
+
+    // Rewrite the cache file if plugins were added, changed or removed
+    if(plugins_mapped || (plugins_cached != NfcSupportedCardsPluginCache_size(stored_arr))) {
+        if(!nfc_supported_cards_cache_file_write(storage, cache_path, cache_arr)) {
+            FURI_LOG_W(TAG, "Failed to write cache");
+        }
+    }
+
+    furi_string_free(plugin_cache.path);
+    free(file_name);
+    nfc_supported_cards_cache_reset(stored_arr);
+    NfcSupportedCardsPluginCache_clear(stored_arr);
+
+    return plugins_mapped;
+}
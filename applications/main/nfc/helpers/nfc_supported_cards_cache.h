@@ -0,0 +1,78 @@
+/**
+ * @file nfc_supported_cards_cache.h
+ * @brief Supported card plugin metadata cache.
+ *
+ * Keeps protocol and features of every parser plugin in a file, so plugins
+ * don't have to be mapped to memory on each app launch. A record is used
+ * while plugin file path, size and contents CRC32 are the same.
+ */
+#pragma once
+
+#include <core/string.h>
+#include <storage/storage.h>
+#include <nfc/protocols/nfc_protocol.h>
+
+#include <m-array.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    FuriString* path;
+    NfcProtocol protocol;
+    uint8_t feature;
+    uint32_t size;
+    uint32_t crc;
+} NfcSupportedCardsPluginCache;
+
+ARRAY_DEF(NfcSupportedCardsPluginCache, NfcSupportedCardsPluginCache, M_POD_OPLIST);
+
+/**
+ * @brief Get plugin metadata, called for new or changed plugin files.
+ *
+ * @param[in] path plugin file path.
+ * @param[out] plugin_cache record to fill protocol and feature of.
+ * @param[in] context pointer to user context.
+ * @returns true on success, false if file is not a plugin or failed to load.
+ */
+typedef bool (*NfcSupportedCardsCacheMapCallback)(
+    const FuriString* path,
+    NfcSupportedCardsPluginCache* plugin_cache,
+    void* context);
+
+/**
+ * @brief Free records and empty the array.
+ *
+ * @param[in, out] cache_arr array to reset.
+ */
+void nfc_supported_cards_cache_reset(NfcSupportedCardsPluginCache_t cache_arr);
+
+/**
+ * @brief Fill array with metadata of plugins found in a directory.
+ *
+ * Metadata of unchanged plugins comes from the cache file, callback is only
+ * called for new or changed ones. Cache file is rewritten when plugins were
+ * added, changed or removed. Files callback failed for are not cached.
+ *
+ * @param[out] cache_arr array to append records to.
+ * @param[in] storage pointer to Storage instance.
+ * @param[in] plugins_path directory to look for plugins in.
+ * @param[in] suffix plugin file name suffix.
+ * @param[in] cache_path cache file path.
+ * @param[in] callback function to get metadata of new or changed plugins.
+ * @param[in] context pointer to user context passed to callback.
+ * @returns number of plugins callback was called for successfully.
+ */
+size_t nfc_supported_cards_cache_load(
+    NfcSupportedCardsPluginCache_t cache_arr,
+    Storage* storage,
+    const char* plugins_path,
+    const char* suffix,
+    const char* cache_path,
+    NfcSupportedCardsCacheMapCallback callback,
+    void* context);
+
+#ifdef __cplusplus
+}
+#endif
@@ -253,7 +253,14 @@ bool nfc_save_file(NfcApp* instance, FuriString* path) {
     furi_assert(instance);
     furi_assert(path);
 
-    bool result = nfc_device_save(instance->nfc_device, furi_string_get_cstr(instance->file_path));
+    const char* file_path = furi_string_get_cstr(instance->file_path);
+    bool result = false;
+    // Shadow file only keeps emulation state, packed blocks load faster
+    if(furi_string_end_with(instance->file_path, NFC_APP_SHADOW_EXTENSION)) {
+        result = nfc_device_save_packed(instance->nfc_device, file_path);
+    } else {
+        result = nfc_device_save(instance->nfc_device, file_path);
+    }
 
     if(!result) {
         dialog_message_show_storage_error(instance->dialogs, "Cannot save\nkey file");
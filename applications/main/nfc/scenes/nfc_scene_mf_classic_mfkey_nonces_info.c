@@ -11,9 +11,28 @@ void nfc_scene_mf_classic_mfkey_nonces_info_callback(
     }
 }
 
+static void nfc_scene_mf_classic_mfkey_nonces_info_check_dict(NfcApp* instance) {
+    // Reader may use a known key, no need to run Mfkey32 for such sectors
+    const char* dict_paths[] = {
+        NFC_APP_MF_CLASSIC_DICT_USER_PATH,
+        NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH,
+    };
+
+    for(size_t i = 0; i < COUNT_OF(dict_paths); i++) {
+        if(!keys_dict_check_presence(dict_paths[i])) continue;
+
+        KeysDict* dict =
+            keys_dict_alloc(dict_paths[i], KeysDictModeOpenExisting, sizeof(MfClassicKey));
+        mfkey32_logger_check_dict(instance->mfkey32_logger, dict);
+        keys_dict_free(dict);
+    }
+}
+
 void nfc_scene_mf_classic_mfkey_nonces_info_on_enter(void* context) {
     NfcApp* instance = context;
 
+    nfc_scene_mf_classic_mfkey_nonces_info_check_dict(instance);
+
     FuriString* temp_str = furi_string_alloc();
 
     size_t mfkey_params_saved = mfkey32_logger_get_params_num(instance->mfkey32_logger);
@@ -46,8 +46,10 @@ SubGhzTxRx* subghz_txrx_alloc(void) {
     instance->fff_data = flipper_format_string_alloc();
 
     instance->environment = subghz_environment_alloc();
-    instance->is_database_loaded =
-        subghz_environment_load_keystore(instance->environment, SUBGHZ_KEYSTORE_DIR_NAME);
+    instance->is_database_loaded = subghz_keystore_load_cached(
+        subghz_environment_get_keystore(instance->environment),
+        SUBGHZ_KEYSTORE_DIR_NAME,
+        SUBGHZ_KEYSTORE_CACHE_DIR_NAME);
     subghz_environment_load_keystore(instance->environment, SUBGHZ_KEYSTORE_DIR_USER_NAME);
     subghz_environment_set_came_atomo_rainbow_table_file_name(
         instance->environment, SUBGHZ_CAME_ATOMO_DIR_NAME);
@@ -267,6 +267,7 @@ bool subghz_scene_read_raw_on_event(void* context, SceneManagerEvent event) {
                 scene_manager_next_scene(subghz->scene_manager, SubGhzSceneNeedSaving);
             } else {
                 SubGhzRadioPreset preset = subghz_txrx_get_preset(subghz->txrx);
+                subghz_protocol_raw_save_to_file_set_encoding(decoder_raw, subghz->raw_encoding);
                 if(subghz_protocol_raw_save_to_file_init(decoder_raw, RAW_FILE_NAME, &preset)) {
                     dolphin_deed(DolphinDeedSubGhzRawRec);
                     subghz_txrx_rx_start(subghz->txrx);
@@ -133,6 +133,7 @@ SubGhz* subghz_alloc(void) {
 
     //init threshold rssi
     subghz->threshold_rssi = subghz_threshold_rssi_alloc();
+    subghz->raw_encoding = SubGhzProtocolRAWEncodingText;
 
     subghz_unlock(subghz);
     subghz_rx_key_state_set(subghz, SubGhzRxKeyStateIDLE);
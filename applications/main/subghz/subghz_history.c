@@ -3,6 +3,7 @@
 #include <lib/subghz/protocols/came.h>
 
 #include <furi.h>
+#include <m-array.h>
 
 #define SUBGHZ_HISTORY_MAX 50
 #define SUBGHZ_HISTORY_FREE_HEAP 20480
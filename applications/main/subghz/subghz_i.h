@@ -3,6 +3,7 @@
 #include "helpers/subghz_types.h"
 #include "helpers/subghz_error_type.h"
 #include <lib/subghz/types.h>
+#include <lib/subghz/protocols/raw.h>
 #include "subghz.h"
 #include "views/receiver.h"
 #include "views/transmitter.h"
@@ -65,6 +66,7 @@ struct SubGhz {
     FuriString* error_str;
     SubGhzLock lock;
     SubGhzThresholdRssi* threshold_rssi;
+    SubGhzProtocolRAWEncoding raw_encoding;
     SubGhzRxKeyState rx_key_state;
     SubGhzHistory* history;
     uint16_t idx_menu_chosen;
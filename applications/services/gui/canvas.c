@@ -6,6 +6,10 @@
 #include <stdint.h>
 #include <u8g2_glue.h>
 
+#define CANVAS_TILE_SIZE (8U)
+/* Send whole frame periodically, so display memory corrupted or reset outside of canvas heals */
+#define CANVAS_FULL_REFRESH_INTERVAL_MS (1000U)
+
 const CanvasFontParameters canvas_font_params[FontTotalNumber] = {
     [FontPrimary] = {.leading_default = 12, .leading_min = 11, .height = 8, .descender = 2},
     [FontSecondary] = {.leading_default = 11, .leading_min = 9, .height = 7, .descender = 2},
@@ -22,6 +26,7 @@ Canvas* canvas_init(void) {
 
     // Initialize callback array
     CanvasCallbackPairArray_init(canvas->canvas_callback_pair);
+    canvas->callback_pending = false;
 
     // Setup u8g2
     u8g2_Setup_st756x_flipper(&canvas->fb, U8G2_R0, u8x8_hw_spi_stm32, u8g2_gpio_and_delay_stm32);
@@ -31,6 +36,11 @@ Canvas* canvas_init(void) {
     // Wake up display
     u8g2_SetPowerSave(&canvas->fb, 0);
 
+    // Copy of display memory, to send only changes
+    canvas->fb_sent = malloc(canvas_get_buffer_size(canvas));
+    canvas->fb_sent_valid = false;
+    memset(&canvas->stats, 0, sizeof(CanvasStats));
+
     // Clear buffer and send to device
     canvas_clear(canvas);
     canvas_commit(canvas);
@@ -43,6 +53,7 @@ void canvas_free(Canvas* canvas) {
     compress_icon_free(canvas->compress_icon);
     CanvasCallbackPairArray_clear(canvas->canvas_callback_pair);
     furi_mutex_free(canvas->mutex);
+    free(canvas->fb_sent);
     free(canvas);
 }
 
@@ -66,20 +77,87 @@ void canvas_reset(Canvas* canvas) {
     canvas_set_font_direction(canvas, CanvasDirectionLeftToRight);
 }
 
+/** Send changed columns of every page, returns number of bytes sent */
+static size_t canvas_flush(Canvas* canvas) {
+    uint8_t* buffer = canvas_get_buffer(canvas);
+    const size_t page_size = u8g2_GetBufferTileWidth(&canvas->fb) * CANVAS_TILE_SIZE;
+    const size_t page_count = u8g2_GetBufferTileHeight(&canvas->fb);
+    size_t bytes_sent = 0;
+
+    for(size_t page = 0; page < page_count; page++) {
+        const uint8_t* data = buffer + page * page_size;
+        uint8_t* sent = canvas->fb_sent + page * page_size;
+        size_t begin = 0;
+        size_t end = page_size;
+
+        if(canvas->fb_sent_valid) {
+            while(begin < end && data[begin] == sent[begin]) begin++;
+            if(begin == end) continue;
+            while(data[end - 1] == sent[end - 1]) end--;
+        }
+
+        // Display is written by tiles of 8x8 pixels
+        const size_t tile_begin = begin / CANVAS_TILE_SIZE;
+        const size_t tile_end = (end + CANVAS_TILE_SIZE - 1) / CANVAS_TILE_SIZE;
+        const size_t offset = tile_begin * CANVAS_TILE_SIZE;
+        const size_t size = (tile_end - tile_begin) * CANVAS_TILE_SIZE;
+
+        u8g2_UpdateDisplayArea(&canvas->fb, tile_begin, page, tile_end - tile_begin, 1);
+        memcpy(sent + offset, data + offset, size);
+        bytes_sent += size;
+    }
+
+    if(bytes_sent) {
+        u8x8_RefreshDisplay(u8g2_GetU8x8(&canvas->fb));
+    }
+    if(!canvas->fb_sent_valid) {
+        canvas->fb_sent_tick = furi_get_tick();
+        canvas->fb_sent_valid = true;
+    }
+
+    return bytes_sent;
+}
+
 void canvas_commit(Canvas* canvas) {
     furi_check(canvas);
-    u8g2_SendBuffer(&canvas->fb);
+    const uint32_t start = DWT->CYCCNT;
+
+    const uint32_t refresh_interval = furi_ms_to_ticks(CANVAS_FULL_REFRESH_INTERVAL_MS);
+    if(furi_get_tick() - canvas->fb_sent_tick >= refresh_interval) {
+        canvas->fb_sent_valid = false;
+    }
+    const size_t bytes_sent = canvas_flush(canvas);
 
     // Iterate over callbacks
     canvas_lock(canvas);
-    for
-        M_EACH(p, canvas->canvas_callback_pair, CanvasCallbackPairArray_t) {
-            p->callback(
-                canvas_get_buffer(canvas),
-                canvas_get_buffer_size(canvas),
-                canvas_get_orientation(canvas),
-                p->context);
-        }
+    if(bytes_sent || canvas->callback_pending) {
+        for
+            M_EACH(p, canvas->canvas_callback_pair, CanvasCallbackPairArray_t) {
+                p->callback(
+                    canvas_get_buffer(canvas),
+                    canvas_get_buffer_size(canvas),
+                    canvas_get_orientation(canvas),
+                    p->context);
+            }
+        canvas->callback_pending = false;
+    }
+
+    const uint32_t frame_time_us =
+        (DWT->CYCCNT - start) / furi_hal_cortex_instructions_per_microsecond();
+    canvas->stats.frames++;
+    if(!bytes_sent) canvas->stats.frames_skipped++;
+    canvas->stats.bytes_sent += bytes_sent;
+    canvas->stats.frame_time_us = frame_time_us;
+    canvas->stats.frame_time_max_us = MAX(canvas->stats.frame_time_max_us, frame_time_us);
+    canvas_unlock(canvas);
+}
+
+void canvas_get_stats(Canvas* canvas, CanvasStats* stats) {
+    furi_check(canvas);
+    furi_check(stats);
+
+    canvas_lock(canvas);
+    *stats = canvas->stats;
     canvas_unlock(canvas);
 }
 
@@ -576,6 +654,8 @@ void canvas_add_framebuffer_callback(Canvas* canvas, CanvasCommitCallback callba
     canvas_lock(canvas);
     furi_check(!CanvasCallbackPairArray_count(canvas->canvas_callback_pair, p));
     CanvasCallbackPairArray_push_back(canvas->canvas_callback_pair, p);
+    // New callback needs the current frame even if it doesn't change
+    canvas->callback_pending = true;
     canvas_unlock(canvas);
 }
 
@@ -91,6 +91,8 @@ typedef struct Canvas Canvas;
 void canvas_reset(Canvas* canvas);
 
 /** Commit canvas. Send buffer to display
+ *
+ * Only the parts of the buffer changed since the last commit are sent.
  *
  * @param      canvas  Canvas instance
  */
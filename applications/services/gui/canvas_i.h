@@ -33,6 +33,14 @@ ARRAY_DEF(CanvasCallbackPairArray, CanvasCallbackPair, M_POD_OPLIST);
 
 ALGO_DEF(CanvasCallbackPairArray, CanvasCallbackPairArray_t);
 
+typedef struct {
+    uint32_t frames; /**< Commits */
+    uint32_t frames_skipped; /**< Commits without changes */
+    uint32_t bytes_sent; /**< Bytes sent to display */
+    uint32_t frame_time_us; /**< Last commit time */
+    uint32_t frame_time_max_us; /**< Longest commit time */
+} CanvasStats;
+
 /** Canvas structure
  */
 struct Canvas {
@@ -45,6 +53,11 @@ struct Canvas {
     CompressIcon* compress_icon;
     CanvasCallbackPairArray_t canvas_callback_pair;
     FuriMutex* mutex;
+    uint8_t* fb_sent;
+    bool fb_sent_valid;
+    uint32_t fb_sent_tick;
+    bool callback_pending;
+    CanvasStats stats;
 };
 
 /** Allocate memory and initialize canvas
@@ -59,6 +72,13 @@ Canvas* canvas_init(void);
  */
 void canvas_free(Canvas* canvas);
 
+/** Get canvas statistics
+ *
+ * @param      canvas  Canvas instance
+ * @param      stats   CanvasStats to fill
+ */
+void canvas_get_stats(Canvas* canvas, CanvasStats* stats);
+
 /** Get canvas buffer.
  *
  * @param      canvas  Canvas instance
@@ -126,7 +146,8 @@ void canvas_draw_u8g2_bitmap(
 
 /** Add canvas commit callback.
  *
- * This callback will be called upon Canvas commit.
+ * This callback will be called upon Canvas commit if the frame changed, and
+ * on the next commit after it was added.
  * 
  * @param      canvas    Canvas instance
  * @param      callback  CanvasCommitCallback
@@ -7,6 +7,7 @@
 #include <core/check.h>
 #include <core/common_defines.h>
 #include <furi.h>
+#include <furi_hal_rtc.h>
 
 #include <m-array.h>
 #include <stdbool.h>
@@ -18,6 +19,12 @@
 #define BROWSER_ROOT STORAGE_ANY_PATH_PREFIX
 #define FILE_NAME_LEN_MAX 256
 #define LONG_LOAD_THRESHOLD 100
+#define DIR_READ_BATCH_SIZE 8
+#define CACHE_NAMES_SIZE_MIN 512
+#define CACHE_ITEMS_MIN 32
+#define CACHE_HEAP_RESERVE (4 * 1024)
+// Cache may take this share of the largest free heap block at folder enter
+#define CACHE_HEAP_SHARE 4
 
 typedef enum {
     WorkerEvtStop = (1 << 0),
@@ -32,8 +39,29 @@ typedef enum {
     (WorkerEvtStop | WorkerEvtLoad | WorkerEvtFolderEnter | WorkerEvtFolderExit | \
      WorkerEvtFolderRefresh | WorkerEvtConfigChange)
 
+typedef struct {
+    uint32_t name_offset;
+    bool is_dir;
+} BrowserCacheItem;
+
 ARRAY_DEF(IdxLastArray, int32_t)
 ARRAY_DEF(ExtFilterArray, FuriString*, FURI_STRING_OPLIST)
+ARRAY_DEF(BrowserCacheItemArray, BrowserCacheItem, M_POD_OPLIST)
+
+// Filtered listing of the current folder, names are packed one after another.
+// Folders bigger than the memory budget keep the first items only.
+typedef struct {
+    bool valid;
+    bool complete;
+    FuriString* path;
+    uint32_t timestamp;
+    BrowserCacheItemArray_t items;
+    size_t items_capacity;
+    char* names;
+    size_t names_size;
+    size_t names_capacity;
+    size_t size_max;
+} BrowserCache;
 
 struct BrowserWorker {
     FuriThread* thread;
@@ -48,6 +76,7 @@ struct BrowserWorker {
     bool hide_dot_files;
     IdxLastArray_t idx_last;
     ExtFilterArray_t ext_filter;
+    BrowserCache cache;
 
     void* cb_ctx;
     BrowserWorkerFolderOpenCallback folder_cb;
@@ -56,6 +85,157 @@ struct BrowserWorker {
     BrowserWorkerLongLoadCallback long_load_cb;
 };
 
+typedef struct {
+    File* directory;
+    FileInfo file_info[DIR_READ_BATCH_SIZE];
+    char name[DIR_READ_BATCH_SIZE][FILE_NAME_LEN_MAX];
+    size_t count;
+    size_t pos;
+} BrowserDirReader;
+
+static BrowserDirReader* browser_dir_reader_alloc(Storage* storage) {
+    BrowserDirReader* reader = malloc(sizeof(BrowserDirReader));
+    reader->directory = storage_file_alloc(storage);
+    return reader;
+}
+
+static void browser_dir_reader_free(BrowserDirReader* reader) {
+    storage_dir_close(reader->directory);
+    storage_file_free(reader->directory);
+    free(reader);
+}
+
+static bool browser_dir_reader_open(BrowserDirReader* reader, FuriString* path) {
+    reader->count = 0;
+    reader->pos = 0;
+    return storage_dir_open(reader->directory, furi_string_get_cstr(path));
+}
+
+// Items are read from storage in batches to save a storage request per item
+static bool
+    browser_dir_reader_next(BrowserDirReader* reader, FileInfo** file_info, const char** name) {
+    if(reader->pos == reader->count) {
+        reader->pos = 0;
+        reader->count = storage_dir_read_batch(
+            reader->directory,
+            reader->file_info,
+            reader->name[0],
+            FILE_NAME_LEN_MAX,
+            DIR_READ_BATCH_SIZE);
+        if(reader->count == 0) return false;
+    }
+
+    *file_info = &reader->file_info[reader->pos];
+    *name = reader->name[reader->pos];
+    reader->pos++;
+
+    return true;
+}
+
+static void browser_cache_init(BrowserCache* cache) {
+    cache->valid = false;
+    cache->complete = false;
+    cache->path = furi_string_alloc();
+    BrowserCacheItemArray_init(cache->items);
+    cache->items_capacity = 0;
+    cache->names = NULL;
+    cache->names_size = 0;
+    cache->names_capacity = 0;
+    cache->size_max = 0;
+}
+
+static void browser_cache_clear(BrowserCache* cache) {
+    furi_string_free(cache->path);
+    BrowserCacheItemArray_clear(cache->items);
+    free(cache->names);
+}
+
+static void browser_cache_reset(BrowserCache* cache) {
+    cache->valid = false;
+    cache->complete = false;
+    furi_string_reset(cache->path);
+    // Release item storage too, reset keeps the allocation
+    BrowserCacheItemArray_clear(cache->items);
+    BrowserCacheItemArray_init(cache->items);
+    cache->items_capacity = 0;
+    free(cache->names);
+    cache->names = NULL;
+    cache->names_size = 0;
+    cache->names_capacity = 0;
+    cache->size_max = 0;
+}
+
+static bool
+    browser_cache_can_grow(BrowserCache* cache, size_t names_capacity, size_t items_capacity) {
+    size_t items_size = items_capacity * sizeof(BrowserCacheItem);
+    return (names_capacity + items_size) <= cache->size_max;
+}
+
+// realloc holds both blocks while copying, malloc failure is fatal
+static bool browser_cache_can_alloc(size_t size) {
+    if(memmgr_heap_get_max_free_block() < size + CACHE_HEAP_RESERVE) {
+        FURI_LOG_W(TAG, "Not enough memory to cache folder");
+        return false;
+    }
+    return true;
+}
+
+static bool browser_cache_add(BrowserCache* cache, const char* name, bool is_dir) {
+    size_t name_size = strlen(name) + 1;
+
+    if(BrowserCacheItemArray_size(cache->items) == cache->items_capacity) {
+        size_t capacity = MAX(cache->items_capacity * 2, (size_t)CACHE_ITEMS_MIN);
+        if(!browser_cache_can_grow(cache, cache->names_capacity, capacity) ||
+           !browser_cache_can_alloc(capacity * sizeof(BrowserCacheItem))) {
+            return false;
+        }
+        cache->items_capacity = capacity;
+        BrowserCacheItemArray_reserve(cache->items, cache->items_capacity);
+    }
+
+    if(cache->names_size + name_size > cache->names_capacity) {
+        size_t capacity = MAX(cache->names_capacity * 2, (size_t)CACHE_NAMES_SIZE_MIN);
+        capacity = MAX(capacity, cache->names_size + name_size);
+        if(!browser_cache_can_grow(cache, capacity, cache->items_capacity) ||
+           !browser_cache_can_alloc(capacity)) {
+            return false;
+        }
+        cache->names_capacity = capacity;
+        cache->names = realloc(cache->names, cache->names_capacity); //-V701
+    }
+
+    memcpy(&cache->names[cache->names_size], name, name_size);
+    BrowserCacheItem* item = BrowserCacheItemArray_push_new(cache->items);
+    item->name_offset = cache->names_size;
+    item->is_dir = is_dir;
+    cache->names_size += name_size;
+
+    return true;
+}
+
+// Storage timestamp changes on every write, remove, mkdir and card mount
+static bool browser_cache_timestamp(Storage* storage, FuriString* path, uint32_t* timestamp) {
+    return storage_common_timestamp(storage, furi_string_get_cstr(path), timestamp) == FSE_OK;
+}
+
+static bool browser_cache_is_valid(BrowserCache* cache, Storage* storage, FuriString* path) {
+    if(!cache->valid || furi_string_cmp(cache->path, path) != 0) {
+        return false;
+    }
+
+    uint32_t timestamp = 0;
+    if(!browser_cache_timestamp(storage, path, &timestamp)) {
+        return false;
+    }
+
+    return timestamp == cache->timestamp;
+}
+
+static bool browser_cache_contains(BrowserCache* cache, uint32_t offset, uint32_t count) {
+    return cache->complete ||
+           ((uint64_t)offset + count <= BrowserCacheItemArray_size(cache->items));
+}
+
 static bool browser_path_is_file(FuriString* path) {
     bool state = false;
     FileInfo file_info;
@@ -174,35 +354,42 @@ static bool browser_folder_init(
     uint32_t* item_cnt,
     int32_t* file_idx) {
     bool state = false;
-    FileInfo file_info;
+    FileInfo* file_info;
+    const char* name_temp;
     uint32_t total_files_cnt = 0;
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
-    File* directory = storage_file_alloc(storage);
+    BrowserDirReader* reader = browser_dir_reader_alloc(storage);
 
-    char name_temp[FILE_NAME_LEN_MAX];
     FuriString* name_str;
     name_str = furi_string_alloc();
 
     *item_cnt = 0;
     *file_idx = -1;
 
-    if(storage_dir_open(directory, furi_string_get_cstr(path))) {
+    BrowserCache* cache = &browser->cache;
+    browser_cache_reset(cache);
+    cache->size_max = memmgr_heap_get_max_free_block() / CACHE_HEAP_SHARE;
+    bool cache_ok = browser_cache_timestamp(storage, path, &cache->timestamp);
+    bool cache_full = false;
+
+    if(browser_dir_reader_open(reader, path)) {
         state = true;
-        while(1) {
-            if(!storage_dir_read(directory, &file_info, name_temp, FILE_NAME_LEN_MAX)) {
-                break;
-            }
-            if((storage_file_get_error(directory) == FSE_OK) && (name_temp[0] != '\0')) {
+        while(browser_dir_reader_next(reader, &file_info, &name_temp)) {
+            if(name_temp[0] != '\0') {
                 total_files_cnt++;
                 furi_string_set(name_str, name_temp);
-                if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
+                if(browser_filter_by_name(browser, name_str, file_info_is_dir(file_info))) {
                     if(!furi_string_empty(filename)) {
                         if(furi_string_cmp(name_str, filename) == 0) {
                             *file_idx = *item_cnt;
                         }
                     }
                     (*item_cnt)++;
+                    if(cache_ok && !cache_full) {
+                        cache_full =
+                            !browser_cache_add(cache, name_temp, file_info_is_dir(file_info));
+                    }
                 }
                 if(total_files_cnt == LONG_LOAD_THRESHOLD) {
                     // There are too many files in folder and counting them will take some time - send callback to app
@@ -216,44 +403,86 @@ static bool browser_folder_init(
 
     furi_string_free(name_str);
 
-    storage_dir_close(directory);
-    storage_file_free(directory);
+    browser_dir_reader_free(reader);
+
+    // Changes made in the same second as the last one can't be told apart by timestamp
+    if(state && cache_ok && (cache->timestamp < furi_hal_rtc_get_timestamp())) {
+        uint32_t timestamp = 0;
+        if(browser_cache_timestamp(storage, path, &timestamp) && (timestamp == cache->timestamp)) {
+            furi_string_set(cache->path, path);
+            cache->valid = true;
+            cache->complete = !cache_full;
+        }
+    }
+    if(!cache->valid) {
+        browser_cache_reset(cache);
+    }
 
     furi_record_close(RECORD_STORAGE);
 
     return state;
 }
 
+static bool browser_folder_load_cached(
+    BrowserWorker* browser,
+    FuriString* path,
+    uint32_t offset,
+    uint32_t count) {
+    BrowserCache* cache = &browser->cache;
+    size_t items_total = BrowserCacheItemArray_size(cache->items);
+    if(offset > items_total) {
+        return false;
+    }
+
+    if(browser->list_load_cb) {
+        browser->list_load_cb(browser->cb_ctx, offset);
+    }
+
+    FuriString* name_str = furi_string_alloc();
+    uint32_t items_cnt = 0;
+    for(size_t i = offset; (items_cnt < count) && (i < items_total); i++) {
+        const BrowserCacheItem* item = BrowserCacheItemArray_cget(cache->items, i);
+        furi_string_printf(
+            name_str, "%s/%s", furi_string_get_cstr(path), &cache->names[item->name_offset]);
+        if(browser->list_item_cb) {
+            browser->list_item_cb(browser->cb_ctx, name_str, item->is_dir, false);
+        }
+        items_cnt++;
+    }
+    if(browser->list_item_cb) {
+        browser->list_item_cb(browser->cb_ctx, NULL, false, true);
+    }
+    furi_string_free(name_str);
+
+    return (items_cnt == count);
+}
+
 static bool
     browser_folder_load(BrowserWorker* browser, FuriString* path, uint32_t offset, uint32_t count) {
-    FileInfo file_info;
+    FileInfo* file_info;
+    const char* name_temp;
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
-    File* directory = storage_file_alloc(storage);
+    BrowserDirReader* reader = browser_dir_reader_alloc(storage);
 
-    char name_temp[FILE_NAME_LEN_MAX];
     FuriString* name_str;
     name_str = furi_string_alloc();
 
     uint32_t items_cnt = 0;
 
     do {
-        if(!storage_dir_open(directory, furi_string_get_cstr(path))) {
+        if(!browser_dir_reader_open(reader, path)) {
             break;
         }
 
         items_cnt = 0;
         while(items_cnt < offset) {
-            if(!storage_dir_read(directory, &file_info, name_temp, FILE_NAME_LEN_MAX)) {
+            if(!browser_dir_reader_next(reader, &file_info, &name_temp)) {
                 break;
             }
-            if(storage_file_get_error(directory) == FSE_OK) {
-                furi_string_set(name_str, name_temp);
-                if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
-                    items_cnt++;
-                }
-            } else {
-                break;
+            furi_string_set(name_str, name_temp);
+            if(browser_filter_by_name(browser, name_str, file_info_is_dir(file_info))) {
+                items_cnt++;
             }
         }
         if(items_cnt != offset) {
@@ -266,21 +495,17 @@ static bool
 
         items_cnt = 0;
         while(items_cnt < count) {
-            if(!storage_dir_read(directory, &file_info, name_temp, FILE_NAME_LEN_MAX)) {
+            if(!browser_dir_reader_next(reader, &file_info, &name_temp)) {
                 break;
             }
-            if(storage_file_get_error(directory) == FSE_OK) {
-                furi_string_set(name_str, name_temp);
-                if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
-                    furi_string_printf(name_str, "%s/%s", furi_string_get_cstr(path), name_temp);
-                    if(browser->list_item_cb) {
-                        browser->list_item_cb(
-                            browser->cb_ctx, name_str, file_info_is_dir(&file_info), false);
-                    }
-                    items_cnt++;
+            furi_string_set(name_str, name_temp);
+            if(browser_filter_by_name(browser, name_str, file_info_is_dir(file_info))) {
+                furi_string_printf(name_str, "%s/%s", furi_string_get_cstr(path), name_temp);
+                if(browser->list_item_cb) {
+                    browser->list_item_cb(
+                        browser->cb_ctx, name_str, file_info_is_dir(file_info), false);
                 }
-            } else {
-                break;
+                items_cnt++;
             }
         }
         if(browser->list_item_cb) {
@@ -290,8 +515,7 @@ static bool
 
     furi_string_free(name_str);
 
-    storage_dir_close(directory);
-    storage_file_free(directory);
+    browser_dir_reader_free(reader);
 
     furi_record_close(RECORD_STORAGE);
 
@@ -324,6 +548,7 @@ static int32_t browser_worker(void* context) {
                 path_extract_filename(browser->path_next, filename, false);
             }
             IdxLastArray_reset(browser->idx_last);
+            browser_cache_reset(&browser->cache);
 
             furi_thread_flags_set(furi_thread_get_id(browser->thread), WorkerEvtFolderEnter);
         }
@@ -392,7 +617,17 @@ static int32_t browser_worker(void* context) {
         if(flags & WorkerEvtLoad) {
             FURI_LOG_D(
                 TAG, "Load offset: %lu cnt: %lu", browser->load_offset, browser->load_count);
-            browser_folder_load(browser, path, browser->load_offset, browser->load_count);
+            Storage* storage = furi_record_open(RECORD_STORAGE);
+            bool cached = browser_cache_is_valid(&browser->cache, storage, path) &&
+                          browser_cache_contains(
+                              &browser->cache, browser->load_offset, browser->load_count);
+            furi_record_close(RECORD_STORAGE);
+            if(cached) {
+                browser_folder_load_cached(
+                    browser, path, browser->load_offset, browser->load_count);
+            } else {
+                browser_folder_load(browser, path, browser->load_offset, browser->load_count);
+            }
         }
 
         if(flags & WorkerEvtStop) {
@@ -417,6 +652,7 @@ BrowserWorker* file_browser_worker_alloc(
 
     IdxLastArray_init(browser->idx_last);
     ExtFilterArray_init(browser->ext_filter);
+    browser_cache_init(&browser->cache);
 
     browser_parse_ext_filter(browser->ext_filter, ext_filter);
     browser->skip_assets = skip_assets;
@@ -449,6 +685,7 @@ void file_browser_worker_free(BrowserWorker* browser) {
 
     IdxLastArray_clear(browser->idx_last);
     ExtFilterArray_clear(browser->ext_filter);
+    browser_cache_clear(&browser->cache);
 
     free(browser);
 }
@@ -6,8 +6,12 @@
 /* Generated table */
 #include <firmware_api_table.h>
 
+#include <furi.h>
 #include <furi_hal_info.h>
 
+#include <array>
+#include <algorithm>
+
 static_assert(!has_hash_collisions(elf_api_table), "Detected API method hash collision!");
 
 #ifdef APP_UNIT_TESTS
@@ -23,14 +27,59 @@ constexpr HashtableApiInterface mock_elf_api_interface{
 
 const ElfApiInterface* const firmware_api_interface = &mock_elf_api_interface;
 #else
-constexpr HashtableApiInterface elf_api_interface{
-    {
-        .api_version_major = (elf_api_version >> 16),
-        .api_version_minor = (elf_api_version & 0xFFFF),
-        .resolver_callback = &elf_resolve_from_hashtable,
-    },
-    elf_api_table.cbegin(),
-    elf_api_table.cend(),
+/* Firmware table is indexed by top bits of the hash, so lookup only searches
+ * a few entries instead of the whole table. Index layout is firmware private,
+ * HashtableApiInterface stays as is for tables built by applications. */
+#define FIRMWARE_API_INDEX_BITS (8U)
+#define FIRMWARE_API_INDEX_SIZE (1U << FIRMWARE_API_INDEX_BITS)
+
+/* Entries with hash bucket b are in [index[b], index[b + 1]) */
+template <std::size_t N>
+constexpr std::array<uint16_t, FIRMWARE_API_INDEX_SIZE + 1>
+    firmware_api_hash_index(const std::array<sym_entry, N>& api_methods) {
+    static_assert(N <= UINT16_MAX, "API table is too big for the index");
+
+    std::array<uint16_t, FIRMWARE_API_INDEX_SIZE + 1> index{};
+    std::size_t entry = 0;
+    for(std::size_t bucket = 0; bucket <= FIRMWARE_API_INDEX_SIZE; ++bucket) {
+        while(entry < N &&
+              (api_methods[entry].hash >> (32 - FIRMWARE_API_INDEX_BITS)) < bucket) {
+            ++entry;
+        }
+        index[bucket] = static_cast<uint16_t>(entry);
+    }
+
+    return index;
+}
+
+static constexpr auto elf_api_table_index = firmware_api_hash_index(elf_api_table);
+
+static bool
+    firmware_api_resolve(const ElfApiInterface* interface, uint32_t hash, Elf32_Addr* address) {
+    UNUSED(interface);
+
+    const uint16_t* bucket = &elf_api_table_index[hash >> (32 - FIRMWARE_API_INDEX_BITS)];
+    const sym_entry* table_begin = elf_api_table.cbegin() + bucket[0];
+    const sym_entry* table_end = elf_api_table.cbegin() + bucket[1];
+
+    sym_entry key = {
+        .hash = hash,
+        .address = 0,
+    };
+
+    auto find_res = std::lower_bound(table_begin, table_end, key);
+    if((find_res == table_end) || (find_res->hash != hash)) {
+        return false;
+    }
+
+    *address = find_res->address;
+    return true;
+}
+
+constexpr ElfApiInterface elf_api_interface{
+    .api_version_major = (elf_api_version >> 16),
+    .api_version_minor = (elf_api_version & 0xFFFF),
+    .resolver_callback = &firmware_api_resolve,
 };
 const ElfApiInterface* const firmware_api_interface = &elf_api_interface;
 #endif
@@ -26,6 +26,9 @@ typedef enum {
 
 #define RPC_ALL_EVENTS (RpcEvtNewData | RpcEvtDisconnect)
 
+// Room for the varint length of a delimited message
+#define RPC_SEND_PREFIX_SIZE (5U)
+
 DICT_DEF2(RpcHandlerDict, pb_size_t, M_DEFAULT_OPLIST, RpcHandler, M_POD_OPLIST)
 
 typedef struct {
@@ -77,12 +80,17 @@ struct RpcSession {
     void** system_contexts;
     bool decode_error;
 
+    FuriMutex* send_mutex;
+    uint8_t* send_buffer;
+    size_t send_buffer_size;
+
     FuriMutex* callbacks_mutex;
     RpcSendBytesCallback send_bytes_callback;
     RpcBufferIsEmptyCallback buffer_is_empty_callback;
     RpcSessionClosedCallback closed_callback;
     RpcSessionTerminatedCallback terminated_callback;
     RpcOwner owner;
+    bool screen_stream_delta;
     void* context;
 };
 
@@ -95,6 +103,16 @@ RpcOwner rpc_session_get_owner(RpcSession* session) {
     return session->owner;
 }
 
+void rpc_session_set_screen_stream_delta(RpcSession* session, bool enable) {
+    furi_check(session);
+    session->screen_stream_delta = enable;
+}
+
+bool rpc_session_is_screen_stream_delta(RpcSession* session) {
+    furi_check(session);
+    return session->screen_stream_delta;
+}
+
 static void rpc_close_session_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -371,6 +389,8 @@ static void rpc_session_thread_pending_callback(void* context, uint32_t arg) {
     furi_mutex_release(session->callbacks_mutex);
 
     furi_mutex_free(session->callbacks_mutex);
+    furi_mutex_free(session->send_mutex);
+    free(session->send_buffer);
     furi_thread_join(session->thread);
     furi_thread_free(session->thread);
     free(session);
@@ -387,11 +407,15 @@ RpcSession* rpc_session_open(Rpc* rpc, RpcOwner owner) {
 
     RpcSession* session = malloc(sizeof(RpcSession));
     session->callbacks_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    session->send_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    session->send_buffer = NULL;
+    session->send_buffer_size = 0;
     session->stream = furi_stream_buffer_alloc(RPC_BUFFER_SIZE, 1);
     session->rpc = rpc;
     session->terminate = false;
     session->decode_error = false;
     session->owner = owner;
+    session->screen_stream_delta = false;
     RpcHandlerDict_init(session->handlers);
 
     session->decoded_message = malloc(sizeof(PB_Main));
@@ -453,32 +477,57 @@ void rpc_send(RpcSession* session, PB_Main* message) {
     furi_assert(session);
     furi_assert(message);
 
-    pb_ostream_t ostream = PB_OSTREAM_SIZING;
-
 #if SRV_RPC_DEBUG
     FURI_LOG_I(TAG, "OUTPUT:");
     rpc_debug_print_message(message);
 #endif
 
-    bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
-    furi_check(result && ostream.bytes_written);
+    furi_mutex_acquire(session->send_mutex, FuriWaitForever);
+
+    // Session buffer only grows, so usually the message is encoded once
+    bool encoded = false;
+    pb_ostream_t ostream = PB_OSTREAM_SIZING;
+    if(session->send_buffer_size > RPC_SEND_PREFIX_SIZE) {
+        ostream = pb_ostream_from_buffer(
+            session->send_buffer + RPC_SEND_PREFIX_SIZE,
+            session->send_buffer_size - RPC_SEND_PREFIX_SIZE);
+        encoded = pb_encode(&ostream, &PB_Main_msg, message);
+    }
+
+    if(!encoded) {
+        ostream = (pb_ostream_t)PB_OSTREAM_SIZING;
+        bool result = pb_encode(&ostream, &PB_Main_msg, message);
+        furi_check(result);
 
-    uint8_t* buffer = malloc(ostream.bytes_written);
-    ostream = pb_ostream_from_buffer(buffer, ostream.bytes_written);
+        free(session->send_buffer);
+        session->send_buffer_size = RPC_SEND_PREFIX_SIZE + ostream.bytes_written;
+        session->send_buffer = malloc(session->send_buffer_size);
+        ostream = pb_ostream_from_buffer(
+            session->send_buffer + RPC_SEND_PREFIX_SIZE,
+            session->send_buffer_size - RPC_SEND_PREFIX_SIZE);
+
+        pb_encode(&ostream, &PB_Main_msg, message);
+    }
 
-    pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+    // Same as PB_ENCODE_DELIMITED: length prefix right before the message
+    uint8_t prefix[RPC_SEND_PREFIX_SIZE];
+    pb_ostream_t prefix_stream = pb_ostream_from_buffer(prefix, sizeof(prefix));
+    pb_encode_varint(&prefix_stream, ostream.bytes_written);
+    uint8_t* buffer = session->send_buffer + RPC_SEND_PREFIX_SIZE - prefix_stream.bytes_written;
+    memcpy(buffer, prefix, prefix_stream.bytes_written);
+    const size_t buffer_size = prefix_stream.bytes_written + ostream.bytes_written;
 
 #if SRV_RPC_DEBUG
-    rpc_debug_print_data("OUTPUT", buffer, ostream.bytes_written);
+    rpc_debug_print_data("OUTPUT", buffer, buffer_size);
 #endif
 
     furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
     if(session->send_bytes_callback) {
-        session->send_bytes_callback(session->context, buffer, ostream.bytes_written);
+        session->send_bytes_callback(session->context, buffer, buffer_size);
     }
     furi_mutex_release(session->callbacks_mutex);
 
-    free(buffer);
+    furi_mutex_release(session->send_mutex);
 }
 
 void rpc_send_and_release(RpcSession* session, PB_Main* message) {
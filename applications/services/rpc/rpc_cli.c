@@ -2,6 +2,7 @@
 #include <furi.h>
 #include <rpc/rpc.h>
 #include <furi_hal.h>
+#include <toolbox/args.h>
 
 #define TAG "RpcCli"
 
@@ -13,6 +14,8 @@ typedef struct {
 
 #define CLI_READ_BUFFER_SIZE 64
 
+#define RPC_CLI_ARG_SCREEN_DELTA "screen_delta"
+
 static void rpc_cli_send_bytes_callback(void* context, uint8_t* bytes, size_t bytes_len) {
     furi_assert(context);
     furi_assert(bytes);
@@ -37,7 +40,6 @@ static void rpc_cli_session_terminated_callback(void* context) {
 }
 
 void rpc_cli_command_start_session(Cli* cli, FuriString* args, void* context) {
-    UNUSED(args);
     furi_assert(cli);
     furi_assert(context);
     Rpc* rpc = context;
@@ -53,6 +55,15 @@ void rpc_cli_command_start_session(Cli* cli, FuriString* args, void* context) {
         return;
     }
 
+    // Client capabilities, unknown ones are ignored
+    FuriString* arg = furi_string_alloc();
+    while(args_read_string_and_trim(args, arg)) {
+        if(furi_string_equal(arg, RPC_CLI_ARG_SCREEN_DELTA)) {
+            rpc_session_set_screen_stream_delta(rpc_session, true);
+        }
+    }
+    furi_string_free(arg);
+
     CliRpc cli_rpc = {.cli = cli, .session_close_request = false};
     cli_rpc.terminate_semaphore = furi_semaphore_alloc(1, 0);
     rpc_session_set_context(rpc_session, &cli_rpc);
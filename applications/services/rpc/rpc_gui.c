@@ -1,4 +1,5 @@
 #include "rpc_i.h"
+#include "rpc_gui_stream.h"
 #include <gui/gui_i.h>
 #include <assets_icons.h>
 
@@ -63,6 +64,8 @@ typedef struct {
     // Transmit
     PB_Main* transmit_frame;
     FuriThread* transmit_thread;
+    RpcGuiStreamEncoder* stream_encoder;
+    uint8_t* stream_frame;
 
     bool virtual_display_not_empty;
     bool is_streaming;
@@ -89,11 +92,15 @@ static void rpc_system_gui_screen_stream_frame_callback(
     furi_assert(context);
 
     RpcGuiSystem* rpc_gui = (RpcGuiSystem*)context;
-    uint8_t* buffer = rpc_gui->transmit_frame->content.gui_screen_frame.data->bytes;
 
-    furi_assert(size == rpc_gui->transmit_frame->content.gui_screen_frame.data->size);
-
-    memcpy(buffer, data, size);
+    if(rpc_gui->stream_encoder) {
+        // Encoded by transmit thread
+        memcpy(rpc_gui->stream_frame, data, size);
+    } else {
+        uint8_t* buffer = rpc_gui->transmit_frame->content.gui_screen_frame.data->bytes;
+        furi_assert(size == rpc_gui->transmit_frame->content.gui_screen_frame.data->size);
+        memcpy(buffer, data, size);
+    }
     rpc_gui->transmit_frame->content.gui_screen_frame.orientation =
         rpc_system_gui_screen_orientation_map[orientation];
 
@@ -112,6 +119,11 @@ static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context)
 
         if(flags & RpcGuiWorkerFlagTransmit) {
             transmit_time = furi_get_tick();
+            if(rpc_gui->stream_encoder) {
+                pb_bytes_array_t* data = rpc_gui->transmit_frame->content.gui_screen_frame.data;
+                data->size = rpc_gui_stream_encoder_encode(
+                    rpc_gui->stream_encoder, rpc_gui->stream_frame, data->bytes);
+            }
             rpc_send(rpc_gui->session, rpc_gui->transmit_frame);
             transmit_time = furi_get_tick() - transmit_time;
 
@@ -129,6 +141,15 @@ static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context)
     return 0;
 }
 
+static void rpc_system_gui_screen_stream_encoder_free(RpcGuiSystem* rpc_gui) {
+    if(rpc_gui->stream_encoder) {
+        rpc_gui_stream_encoder_free(rpc_gui->stream_encoder);
+        rpc_gui->stream_encoder = NULL;
+        free(rpc_gui->stream_frame);
+        rpc_gui->stream_frame = NULL;
+    }
+}
+
 static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -147,12 +168,19 @@ static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, v
 
         rpc_gui->is_streaming = true;
         size_t framebuffer_size = gui_get_framebuffer_size(rpc_gui->gui);
+        size_t frame_data_size = framebuffer_size;
+        // Delta frames are opt-in, plain framebuffer is sent otherwise
+        if(rpc_session_is_screen_stream_delta(session)) {
+            rpc_gui->stream_encoder = rpc_gui_stream_encoder_alloc(framebuffer_size);
+            rpc_gui->stream_frame = malloc(framebuffer_size);
+            frame_data_size += RPC_GUI_STREAM_OVERHEAD;
+        }
         // Reusable Frame
         rpc_gui->transmit_frame = malloc(sizeof(PB_Main));
         rpc_gui->transmit_frame->which_content = PB_Main_gui_screen_frame_tag;
         rpc_gui->transmit_frame->command_status = PB_CommandStatus_OK;
         rpc_gui->transmit_frame->content.gui_screen_frame.data =
-            malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(framebuffer_size));
+            malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(frame_data_size));
         rpc_gui->transmit_frame->content.gui_screen_frame.data->size = framebuffer_size;
         // Transmission thread for async TX
         rpc_gui->transmit_thread = furi_thread_alloc_ex(
@@ -187,6 +215,7 @@ static void rpc_system_gui_stop_screen_stream_process(const PB_Main* request, vo
         pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
         free(rpc_gui->transmit_frame);
         rpc_gui->transmit_frame = NULL;
+        rpc_system_gui_screen_stream_encoder_free(rpc_gui);
     }
 
     rpc_send_and_release_empty(session, request->command_id, PB_CommandStatus_OK);
@@ -473,6 +502,7 @@ void rpc_system_gui_free(void* context) {
         pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
         free(rpc_gui->transmit_frame);
         rpc_gui->transmit_frame = NULL;
+        rpc_system_gui_screen_stream_encoder_free(rpc_gui);
     }
     furi_record_close(RECORD_GUI);
     free(rpc_gui);
@@ -0,0 +1,148 @@
+#include "rpc_gui_stream.h"
+
+#include <furi.h>
+#include <toolbox/compress.h>
+
+// Heatshrink output may be bigger than input before compress_encode falls back to raw
+#define RPC_GUI_STREAM_COMPRESS_BUFFER_SIZE(frame_size) ((frame_size) + (frame_size) / 4 + 16)
+
+struct RpcGuiStreamEncoder {
+    Compress* compress;
+    size_t frame_size;
+    uint32_t frame_count;
+    uint8_t* last_frame;
+    uint8_t* delta;
+    uint8_t* compressed;
+};
+
+struct RpcGuiStreamDecoder {
+    Compress* compress;
+    size_t frame_size;
+    bool has_key_frame;
+    uint8_t* frame;
+    uint8_t* delta;
+};
+
+RpcGuiStreamEncoder* rpc_gui_stream_encoder_alloc(size_t frame_size) {
+    furi_check(frame_size);
+
+    RpcGuiStreamEncoder* encoder = malloc(sizeof(RpcGuiStreamEncoder));
+    encoder->compress = compress_alloc(frame_size + RPC_GUI_STREAM_OVERHEAD);
+    encoder->frame_size = frame_size;
+    encoder->frame_count = 0;
+    encoder->last_frame = malloc(frame_size);
+    encoder->delta = malloc(frame_size);
+    encoder->compressed = malloc(RPC_GUI_STREAM_COMPRESS_BUFFER_SIZE(frame_size));
+
+    return encoder;
+}
+
+void rpc_gui_stream_encoder_free(RpcGuiStreamEncoder* encoder) {
+    furi_check(encoder);
+
+    compress_free(encoder->compress);
+    free(encoder->last_frame);
+    free(encoder->delta);
+    free(encoder->compressed);
+    free(encoder);
+}
+
+void rpc_gui_stream_encoder_reset(RpcGuiStreamEncoder* encoder) {
+    furi_check(encoder);
+    encoder->frame_count = 0;
+}
+
+size_t rpc_gui_stream_encoder_encode(
+    RpcGuiStreamEncoder* encoder,
+    const uint8_t* frame,
+    uint8_t* out) {
+    furi_check(encoder);
+    furi_check(frame);
+    furi_check(out);
+
+    const bool is_key_frame = (encoder->frame_count % RPC_GUI_STREAM_KEYFRAME_INTERVAL) == 0;
+    encoder->frame_count++;
+
+    // Frame may be updated meanwhile, every byte is read once to keep last_frame in sync
+    if(is_key_frame) {
+        memcpy(encoder->delta, frame, encoder->frame_size);
+        memcpy(encoder->last_frame, encoder->delta, encoder->frame_size);
+    } else {
+        for(size_t i = 0; i < encoder->frame_size; i++) {
+            const uint8_t data = frame[i];
+            encoder->delta[i] = data ^ encoder->last_frame[i];
+            encoder->last_frame[i] = data;
+        }
+    }
+
+    size_t compressed_size = 0;
+    bool compressed = compress_encode(
+        encoder->compress,
+        encoder->delta,
+        encoder->frame_size,
+        encoder->compressed,
+        RPC_GUI_STREAM_COMPRESS_BUFFER_SIZE(encoder->frame_size),
+        &compressed_size);
+    // Compressed or raw data is never bigger than the frame and a flag byte
+    furi_check(compressed && compressed_size <= encoder->frame_size + 1);
+
+    out[0] = is_key_frame ? RpcGuiStreamFrameTypeKey : RpcGuiStreamFrameTypeDelta;
+    memcpy(&out[1], encoder->compressed, compressed_size);
+
+    return compressed_size + 1;
+}
+
+RpcGuiStreamDecoder* rpc_gui_stream_decoder_alloc(size_t frame_size) {
+    furi_check(frame_size);
+
+    RpcGuiStreamDecoder* decoder = malloc(sizeof(RpcGuiStreamDecoder));
+    decoder->compress = compress_alloc(frame_size + RPC_GUI_STREAM_OVERHEAD);
+    decoder->frame_size = frame_size;
+    decoder->has_key_frame = false;
+    decoder->frame = malloc(frame_size);
+    decoder->delta = malloc(frame_size + RPC_GUI_STREAM_OVERHEAD);
+
+    return decoder;
+}
+
+void rpc_gui_stream_decoder_free(RpcGuiStreamDecoder* decoder) {
+    furi_check(decoder);
+
+    compress_free(decoder->compress);
+    free(decoder->frame);
+    free(decoder->delta);
+    free(decoder);
+}
+
+const uint8_t*
+    rpc_gui_stream_decoder_decode(RpcGuiStreamDecoder* decoder, const uint8_t* data, size_t size) {
+    furi_check(decoder);
+    furi_check(data);
+
+    if(size < 2 || size > decoder->frame_size + RPC_GUI_STREAM_OVERHEAD) return NULL;
+
+    const uint8_t type = data[0];
+    if(type != RpcGuiStreamFrameTypeKey && type != RpcGuiStreamFrameTypeDelta) return NULL;
+    if(type == RpcGuiStreamFrameTypeDelta && !decoder->has_key_frame) return NULL;
+
+    size_t decoded_size = 0;
+    bool decoded = compress_decode(
+        decoder->compress,
+        (uint8_t*)&data[1],
+        size - 1,
+        decoder->delta,
+        decoder->frame_size + RPC_GUI_STREAM_OVERHEAD,
+        &decoded_size);
+    if(!decoded || decoded_size != decoder->frame_size) return NULL;
+
+    if(type == RpcGuiStreamFrameTypeKey) {
+        memcpy(decoder->frame, decoder->delta, decoder->frame_size);
+        decoder->has_key_frame = true;
+    } else {
+        for(size_t i = 0; i < decoder->frame_size; i++) {
+            decoder->frame[i] ^= decoder->delta[i];
+        }
+    }
+
+    return decoder->frame;
+}
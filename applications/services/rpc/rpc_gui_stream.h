@@ -0,0 +1,97 @@
+/**
+ * @file rpc_gui_stream.h
+ * RPC: screen stream frame codec
+ *
+ * Encoded frame is a type byte followed by compress_encode() output:
+ * - key frame: the framebuffer itself
+ * - delta frame: framebuffer XOR previously encoded frame
+ *
+ * Static parts of the screen are zero in a delta frame and compress to almost
+ * nothing. The first frame after reset and every RPC_GUI_STREAM_KEYFRAME_INTERVAL
+ * frame are key frames.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RPC_GUI_STREAM_KEYFRAME_INTERVAL (64U)
+
+/** Encoded frame size limit over the framebuffer size */
+#define RPC_GUI_STREAM_OVERHEAD (8U)
+
+typedef enum {
+    RpcGuiStreamFrameTypeKey = 0x01,
+    RpcGuiStreamFrameTypeDelta = 0x02,
+} RpcGuiStreamFrameType;
+
+typedef struct RpcGuiStreamEncoder RpcGuiStreamEncoder;
+
+typedef struct RpcGuiStreamDecoder RpcGuiStreamDecoder;
+
+/** Allocate encoder
+ *
+ * @param      frame_size  framebuffer size
+ *
+ * @return     RpcGuiStreamEncoder instance
+ */
+RpcGuiStreamEncoder* rpc_gui_stream_encoder_alloc(size_t frame_size);
+
+/** Free encoder
+ *
+ * @param      encoder  RpcGuiStreamEncoder instance
+ */
+void rpc_gui_stream_encoder_free(RpcGuiStreamEncoder* encoder);
+
+/** Make the next frame a key frame
+ *
+ * @param      encoder  RpcGuiStreamEncoder instance
+ */
+void rpc_gui_stream_encoder_reset(RpcGuiStreamEncoder* encoder);
+
+/** Encode frame
+ *
+ * @param      encoder   RpcGuiStreamEncoder instance
+ * @param      frame     framebuffer, frame_size bytes
+ * @param      out       output buffer, frame_size + RPC_GUI_STREAM_OVERHEAD bytes
+ *
+ * @return     encoded size
+ */
+size_t rpc_gui_stream_encoder_encode(
+    RpcGuiStreamEncoder* encoder,
+    const uint8_t* frame,
+    uint8_t* out);
+
+/** Allocate decoder
+ *
+ * @param      frame_size  framebuffer size
+ *
+ * @return     RpcGuiStreamDecoder instance
+ */
+RpcGuiStreamDecoder* rpc_gui_stream_decoder_alloc(size_t frame_size);
+
+/** Free decoder
+ *
+ * @param      decoder  RpcGuiStreamDecoder instance
+ */
+void rpc_gui_stream_decoder_free(RpcGuiStreamDecoder* decoder);
+
+/** Decode frame
+ *
+ * @param      decoder  RpcGuiStreamDecoder instance
+ * @param      data     encoded frame
+ * @param      size     encoded frame size
+ *
+ * @return     decoded framebuffer or NULL if frame is damaged or a delta came before a key frame
+ */
+const uint8_t*
+    rpc_gui_stream_decoder_decode(RpcGuiStreamDecoder* decoder, const uint8_t* data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -25,6 +25,16 @@ void rpc_send_and_release_empty(RpcSession* session, uint32_t command_id, PB_Com
 
 void rpc_add_handler(RpcSession* session, pb_size_t message_tag, RpcHandler* handler);
 
+/** Send delta encoded screen stream frames to this session, see rpc_gui_stream.h
+ *
+ * Client opts in on any transport by getting `rpc.screen_stream.delta=1`
+ * property, the response holds the new value. Older firmware rejects the key.
+ * CLI sessions can also opt in with `start_rpc_session screen_delta`.
+ */
+void rpc_session_set_screen_stream_delta(RpcSession* session, bool enable);
+
+bool rpc_session_is_screen_stream_delta(RpcSession* session);
+
 void* rpc_system_system_alloc(RpcSession* session);
 void* rpc_system_storage_alloc(RpcSession* session);
 void rpc_system_storage_free(void* ctx);
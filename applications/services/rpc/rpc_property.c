@@ -11,6 +11,7 @@
 #define PROPERTY_CATEGORY_DEVICE_INFO "devinfo"
 #define PROPERTY_CATEGORY_POWER_INFO "pwrinfo"
 #define PROPERTY_CATEGORY_POWER_DEBUG "pwrdebug"
+#define PROPERTY_CATEGORY_RPC "rpc"
 
 typedef struct {
     RpcSession* session;
@@ -41,6 +42,22 @@ static void
     }
 }
 
+/** Apply `key=value` assignment to rpc session property, returns false on unknown key or value */
+static bool rpc_system_property_rpc_set(RpcSession* session, FuriString* subkey) {
+    const size_t eq_idx = furi_string_search_char(subkey, '=');
+    if(eq_idx == FURI_STRING_FAILURE) return true;
+
+    const char* value = furi_string_get_cstr(subkey) + eq_idx + 1;
+    const bool enable = !strcmp(value, "1");
+    if(!enable && strcmp(value, "0")) return false;
+
+    furi_string_left(subkey, eq_idx);
+    if(furi_string_cmp(subkey, "screen_stream.delta")) return false;
+
+    rpc_session_set_screen_stream_delta(session, enable);
+    return true;
+}
+
 static void rpc_system_property_get_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(request->which_content == PB_Main_property_get_request_tag);
@@ -81,6 +98,14 @@ static void rpc_system_property_get_process(const PB_Main* request, void* contex
         furi_hal_power_info_get(rpc_system_property_get_callback, '.', &property_context);
     } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_POWER_DEBUG)) {
         furi_hal_power_debug_get(rpc_system_property_get_callback, &property_context);
+    } else if(
+        !furi_string_cmp(topkey, PROPERTY_CATEGORY_RPC) &&
+        rpc_system_property_rpc_set(session, subkey)) {
+        rpc_system_property_get_callback(
+            "screen_stream.delta",
+            rpc_session_is_screen_stream_delta(session) ? "1" : "0",
+            true,
+            &property_context);
     } else {
         rpc_send_and_release_empty(
             session, request->command_id, PB_CommandStatus_ERROR_INVALID_PARAMETERS);
@@ -19,6 +19,9 @@
 
 static const size_t MAX_DATA_SIZE = 512;
 
+// Storage is read and written by blocks of several chunks
+#define RPC_STORAGE_BLOCK_SIZE (2048U)
+
 typedef enum {
     RpcStorageStateIdle = 0,
     RpcStorageStateWriting,
@@ -30,8 +33,41 @@ typedef struct {
     File* file;
     RpcStorageState state;
     uint32_t current_command_id;
+    uint8_t* write_buffer;
+    size_t write_buffer_size;
 } RpcStorageSystem;
 
+static bool rpc_system_storage_write_flush(RpcStorageSystem* rpc_storage) {
+    bool success = true;
+
+    if(rpc_storage->write_buffer_size) {
+        size_t written_size = storage_file_write(
+            rpc_storage->file, rpc_storage->write_buffer, rpc_storage->write_buffer_size);
+        success = (written_size == rpc_storage->write_buffer_size);
+        rpc_storage->write_buffer_size = 0;
+    }
+
+    return success;
+}
+
+static bool rpc_system_storage_write_buffered(
+    RpcStorageSystem* rpc_storage,
+    const uint8_t* data,
+    size_t size) {
+    if(rpc_storage->write_buffer_size + size > RPC_STORAGE_BLOCK_SIZE) {
+        if(!rpc_system_storage_write_flush(rpc_storage)) return false;
+    }
+
+    if(size >= RPC_STORAGE_BLOCK_SIZE) {
+        return storage_file_write(rpc_storage->file, data, size) == size;
+    }
+
+    memcpy(&rpc_storage->write_buffer[rpc_storage->write_buffer_size], data, size);
+    rpc_storage->write_buffer_size += size;
+
+    return true;
+}
+
 static void rpc_system_storage_reset_state(
     RpcStorageSystem* rpc_storage,
     RpcSession* session,
@@ -48,6 +84,10 @@ static void rpc_system_storage_reset_state(
         }
 
         if(rpc_storage->state == RpcStorageStateWriting) {
+            // Keep chunks received before the interruption
+            rpc_system_storage_write_flush(rpc_storage);
+            free(rpc_storage->write_buffer);
+            rpc_storage->write_buffer = NULL;
             storage_file_close(rpc_storage->file);
             storage_file_free(rpc_storage->file);
             furi_record_close(RECORD_STORAGE);
@@ -376,40 +416,48 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
 
     if(fs_operation_success) {
         size_t size_left = storage_file_size(file);
+        size_t file_left = size_left;
+
+        // Chunk data is reused, response is sent without release
+        pb_bytes_array_t* data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(MAX_DATA_SIZE));
+        uint8_t* block = malloc(RPC_STORAGE_BLOCK_SIZE);
+        size_t block_size = 0;
+        size_t block_offset = 0;
+
         do {
             response->command_id = request->command_id;
             response->which_content = PB_Main_storage_read_response_tag;
             response->command_status = PB_CommandStatus_OK;
+            response->content.storage_read_response.has_file = true;
+            response->content.storage_read_response.file.data = data;
 
             size_t read_size = MIN(size_left, MAX_DATA_SIZE);
-            if(read_size) {
-                response->content.storage_read_response.has_file = true;
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
-                uint8_t* buffer = &response->content.storage_read_response.file.data->bytes[0];
-                uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
-
-                *read_size_msg = storage_file_read(file, buffer, read_size);
-                size_left -= *read_size_msg;
-                fs_operation_success = (*read_size_msg == read_size);
-
-                response->has_next = fs_operation_success && (size_left > 0);
-            } else {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(0));
-                response->content.storage_read_response.file.data->size = 0;
-#pragma GCC diagnostic pop
-                response->content.storage_read_response.has_file = true;
-                response->has_next = false;
-                fs_operation_success = true;
+            if(block_offset + read_size > block_size) {
+                // Move the tail to the start and read ahead the next block
+                block_size -= block_offset;
+                memmove(block, &block[block_offset], block_size);
+                block_offset = 0;
+
+                size_t block_read_size = MIN(file_left, RPC_STORAGE_BLOCK_SIZE - block_size);
+                size_t block_read = storage_file_read(file, &block[block_size], block_read_size);
+                file_left -= block_read;
+                block_size += block_read;
+                fs_operation_success = (block_read == block_read_size);
+                if(!fs_operation_success) break;
             }
 
-            if(fs_operation_success) {
-                rpc_send_and_release(session, response);
-            }
-        } while((size_left != 0) && fs_operation_success);
+            memcpy(data->bytes, &block[block_offset], read_size);
+            data->size = read_size;
+            block_offset += read_size;
+            size_left -= read_size;
+
+            response->has_next = (size_left > 0);
+            rpc_send(session, response);
+        } while(size_left != 0);
+
+        response->content.storage_read_response.file.data = NULL;
+        free(block);
+        free(data);
     }
 
     if(!fs_operation_success) {
@@ -455,6 +503,8 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
         rpc_storage->file = storage_file_alloc(rpc_storage->api);
         rpc_storage->current_command_id = request->command_id;
         rpc_storage->state = RpcStorageStateWriting;
+        rpc_storage->write_buffer = malloc(RPC_STORAGE_BLOCK_SIZE);
+        rpc_storage->write_buffer_size = 0;
         const char* path = request->content.storage_write_request.path;
         fs_operation_success =
             storage_file_open(rpc_storage->file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
@@ -469,8 +519,12 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
            request->content.storage_write_request.file.data->size) {
             uint8_t* buffer = request->content.storage_write_request.file.data->bytes;
             size_t buffer_size = request->content.storage_write_request.file.data->size;
-            size_t written_size = storage_file_write(file, buffer, buffer_size);
-            fs_operation_success = (written_size == buffer_size);
+            fs_operation_success =
+                rpc_system_storage_write_buffered(rpc_storage, buffer, buffer_size);
+        }
+
+        if(fs_operation_success && !request->has_next) {
+            fs_operation_success = rpc_system_storage_write_flush(rpc_storage);
         }
 
         send_response = !request->has_next;
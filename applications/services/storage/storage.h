@@ -246,6 +246,29 @@ bool storage_dir_close(File* file);
  */
 bool storage_dir_read(File* file, FileInfo* fileinfo, char* name, uint16_t name_length);
 
+/**
+ * @brief Get up to count next items in the directory at once.
+ *
+ * Works like calling storage_dir_read() count times, but takes a single
+ * request to the storage service instead of one per item.
+ *
+ * Reading stops at the first failed item and the file error id is set as
+ * by storage_dir_read(), i.e. to FSE_NOT_EXIST at the end of the directory.
+ *
+ * @param file pointer to a file instance representing the directory in question.
+ * @param fileinfo pointer to an array of count FileInfo structures (may be NULL).
+ * @param names pointer to the buffer of count * name_length bytes to contain the names, item i name is at names + i * name_length (may be NULL).
+ * @param name_length maximum capacity of a single name, in bytes.
+ * @param count maximum number of items to read.
+ * @return number of items that were successfully read.
+ */
+size_t storage_dir_read_batch(
+    File* file,
+    FileInfo* fileinfo,
+    char* names,
+    uint16_t name_length,
+    size_t count);
+
 /**
  * @brief Change the access position to first item in the directory.
  *
@@ -44,6 +44,7 @@
 #define S_RETURN_BOOL (return_data.bool_value);
 #define S_RETURN_UINT16 (return_data.uint16_value);
 #define S_RETURN_UINT64 (return_data.uint64_value);
+#define S_RETURN_SIZE (return_data.size_value);
 #define S_RETURN_ERROR (return_data.error_value);
 #define S_RETURN_CSTRING (return_data.cstring_value);
 
@@ -404,6 +405,29 @@ bool storage_dir_read(File* file, FileInfo* fileinfo, char* name, uint16_t name_
     return S_RETURN_BOOL;
 }
 
+size_t storage_dir_read_batch(
+    File* file,
+    FileInfo* fileinfo,
+    char* names,
+    uint16_t name_length,
+    size_t count) {
+    S_FILE_API_PROLOGUE;
+    S_API_PROLOGUE;
+
+    SAData data = {
+        .dreadbatch = {
+            .file = file,
+            .fileinfo = fileinfo,
+            .names = names,
+            .name_length = name_length,
+            .count = count,
+        }};
+
+    S_API_MESSAGE(StorageCommandDirReadBatch);
+    S_API_EPILOGUE;
+    return S_RETURN_SIZE;
+}
+
 bool storage_dir_rewind(File* file) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
@@ -45,6 +45,14 @@ typedef struct {
     uint16_t name_length;
 } SADataDRead;
 
+typedef struct {
+    File* file;
+    FileInfo* fileinfo;
+    char* names;
+    uint16_t name_length;
+    size_t count;
+} SADataDReadBatch;
+
 typedef struct {
     const char* path;
     uint32_t* timestamp;
@@ -101,6 +109,7 @@ typedef union {
 
     SADataDOpen dopen;
     SADataDRead dread;
+    SADataDReadBatch dreadbatch;
 
     SADataCTimestamp ctimestamp;
     SADataCStat cstat;
@@ -120,6 +129,7 @@ typedef union {
     bool bool_value;
     uint16_t uint16_value;
     uint64_t uint64_value;
+    size_t size_value;
     FS_Error error_value;
     const char* cstring_value;
 } SAReturn;
@@ -151,6 +161,7 @@ typedef enum {
     StorageCommandCommonResolvePath,
     StorageCommandSDMount,
     StorageCommandCommonEquivalentPath,
+    StorageCommandDirReadBatch,
 } StorageCommand;
 
 typedef struct {
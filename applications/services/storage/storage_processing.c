@@ -320,6 +320,36 @@ bool storage_process_dir_read(
     return ret;
 }
 
+static size_t storage_process_dir_read_batch(
+    Storage* app,
+    File* file,
+    FileInfo* fileinfo,
+    char* names,
+    const uint16_t name_length,
+    size_t count) {
+    size_t read_count = 0;
+    StorageData* storage = get_storage_by_file(file, app->storage);
+
+    if(storage == NULL) {
+        file->error_id = FSE_INVALID_PARAMETER;
+    } else {
+        for(; read_count < count; read_count++) {
+            bool ret = false;
+            FS_CALL(
+                storage,
+                dir.read(
+                    storage,
+                    file,
+                    fileinfo ? &fileinfo[read_count] : NULL,
+                    names ? &names[read_count * name_length] : NULL,
+                    name_length));
+            if(!ret) break;
+        }
+    }
+
+    return read_count;
+}
+
 bool storage_process_dir_rewind(Storage* app, File* file) {
     bool ret = false;
     StorageData* storage = get_storage_by_file(file, app->storage);
@@ -647,6 +677,15 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
         message->return_data->bool_value =
             storage_process_dir_rewind(app, message->data->file.file);
         break;
+    case StorageCommandDirReadBatch:
+        message->return_data->size_value = storage_process_dir_read_batch(
+            app,
+            message->data->dreadbatch.file,
+            message->data->dreadbatch.fileinfo,
+            message->data->dreadbatch.names,
+            message->data->dreadbatch.name_length,
+            message->data->dreadbatch.count);
+        break;
 
     // Common operations
     case StorageCommandCommonTimestamp:
@@ -255,8 +255,15 @@ static int32_t js_thread(void* arg) {
 
     mjs_set_exec_flags_poller(mjs, js_exit_flag_poll);
 
+    // Parsed bcode is kept in a .jsc file next to the script, next launch loads it
+    mjs_set_generate_jsc(mjs, 1);
     mjs_err_t err = mjs_exec_file(mjs, furi_string_get_cstr(worker->path), NULL);
 
+    int load_cached = 0;
+    uint32_t load_time_us = mjs_get_load_time_us(mjs, &load_cached);
+    FURI_LOG_D(
+        TAG, "Script %s in %lu us", load_cached ? "loaded from .jsc" : "parsed", load_time_us);
+
 #ifdef JS_DEBUG
     if(furi_hal_rtc_is_flag_set(FuriHalRtcFlagDebug)) {
         FuriString* dump_path = furi_string_alloc_set(worker->path);
@@ -280,6 +287,15 @@ static int32_t js_thread(void* arg) {
 
     if(err != MJS_OK) {
         FURI_LOG_E(TAG, "Exec error: %s", mjs_strerror(mjs, err));
+        if(load_cached) {
+            // Stale .jsc that passed the checks must not fail every launch, parse next time
+            FuriString* jsc_path =
+                furi_string_alloc_printf("%sc", furi_string_get_cstr(worker->path));
+            Storage* storage = furi_record_open(RECORD_STORAGE);
+            storage_simply_remove(storage, furi_string_get_cstr(jsc_path));
+            furi_record_close(RECORD_STORAGE);
+            furi_string_free(jsc_path);
+        }
         if(worker->app_callback) {
             worker->app_callback(JsThreadEventError, mjs_strerror(mjs, err), worker->context);
         }
@@ -296,6 +312,16 @@ static int32_t js_thread(void* arg) {
         }
     }
 
+    struct mjs_gc_stats gc_stats;
+    mjs_gc_get_stats(mjs, &gc_stats);
+    FURI_LOG_D(
+        TAG,
+        "GC: %lu collections, pause max %lu us, avg %lu us, %lu bytes reclaimed",
+        gc_stats.collections,
+        gc_stats.pause_max_us,
+        gc_stats.pause_avg_us,
+        (uint32_t)gc_stats.reclaimed);
+
     js_modules_destroy(worker->modules);
     mjs_destroy(mjs);
 
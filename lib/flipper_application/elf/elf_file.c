@@ -166,6 +166,13 @@ static bool elf_read_symbol(ELFFile* elf, int n, Elf32_Sym* sym, FuriString* nam
 }
 
 static ELFSection* elf_section_of(ELFFile* elf, int index) {
+    if(elf->sections_by_index) {
+        if(index > 0 && (size_t)index < elf->sections_count) {
+            return elf->sections_by_index[index];
+        }
+        return NULL;
+    }
+
     ELFSectionDict_it_t it;
     for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
         ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
@@ -177,6 +184,22 @@ static ELFSection* elf_section_of(ELFFile* elf, int index) {
     return NULL;
 }
 
+/** Map section indexes to loaded sections, relocations look them up per symbol */
+static void elf_file_index_sections(ELFFile* elf) {
+    elf->sections_by_index = malloc(sizeof(ELFSection*) * elf->sections_count);
+    memset(elf->sections_by_index, 0, sizeof(ELFSection*) * elf->sections_count);
+
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
+        // Sections known only by relocations are not loaded and have no index
+        uint16_t index = itref->value.sec_idx;
+        if(index && index < elf->sections_count && !elf->sections_by_index[index]) {
+            elf->sections_by_index[index] = &itref->value;
+        }
+    }
+}
+
 static Elf32_Addr elf_address_of(ELFFile* elf, Elf32_Sym* sym, const char* sName) {
     if(sym->st_shndx == SHN_UNDEF) {
         Elf32_Addr addr = 0;
@@ -904,6 +927,7 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     ELFSectionDict_it_t it;
 
     AddressCache_init(elf->relocation_cache);
+    elf_file_index_sections(elf);
 
     for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
         ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
@@ -929,6 +953,8 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     FURI_LOG_D(TAG, "Relocation cache size: %u", AddressCache_size(elf->relocation_cache));
     FURI_LOG_D(TAG, "Trampoline cache size: %u", AddressCache_size(elf->trampoline_cache));
     AddressCache_clear(elf->relocation_cache);
+    free(elf->sections_by_index);
+    elf->sections_by_index = NULL;
 
     {
         size_t total_size = 0;
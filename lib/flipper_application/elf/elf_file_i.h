@@ -38,6 +38,7 @@ struct ELFFile {
     off_t symbol_table_strings;
     off_t entry;
     ELFSectionDict_t sections;
+    ELFSection** sections_by_index;
 
     AddressCache_t relocation_cache;
     AddressCache_t trampoline_cache;
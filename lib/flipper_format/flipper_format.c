@@ -12,6 +12,9 @@
 struct FlipperFormat {
     Stream* stream;
     bool strict_mode;
+    bool key_index_enabled;
+    bool key_index_dirty;
+    FlipperFormatKeyIndex* key_index;
 };
 
 static const char* const flipper_format_filetype_key = "Filetype";
@@ -21,42 +24,92 @@ Stream* flipper_format_get_raw_stream(FlipperFormat* flipper_format) {
     return flipper_format->stream;
 }
 
-/********************************** Public **********************************/
-
-FlipperFormat* flipper_format_string_alloc(void) {
+static FlipperFormat* flipper_format_alloc(Stream* stream) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
-    flipper_format->stream = string_stream_alloc();
+    flipper_format->stream = stream;
     flipper_format->strict_mode = false;
+    flipper_format->key_index_enabled = false;
+    flipper_format->key_index_dirty = true;
+    flipper_format->key_index = NULL;
     return flipper_format;
 }
 
+static void flipper_format_key_index_reset(FlipperFormat* flipper_format) {
+    if(flipper_format->key_index) {
+        flipper_format_stream_key_index_free(flipper_format->key_index);
+        flipper_format->key_index = NULL;
+    }
+    flipper_format->key_index_dirty = true;
+}
+
+static FlipperFormatKeyIndex* flipper_format_key_index_get(FlipperFormat* flipper_format) {
+    if(!flipper_format->key_index_enabled) return NULL;
+
+    // Raw stream could be modified behind our back
+    if(flipper_format->key_index &&
+       !flipper_format_stream_key_index_is_actual(
+           flipper_format->key_index, flipper_format->stream)) {
+        flipper_format_key_index_reset(flipper_format);
+    }
+
+    if(flipper_format->key_index_dirty) {
+        // Stays NULL if index can't be built, lookups fall back to scan
+        flipper_format->key_index = flipper_format_stream_key_index_build(flipper_format->stream);
+        flipper_format->key_index_dirty = false;
+    }
+
+    return flipper_format->key_index;
+}
+
+static bool
+    flipper_format_write_value_line(FlipperFormat* flipper_format, FlipperStreamWriteData* data) {
+    flipper_format_key_index_reset(flipper_format);
+    return flipper_format_stream_write_value_line(flipper_format->stream, data);
+}
+
+static bool flipper_format_delete_key_and_write(
+    FlipperFormat* flipper_format,
+    FlipperStreamWriteData* data) {
+    flipper_format_key_index_reset(flipper_format);
+    return flipper_format_stream_delete_key_and_write(
+        flipper_format->stream, data, flipper_format->strict_mode);
+}
+
+/********************************** Public **********************************/
+
+FlipperFormat* flipper_format_string_alloc(void) {
+    return flipper_format_alloc(string_stream_alloc());
+}
+
 FlipperFormat* flipper_format_file_alloc(Storage* storage) {
-    FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
-    flipper_format->stream = file_stream_alloc(storage);
-    flipper_format->strict_mode = false;
-    return flipper_format;
+    return flipper_format_alloc(file_stream_alloc(storage));
 }
 
 FlipperFormat* flipper_format_buffered_file_alloc(Storage* storage) {
-    FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
-    flipper_format->stream = buffered_file_stream_alloc(storage);
-    flipper_format->strict_mode = false;
-    return flipper_format;
+    return flipper_format_alloc(buffered_file_stream_alloc(storage));
 }
 
 bool flipper_format_file_open_existing(FlipperFormat* flipper_format, const char* path) {
     furi_check(flipper_format);
-    return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
+    flipper_format_key_index_reset(flipper_format);
+    bool result =
+        file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
+    if(result) flipper_format_key_index_get(flipper_format);
+    return result;
 }
 
 bool flipper_format_buffered_file_open_existing(FlipperFormat* flipper_format, const char* path) {
     furi_check(flipper_format);
-    return buffered_file_stream_open(
+    flipper_format_key_index_reset(flipper_format);
+    bool result = buffered_file_stream_open(
         flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
+    if(result) flipper_format_key_index_get(flipper_format);
+    return result;
 }
 
 bool flipper_format_file_open_append(FlipperFormat* flipper_format, const char* path) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
 
     bool result =
         file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_APPEND);
@@ -88,32 +141,38 @@ bool flipper_format_file_open_append(FlipperFormat* flipper_format, const char*
 
 bool flipper_format_file_open_always(FlipperFormat* flipper_format, const char* path) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS);
 }
 
 bool flipper_format_buffered_file_open_always(FlipperFormat* flipper_format, const char* path) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return buffered_file_stream_open(
         flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS);
 }
 
 bool flipper_format_file_open_new(FlipperFormat* flipper_format, const char* path) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_NEW);
 }
 
 bool flipper_format_file_close(FlipperFormat* flipper_format) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return file_stream_close(flipper_format->stream);
 }
 
 bool flipper_format_buffered_file_close(FlipperFormat* flipper_format) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return buffered_file_stream_close(flipper_format->stream);
 }
 
 void flipper_format_free(FlipperFormat* flipper_format) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     stream_free(flipper_format->stream);
     free(flipper_format);
 }
@@ -122,6 +181,12 @@ void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_m
     flipper_format->strict_mode = strict_mode;
 }
 
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool key_index) {
+    furi_check(flipper_format);
+    flipper_format->key_index_enabled = key_index;
+    flipper_format_key_index_reset(flipper_format);
+}
+
 bool flipper_format_rewind(FlipperFormat* flipper_format) {
     furi_check(flipper_format);
     return stream_rewind(flipper_format->stream);
@@ -135,7 +200,8 @@ bool flipper_format_seek_to_end(FlipperFormat* flipper_format) {
 bool flipper_format_key_exist(FlipperFormat* flipper_format, const char* key) {
     size_t pos = stream_tell(flipper_format->stream);
     stream_seek(flipper_format->stream, 0, StreamOffsetFromStart);
-    bool result = flipper_format_stream_seek_to_key(flipper_format->stream, key, false);
+    bool result = flipper_format_stream_seek_to_key_indexed(
+        flipper_format->stream, flipper_format_key_index_get(flipper_format), key, false);
     stream_seek(flipper_format->stream, pos, StreamOffsetFromStart);
 
     return result;
@@ -174,14 +240,24 @@ bool flipper_format_get_value_count(
     const char* key,
     uint32_t* count) {
     furi_check(flipper_format);
-    return flipper_format_stream_get_value_count(
-        flipper_format->stream, key, count, flipper_format->strict_mode);
+    return flipper_format_stream_get_value_count_indexed(
+        flipper_format->stream,
+        flipper_format_key_index_get(flipper_format),
+        key,
+        count,
+        flipper_format->strict_mode);
 }
 
 bool flipper_format_read_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
     furi_check(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream, key, FlipperStreamValueStr, data, 1, flipper_format->strict_mode);
+    return flipper_format_stream_read_value_line_indexed(
+        flipper_format->stream,
+        flipper_format_key_index_get(flipper_format),
+        key,
+        FlipperStreamValueStr,
+        data,
+        1,
+        flipper_format->strict_mode);
 }
 
 bool flipper_format_write_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
@@ -192,7 +268,7 @@ bool flipper_format_write_string(FlipperFormat* flipper_format, const char* key,
         .data = furi_string_get_cstr(data),
         .data_size = 1,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -207,7 +283,7 @@ bool flipper_format_write_string_cstr(
         .data = data,
         .data_size = 1,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -217,8 +293,9 @@ bool flipper_format_read_hex_uint64(
     uint64_t* data,
     const uint16_t data_size) {
     furi_check(flipper_format);
-    return flipper_format_stream_read_value_line(
+    return flipper_format_stream_read_value_line_indexed(
         flipper_format->stream,
+        flipper_format_key_index_get(flipper_format),
         key,
         FlipperStreamValueHexUint64,
         data,
@@ -238,7 +315,7 @@ bool flipper_format_write_hex_uint64(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -248,8 +325,9 @@ bool flipper_format_read_uint32(
     uint32_t* data,
     const uint16_t data_size) {
     furi_check(flipper_format);
-    return flipper_format_stream_read_value_line(
+    return flipper_format_stream_read_value_line_indexed(
         flipper_format->stream,
+        flipper_format_key_index_get(flipper_format),
         key,
         FlipperStreamValueUint32,
         data,
@@ -269,7 +347,7 @@ bool flipper_format_write_uint32(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -278,8 +356,9 @@ bool flipper_format_read_int32(
     const char* key,
     int32_t* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
+    return flipper_format_stream_read_value_line_indexed(
         flipper_format->stream,
+        flipper_format_key_index_get(flipper_format),
         key,
         FlipperStreamValueInt32,
         data,
@@ -299,7 +378,7 @@ bool flipper_format_write_int32(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -308,8 +387,9 @@ bool flipper_format_read_bool(
     const char* key,
     bool* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
+    return flipper_format_stream_read_value_line_indexed(
         flipper_format->stream,
+        flipper_format_key_index_get(flipper_format),
         key,
         FlipperStreamValueBool,
         data,
@@ -329,7 +409,7 @@ bool flipper_format_write_bool(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -338,8 +418,9 @@ bool flipper_format_read_float(
     const char* key,
     float* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
+    return flipper_format_stream_read_value_line_indexed(
         flipper_format->stream,
+        flipper_format_key_index_get(flipper_format),
         key,
         FlipperStreamValueFloat,
         data,
@@ -359,7 +440,7 @@ bool flipper_format_write_float(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -368,8 +449,9 @@ bool flipper_format_read_hex(
     const char* key,
     uint8_t* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
+    return flipper_format_stream_read_value_line_indexed(
         flipper_format->stream,
+        flipper_format_key_index_get(flipper_format),
         key,
         FlipperStreamValueHex,
         data,
@@ -389,7 +471,7 @@ bool flipper_format_write_hex(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    bool result = flipper_format_write_value_line(flipper_format, &write_data);
     return result;
 }
 
@@ -400,6 +482,7 @@ bool flipper_format_write_comment(FlipperFormat* flipper_format, FuriString* dat
 
 bool flipper_format_write_comment_cstr(FlipperFormat* flipper_format, const char* data) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return flipper_format_stream_write_comment_cstr(flipper_format->stream, data);
 }
 
@@ -411,8 +494,7 @@ bool flipper_format_delete_key(FlipperFormat* flipper_format, const char* key) {
         .data = NULL,
         .data_size = 0,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -424,8 +506,7 @@ bool flipper_format_update_string(FlipperFormat* flipper_format, const char* key
         .data = furi_string_get_cstr(data),
         .data_size = 1,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -440,8 +521,7 @@ bool flipper_format_update_string_cstr(
         .data = data,
         .data_size = 1,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -457,8 +537,7 @@ bool flipper_format_update_uint32(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -473,8 +552,7 @@ bool flipper_format_update_int32(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -489,8 +567,7 @@ bool flipper_format_update_bool(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -505,8 +582,7 @@ bool flipper_format_update_float(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
@@ -521,8 +597,7 @@ bool flipper_format_update_hex(
         .data = data,
         .data_size = data_size,
     };
-    bool result = flipper_format_stream_delete_key_and_write(
-        flipper_format->stream, &write_data, flipper_format->strict_mode);
+    bool result = flipper_format_delete_key_and_write(flipper_format, &write_data);
     return result;
 }
 
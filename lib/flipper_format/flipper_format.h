@@ -203,6 +203,17 @@ void flipper_format_free(FlipperFormat* flipper_format);
  */
 void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_mode);
 
+/**
+ * Set FlipperFormat key index mode.
+ * Index of all keys is built in one pass on open and key lookups don't rescan the file.
+ * Index is dropped on any write and rebuilt on next lookup, so it's only useful for
+ * files that are read with many rewinds or seeks. Files with too many keys, or when heap is
+ * low, are scanned as usual.
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @param key_index True enables key index. False by default.
+ */
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool key_index);
+
 /**
  * Rewind the RW pointer.
  * @param flipper_format Pointer to a FlipperFormat instance
@@ -1,6 +1,9 @@
 #include <inttypes.h>
 #include <toolbox/hex.h>
 #include <core/check.h>
+#include <core/common_defines.h>
+#include <core/memmgr_heap.h>
+#include <m-array.h>
 #include "flipper_format_stream.h"
 #include "flipper_format_stream_i.h"
 
@@ -121,6 +124,329 @@ bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool str
     return found;
 }
 
+/*
+ * Key index: offsets of all keys in the stream, in file order, with a hash table over them.
+ * Built with the same rules as flipper_format_stream_read_valid_key, so a lookup gives the
+ * same result as a scan from the current position.
+ */
+
+#define FLIPPER_FORMAT_KEY_INDEX_MAX_ENTRIES (1024U)
+#define FLIPPER_FORMAT_KEY_INDEX_MAX_KEY_SIZE (0x7FFFU)
+#define FLIPPER_FORMAT_KEY_INDEX_MIN_BUCKETS (16U)
+#define FLIPPER_FORMAT_KEY_INDEX_MIN_ENTRIES (64U)
+#define FLIPPER_FORMAT_KEY_INDEX_HEAP_RESERVE (4096U)
+#define FLIPPER_FORMAT_KEY_INDEX_NONE (UINT16_MAX)
+
+#define FLIPPER_FORMAT_KEY_INDEX_HASH_INIT (2166136261UL)
+#define FLIPPER_FORMAT_KEY_INDEX_HASH_PRIME (16777619UL)
+
+typedef struct {
+    uint32_t key_start;
+    uint32_t line_end;
+    uint32_t hash;
+    uint16_t key_size : 15; // Raw size, '\r' included
+    uint16_t value_has_delimiter : 1;
+    uint16_t next; // Next entry in the same bucket
+} FlipperFormatKeyIndexEntry;
+
+ARRAY_DEF(FlipperFormatKeyIndexEntryArray, FlipperFormatKeyIndexEntry, M_POD_OPLIST);
+
+struct FlipperFormatKeyIndex {
+    size_t stream_size;
+    FlipperFormatKeyIndexEntryArray_t entries;
+    uint16_t* buckets;
+    size_t buckets_mask;
+};
+
+static inline uint32_t flipper_format_stream_key_hash_step(uint32_t hash, char c) {
+    return (hash ^ (uint8_t)c) * FLIPPER_FORMAT_KEY_INDEX_HASH_PRIME;
+}
+
+static uint32_t flipper_format_stream_key_hash(const char* key) {
+    uint32_t hash = FLIPPER_FORMAT_KEY_INDEX_HASH_INIT;
+    while(*key) {
+        hash = flipper_format_stream_key_hash_step(hash, *key++);
+    }
+    return hash;
+}
+
+// Index is optional, never let it exhaust the heap: malloc failure is fatal
+static bool flipper_format_stream_key_index_heap_check(size_t size) {
+    return memmgr_heap_get_max_free_block() >= size + FLIPPER_FORMAT_KEY_INDEX_HEAP_RESERVE;
+}
+
+static bool flipper_format_stream_key_index_scan(FlipperFormatKeyIndex* index, Stream* stream) {
+    const size_t buffer_size = 64;
+    uint8_t buffer[buffer_size];
+
+    FlipperFormatKeyIndexEntry* entry = NULL;
+    uint32_t hash = FLIPPER_FORMAT_KEY_INDEX_HASH_INIT;
+    size_t entries_reserved = 0;
+    size_t line_start = 0;
+    size_t offset = 0;
+    bool accumulate = true;
+    bool new_line = true;
+    bool error = false;
+
+    while(!error) {
+        size_t was_read = stream_read(stream, buffer, buffer_size);
+        if(was_read == 0) break;
+
+        for(size_t i = 0; i < was_read; i++, offset++) {
+            uint8_t data = buffer[i];
+            if(data == flipper_format_eoln) {
+                if(entry) entry->line_end = offset;
+                entry = NULL;
+                hash = FLIPPER_FORMAT_KEY_INDEX_HASH_INIT;
+                line_start = offset + 1;
+                accumulate = true;
+                new_line = true;
+            } else if(data == flipper_format_eolr) {
+                // ignore
+            } else if(data == flipper_format_comment && new_line) {
+                accumulate = false;
+                new_line = false;
+            } else if(data == flipper_format_delimiter) {
+                if(new_line) {
+                    accumulate = false;
+                    new_line = false;
+                } else if(accumulate) {
+                    size_t key_size = offset - line_start;
+                    size_t entries_count = FlipperFormatKeyIndexEntryArray_size(index->entries);
+                    if((key_size > FLIPPER_FORMAT_KEY_INDEX_MAX_KEY_SIZE) ||
+                       (entries_count >= FLIPPER_FORMAT_KEY_INDEX_MAX_ENTRIES)) {
+                        error = true;
+                        break;
+                    }
+
+                    // Grow explicitly, realloc needs old and new blocks at once
+                    if(entries_count == entries_reserved) {
+                        entries_reserved = MIN(
+                            MAX(entries_reserved * 2, FLIPPER_FORMAT_KEY_INDEX_MIN_ENTRIES),
+                            FLIPPER_FORMAT_KEY_INDEX_MAX_ENTRIES);
+                        if(!flipper_format_stream_key_index_heap_check(
+                               entries_reserved * sizeof(FlipperFormatKeyIndexEntry))) {
+                            error = true;
+                            break;
+                        }
+                        FlipperFormatKeyIndexEntryArray_reserve(index->entries, entries_reserved);
+                    }
+
+                    entry = FlipperFormatKeyIndexEntryArray_push_new(index->entries);
+                    entry->key_start = line_start;
+                    entry->line_end = offset;
+                    entry->hash = hash;
+                    entry->key_size = key_size;
+                    entry->value_has_delimiter = 0;
+                    entry->next = FLIPPER_FORMAT_KEY_INDEX_NONE;
+                    accumulate = false;
+                } else if(entry) {
+                    entry->value_has_delimiter = 1;
+                }
+            } else {
+                new_line = false;
+                if(accumulate) {
+                    hash = flipper_format_stream_key_hash_step(hash, data);
+                }
+            }
+        }
+    }
+
+    if(entry) entry->line_end = offset;
+    index->stream_size = offset;
+
+    return !error && stream_eof(stream);
+}
+
+FlipperFormatKeyIndex* flipper_format_stream_key_index_build(Stream* stream) {
+    furi_check(stream);
+
+    FlipperFormatKeyIndex* index = malloc(sizeof(FlipperFormatKeyIndex));
+    FlipperFormatKeyIndexEntryArray_init(index->entries);
+    index->buckets = NULL;
+
+    size_t position = stream_tell(stream);
+    bool success = false;
+
+    do {
+        if(!stream_rewind(stream)) break;
+        if(!flipper_format_stream_key_index_scan(index, stream)) break;
+
+        size_t entries_count = FlipperFormatKeyIndexEntryArray_size(index->entries);
+        size_t buckets_count = FLIPPER_FORMAT_KEY_INDEX_MIN_BUCKETS;
+        while(buckets_count < entries_count) {
+            buckets_count <<= 1;
+        }
+        if(!flipper_format_stream_key_index_heap_check(sizeof(uint16_t) * buckets_count)) break;
+        index->buckets_mask = buckets_count - 1;
+        index->buckets = malloc(sizeof(uint16_t) * buckets_count);
+        memset(index->buckets, 0xFF, sizeof(uint16_t) * buckets_count);
+
+        // Prepend in reverse, so every bucket chain is in file order
+        for(size_t i = entries_count; i > 0; i--) {
+            FlipperFormatKeyIndexEntry* entry =
+                FlipperFormatKeyIndexEntryArray_get(index->entries, i - 1);
+            uint16_t* bucket = &index->buckets[entry->hash & index->buckets_mask];
+            entry->next = *bucket;
+            *bucket = i - 1;
+        }
+
+        success = true;
+    } while(false);
+
+    if(!stream_seek(stream, position, StreamOffsetFromStart)) {
+        success = false;
+    }
+
+    if(!success) {
+        flipper_format_stream_key_index_free(index);
+        index = NULL;
+    }
+
+    return index;
+}
+
+void flipper_format_stream_key_index_free(FlipperFormatKeyIndex* index) {
+    furi_check(index);
+    FlipperFormatKeyIndexEntryArray_clear(index->entries);
+    free(index->buckets);
+    free(index);
+}
+
+bool flipper_format_stream_key_index_is_actual(FlipperFormatKeyIndex* index, Stream* stream) {
+    furi_check(index);
+    furi_check(stream);
+    return index->stream_size == stream_size(stream);
+}
+
+static bool flipper_format_stream_key_index_seek(Stream* stream, size_t offset) {
+    // Relative seek keeps buffered stream cache when target is close
+    int32_t delta = (int32_t)offset - (int32_t)stream_tell(stream);
+    return (delta == 0) || stream_seek(stream, delta, StreamOffsetFromCurrent);
+}
+
+// Compare key bytes, stream is left at the entry delimiter on match
+static bool flipper_format_stream_key_index_match(
+    Stream* stream,
+    const FlipperFormatKeyIndexEntry* entry,
+    const char* key) {
+    const size_t buffer_size = 32;
+    uint8_t buffer[buffer_size];
+
+    if(!flipper_format_stream_key_index_seek(stream, entry->key_start)) return false;
+
+    bool match = true;
+    size_t left = entry->key_size;
+    while(left && match) {
+        size_t was_read = stream_read(stream, buffer, MIN(left, buffer_size));
+        if(was_read == 0) return false;
+        left -= was_read;
+
+        for(size_t i = 0; (i < was_read) && match; i++) {
+            if(buffer[i] == flipper_format_eolr) continue;
+            match = (*key != '\0') && (buffer[i] == (uint8_t)*key++);
+        }
+    }
+
+    return match && (*key == '\0');
+}
+
+static size_t flipper_format_stream_key_index_lower_bound(
+    FlipperFormatKeyIndex* index,
+    size_t position) {
+    size_t low = 0;
+    size_t high = FlipperFormatKeyIndexEntryArray_size(index->entries);
+
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if(FlipperFormatKeyIndexEntryArray_cget(index->entries, middle)->key_start < position) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+static bool flipper_format_stream_key_index_is_safe_position(
+    Stream* stream,
+    FlipperFormatKeyIndex* index,
+    size_t first,
+    size_t position) {
+    if(position == 0) return true;
+
+    if(first > 0) {
+        const FlipperFormatKeyIndexEntry* previous =
+            FlipperFormatKeyIndexEntryArray_cget(index->entries, first - 1);
+        size_t delimiter = previous->key_start + previous->key_size;
+        size_t line_end = previous->line_end;
+
+        if(position < delimiter) return false;
+        if(position <= line_end) {
+            // Delimiter in the value is taken for a key end
+            return !previous->value_has_delimiter || (position == delimiter) ||
+                   (position == line_end);
+        }
+        if(position == line_end + 1) return true;
+    }
+
+    // Somewhere in a comment or an empty line, check previous character
+    uint8_t data = 0;
+    if(!stream_seek(stream, -1, StreamOffsetFromCurrent)) return false;
+    if(stream_read(stream, &data, 1) != 1) return false;
+    return data == flipper_format_eoln;
+}
+
+bool flipper_format_stream_seek_to_key_indexed(
+    Stream* stream,
+    FlipperFormatKeyIndex* index,
+    const char* key,
+    bool strict_mode) {
+    if(!index) return flipper_format_stream_seek_to_key(stream, key, strict_mode);
+
+    size_t position = stream_tell(stream);
+    size_t entries_count = FlipperFormatKeyIndexEntryArray_size(index->entries);
+    size_t first = flipper_format_stream_key_index_lower_bound(index, position);
+
+    // Scan from the middle of a line can take the rest of it for a key, index can't do that
+    if(!flipper_format_stream_key_index_is_safe_position(stream, index, first, position)) {
+        return flipper_format_stream_seek_to_key(stream, key, strict_mode);
+    }
+
+    uint32_t hash = flipper_format_stream_key_hash(key);
+
+    if(strict_mode) {
+        // Only the next key is checked
+        if(first < entries_count) {
+            const FlipperFormatKeyIndexEntry* entry =
+                FlipperFormatKeyIndexEntryArray_cget(index->entries, first);
+            if((entry->hash == hash) &&
+               flipper_format_stream_key_index_match(stream, entry, key)) {
+                return stream_seek(stream, 2, StreamOffsetFromCurrent);
+            }
+            flipper_format_stream_key_index_seek(stream, entry->key_start + entry->key_size);
+            return false;
+        }
+    } else {
+        uint16_t i = index->buckets[hash & index->buckets_mask];
+        while(i != FLIPPER_FORMAT_KEY_INDEX_NONE) {
+            const FlipperFormatKeyIndexEntry* entry =
+                FlipperFormatKeyIndexEntryArray_cget(index->entries, i);
+            if((i >= first) && (entry->hash == hash) &&
+               flipper_format_stream_key_index_match(stream, entry, key)) {
+                return stream_seek(stream, 2, StreamOffsetFromCurrent);
+            }
+            i = entry->next;
+        }
+    }
+
+    // Not found, scan would stop at the end of the stream
+    stream_seek(stream, 0, StreamOffsetFromEnd);
+
+    return false;
+}
+
 static bool flipper_format_stream_read_value(Stream* stream, FuriString* value, bool* last) {
     enum { LeadingSpace, ReadValue, TrailingSpace } state = LeadingSpace;
     const size_t buffer_size = 32;
@@ -191,37 +517,19 @@ static bool flipper_format_stream_read_value(Stream* stream, FuriString* value,
 
 static bool flipper_format_stream_read_line(Stream* stream, FuriString* str_result) {
     furi_string_reset(str_result);
-    const size_t buffer_size = 32;
-    uint8_t buffer[buffer_size];
-
-    do {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
-        if(was_read == 0) break;
-
-        bool result = false;
-        bool error = false;
-
-        for(size_t i = 0; i < was_read; i++) {
-            uint8_t data = buffer[i];
-            if(data == flipper_format_eoln) {
-                if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
-                    error = true;
-                    break;
-                }
-
-                result = true;
-                break;
-            } else if(data == flipper_format_eolr) {
-                // Ignore
-            } else {
-                furi_string_push_back(str_result, data);
+    const char* line = NULL;
+    size_t line_size = 0;
+
+    // Raw stream users expect the stream to stay at the line ending after a value read
+    if(stream_read_line_view_keep_eol(stream, &line, &line_size)) {
+        if(memchr(line, flipper_format_eolr, line_size)) {
+            for(size_t i = 0; i < line_size; i++) {
+                if(line[i] != flipper_format_eolr) furi_string_push_back(str_result, line[i]);
             }
+        } else {
+            furi_string_set_strn(str_result, line, line_size);
         }
-
-        if(result || error) {
-            break;
-        }
-    } while(true);
+    }
 
     return furi_string_size(str_result) != 0;
 }
@@ -342,10 +650,22 @@ bool flipper_format_stream_read_value_line(
     void* _data,
     size_t data_size,
     bool strict_mode) {
+    return flipper_format_stream_read_value_line_indexed(
+        stream, NULL, key, type, _data, data_size, strict_mode);
+}
+
+bool flipper_format_stream_read_value_line_indexed(
+    Stream* stream,
+    FlipperFormatKeyIndex* index,
+    const char* key,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size,
+    bool strict_mode) {
     bool result = false;
 
     do {
-        if(!flipper_format_stream_seek_to_key(stream, key, strict_mode)) break;
+        if(!flipper_format_stream_seek_to_key_indexed(stream, index, key, strict_mode)) break;
 
         if(type == FlipperStreamValueStr) {
             FuriString* data = (FuriString*)_data;
@@ -441,6 +761,15 @@ bool flipper_format_stream_get_value_count(
     const char* key,
     uint32_t* count,
     bool strict_mode) {
+    return flipper_format_stream_get_value_count_indexed(stream, NULL, key, count, strict_mode);
+}
+
+bool flipper_format_stream_get_value_count_indexed(
+    Stream* stream,
+    FlipperFormatKeyIndex* index,
+    const char* key,
+    uint32_t* count,
+    bool strict_mode) {
     bool result = false;
     bool last = false;
 
@@ -449,7 +778,7 @@ bool flipper_format_stream_get_value_count(
 
     uint32_t position = stream_tell(stream);
     do {
-        if(!flipper_format_stream_seek_to_key(stream, key, strict_mode)) break;
+        if(!flipper_format_stream_seek_to_key_indexed(stream, index, key, strict_mode)) break;
         *count = 0;
 
         result = true;
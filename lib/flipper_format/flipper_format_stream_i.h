@@ -29,6 +29,83 @@ bool flipper_format_stream_write_eol(Stream* stream);
  */
 bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode);
 
+typedef struct FlipperFormatKeyIndex FlipperFormatKeyIndex;
+
+/**
+ * Build key index of the stream in one pass. Stream position is preserved.
+ * @param stream 
+ * @return FlipperFormatKeyIndex* index, NULL if stream has too many keys or read failed
+ */
+FlipperFormatKeyIndex* flipper_format_stream_key_index_build(Stream* stream);
+
+/**
+ * Free key index
+ * @param index 
+ */
+void flipper_format_stream_key_index_free(FlipperFormatKeyIndex* index);
+
+/**
+ * Check that key index was built for the stream of the current size
+ * @param index 
+ * @param stream 
+ * @return true index can be used
+ * @return false stream was changed, index must be rebuilt
+ */
+bool flipper_format_stream_key_index_is_actual(FlipperFormatKeyIndex* index, Stream* stream);
+
+/**
+ * Same as flipper_format_stream_seek_to_key, but uses key index if it is not NULL
+ * @param stream 
+ * @param index 
+ * @param key 
+ * @param strict_mode 
+ * @return true key is found
+ * @return false key is not found
+ */
+bool flipper_format_stream_seek_to_key_indexed(
+    Stream* stream,
+    FlipperFormatKeyIndex* index,
+    const char* key,
+    bool strict_mode);
+
+/**
+ * Same as flipper_format_stream_read_value_line, but uses key index if it is not NULL
+ * @param stream 
+ * @param index 
+ * @param key 
+ * @param type 
+ * @param _data 
+ * @param data_size 
+ * @param strict_mode 
+ * @return true 
+ * @return false 
+ */
+bool flipper_format_stream_read_value_line_indexed(
+    Stream* stream,
+    FlipperFormatKeyIndex* index,
+    const char* key,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size,
+    bool strict_mode);
+
+/**
+ * Same as flipper_format_stream_get_value_count, but uses key index if it is not NULL
+ * @param stream 
+ * @param index 
+ * @param key 
+ * @param count 
+ * @param strict_mode 
+ * @return true 
+ * @return false 
+ */
+bool flipper_format_stream_get_value_count_indexed(
+    Stream* stream,
+    FlipperFormatKeyIndex* index,
+    const char* key,
+    uint32_t* count,
+    bool strict_mode);
+
 #ifdef __cplusplus
 }
 #endif
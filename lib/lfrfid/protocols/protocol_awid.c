@@ -93,27 +93,30 @@ static void protocol_awid_decode(uint8_t* encoded_data, uint8_t* decoded_data) {
     bit_lib_copy_bits(decoded_data, 0, 66, encoded_data, 8);
 }
 
-bool protocol_awid_decoder_feed(ProtocolAwid* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+bool protocol_awid_decoder_feed_bits(ProtocolAwid* protocol, bool value, uint32_t count) {
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
-    if(count > 0) {
-        for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, AWID_ENCODED_DATA_SIZE, value);
-            if(protocol_awid_can_be_decoded(protocol->encoded_data)) {
-                protocol_awid_decode(protocol->encoded_data, protocol->data);
-
-                result = true;
-                break;
-            }
+    for(size_t i = 0; i < count; i++) {
+        bit_lib_push_bit(protocol->encoded_data, AWID_ENCODED_DATA_SIZE, value);
+        if(protocol_awid_can_be_decoded(protocol->encoded_data)) {
+            protocol_awid_decode(protocol->encoded_data, protocol->data);
+
+            result = true;
+            break;
         }
     }
 
     return result;
 };
 
+bool protocol_awid_decoder_feed(ProtocolAwid* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_awid_decoder_feed_bits(protocol, value, count);
+};
+
 static void protocol_awid_encode(const uint8_t* decoded_data, uint8_t* encoded_data) {
     memset(encoded_data, 0, AWID_ENCODED_DATA_SIZE);
 
@@ -243,6 +246,8 @@ const ProtocolBase protocol_awid = {
         {
             .start = (ProtocolDecoderStart)protocol_awid_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_awid_decoder_feed,
+            .demod = &fsk_demod_rf50,
+            .feed_bits = (ProtocolDecoderFeedBits)protocol_awid_decoder_feed_bits,
         },
     .encoder =
         {
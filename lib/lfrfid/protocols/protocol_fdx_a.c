@@ -107,25 +107,28 @@ static bool protocol_fdx_a_can_be_decoded(const uint8_t* data) {
     return (parity_sum == 0);
 }
 
-bool protocol_fdx_a_decoder_feed(ProtocolFDXA* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+bool protocol_fdx_a_decoder_feed_bits(ProtocolFDXA* protocol, bool value, uint32_t count) {
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
-    if(count > 0) {
-        for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, FDXA_ENCODED_DATA_SIZE, value);
-            if(protocol_fdx_a_can_be_decoded(protocol->encoded_data)) {
-                protocol_fdx_a_decode(protocol->encoded_data, protocol->data);
-                result = true;
-            }
+    for(size_t i = 0; i < count; i++) {
+        bit_lib_push_bit(protocol->encoded_data, FDXA_ENCODED_DATA_SIZE, value);
+        if(protocol_fdx_a_can_be_decoded(protocol->encoded_data)) {
+            protocol_fdx_a_decode(protocol->encoded_data, protocol->data);
+            result = true;
         }
     }
 
     return result;
 };
 
+bool protocol_fdx_a_decoder_feed(ProtocolFDXA* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_fdx_a_decoder_feed_bits(protocol, value, count);
+};
+
 static void protocol_fdx_a_encode(ProtocolFDXA* protocol) {
     protocol->encoded_data[0] = FDXA_PREAMBLE_0;
     protocol->encoded_data[1] = FDXA_PREAMBLE_1;
@@ -240,6 +243,8 @@ const ProtocolBase protocol_fdx_a = {
         {
             .start = (ProtocolDecoderStart)protocol_fdx_a_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_fdx_a_decoder_feed,
+            .demod = &fsk_demod_rf50,
+            .feed_bits = (ProtocolDecoderFeedBits)protocol_fdx_a_decoder_feed_bits,
         },
     .encoder =
         {
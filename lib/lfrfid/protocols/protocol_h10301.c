@@ -187,26 +187,29 @@ static void protocol_h10301_decode(const uint32_t* card_data, uint8_t* decoded_d
     memcpy(decoded_data, &data, H10301_DECODED_DATA_SIZE);
 }
 
-bool protocol_h10301_decoder_feed(ProtocolH10301* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+bool protocol_h10301_decoder_feed_bits(ProtocolH10301* protocol, bool value, uint32_t count) {
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
-    if(count > 0) {
-        for(size_t i = 0; i < count; i++) {
-            protocol_h10301_decoder_store_data(protocol, value);
-            if(protocol_h10301_can_be_decoded(protocol->encoded_data)) {
-                protocol_h10301_decode(protocol->encoded_data, protocol->data);
-                result = true;
-                break;
-            }
+    for(size_t i = 0; i < count; i++) {
+        protocol_h10301_decoder_store_data(protocol, value);
+        if(protocol_h10301_can_be_decoded(protocol->encoded_data)) {
+            protocol_h10301_decode(protocol->encoded_data, protocol->data);
+            result = true;
+            break;
         }
     }
 
     return result;
 };
 
+bool protocol_h10301_decoder_feed(ProtocolH10301* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_h10301_decoder_feed_bits(protocol, value, count);
+};
+
 static void protocol_h10301_write_raw_bit(bool bit, uint8_t position, uint32_t* card_data) {
     if(bit) {
         card_data[position / H10301_BIT_SIZE] |=
@@ -378,6 +381,8 @@ const ProtocolBase protocol_h10301 = {
         {
             .start = (ProtocolDecoderStart)protocol_h10301_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_h10301_decoder_feed,
+            .demod = &fsk_demod_rf50,
+            .feed_bits = (ProtocolDecoderFeedBits)protocol_h10301_decoder_feed_bits,
         },
     .encoder =
         {
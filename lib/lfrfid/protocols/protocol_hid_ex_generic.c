@@ -93,25 +93,31 @@ static void protocol_hid_ex_generic_decode(const uint8_t* from, uint8_t* to) {
     }
 }
 
-bool protocol_hid_ex_generic_decoder_feed(ProtocolHIDEx* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+bool protocol_hid_ex_generic_decoder_feed_bits(
+    ProtocolHIDEx* protocol,
+    bool value,
+    uint32_t count) {
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
-    if(count > 0) {
-        for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, HID_ENCODED_DATA_SIZE, value);
-            if(protocol_hid_ex_generic_can_be_decoded(protocol->encoded_data)) {
-                protocol_hid_ex_generic_decode(protocol->encoded_data, protocol->data);
-                result = true;
-            }
+    for(size_t i = 0; i < count; i++) {
+        bit_lib_push_bit(protocol->encoded_data, HID_ENCODED_DATA_SIZE, value);
+        if(protocol_hid_ex_generic_can_be_decoded(protocol->encoded_data)) {
+            protocol_hid_ex_generic_decode(protocol->encoded_data, protocol->data);
+            result = true;
         }
     }
 
     return result;
 };
 
+bool protocol_hid_ex_generic_decoder_feed(ProtocolHIDEx* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_hid_ex_generic_decoder_feed_bits(protocol, value, count);
+};
+
 static void protocol_hid_ex_generic_encode(ProtocolHIDEx* protocol) {
     protocol->encoded_data[0] = HID_PREAMBLE;
 
@@ -211,6 +217,8 @@ const ProtocolBase protocol_hid_ex_generic = {
         {
             .start = (ProtocolDecoderStart)protocol_hid_ex_generic_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_hid_ex_generic_decoder_feed,
+            .demod = &fsk_demod_rf50,
+            .feed_bits = (ProtocolDecoderFeedBits)protocol_hid_ex_generic_decoder_feed_bits,
         },
     .encoder =
         {
@@ -125,25 +125,28 @@ static uint8_t protocol_hid_generic_decode_protocol_size(ProtocolHID* protocol)
     return size < 26 ? HID_PROTOCOL_SIZE_UNKNOWN : size;
 }
 
-bool protocol_hid_generic_decoder_feed(ProtocolHID* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+bool protocol_hid_generic_decoder_feed_bits(ProtocolHID* protocol, bool value, uint32_t count) {
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
-    if(count > 0) {
-        for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, HID_ENCODED_DATA_SIZE, value);
-            if(protocol_hid_generic_can_be_decoded(protocol->encoded_data)) {
-                protocol_hid_generic_decode(protocol->encoded_data, protocol->data);
-                result = true;
-            }
+    for(size_t i = 0; i < count; i++) {
+        bit_lib_push_bit(protocol->encoded_data, HID_ENCODED_DATA_SIZE, value);
+        if(protocol_hid_generic_can_be_decoded(protocol->encoded_data)) {
+            protocol_hid_generic_decode(protocol->encoded_data, protocol->data);
+            result = true;
         }
     }
 
     return result;
 };
 
+bool protocol_hid_generic_decoder_feed(ProtocolHID* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_hid_generic_decoder_feed_bits(protocol, value, count);
+};
+
 static void protocol_hid_generic_encode(ProtocolHID* protocol) {
     protocol->encoded_data[0] = HID_PREAMBLE;
 
@@ -276,6 +279,8 @@ const ProtocolBase protocol_hid_generic = {
         {
             .start = (ProtocolDecoderStart)protocol_hid_generic_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_hid_generic_decoder_feed,
+            .demod = &fsk_demod_rf50,
+            .feed_bits = (ProtocolDecoderFeedBits)protocol_hid_generic_decoder_feed_bits,
         },
     .encoder =
         {
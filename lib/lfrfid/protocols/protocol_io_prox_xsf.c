@@ -155,13 +155,12 @@ void protocol_io_prox_xsf_decode(const uint8_t* encoded_data, uint8_t* decoded_d
     decoded_data[3] = bit_lib_get_bits(encoded_data, 45, 8);
 }
 
-bool protocol_io_prox_xsf_decoder_feed(ProtocolIOProxXSF* protocol, bool level, uint32_t duration) {
+bool protocol_io_prox_xsf_decoder_feed_bits(
+    ProtocolIOProxXSF* protocol,
+    bool value,
+    uint32_t count) {
     bool result = false;
 
-    uint32_t count;
-    bool value;
-
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     for(size_t i = 0; i < count; i++) {
         bit_lib_push_bit(protocol->encoded_data, IOPROXXSF_ENCODED_DATA_SIZE, value);
         if(protocol_io_prox_xsf_can_be_decoded(protocol->encoded_data)) {
@@ -174,6 +173,14 @@ bool protocol_io_prox_xsf_decoder_feed(ProtocolIOProxXSF* protocol, bool level,
     return result;
 };
 
+bool protocol_io_prox_xsf_decoder_feed(ProtocolIOProxXSF* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_io_prox_xsf_decoder_feed_bits(protocol, value, count);
+};
+
 static void protocol_io_prox_xsf_encode(const uint8_t* decoded_data, uint8_t* encoded_data) {
     // Packet to transmit:
     //
@@ -289,6 +296,8 @@ const ProtocolBase protocol_io_prox_xsf = {
         {
             .start = (ProtocolDecoderStart)protocol_io_prox_xsf_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_io_prox_xsf_decoder_feed,
+            .demod = &fsk_demod_rf64,
+            .feed_bits = (ProtocolDecoderFeedBits)protocol_io_prox_xsf_decoder_feed_bits,
         },
     .encoder =
         {
@@ -84,25 +84,27 @@ static void protocol_paradox_decode(uint8_t* encoded_data, uint8_t* decoded_data
     bit_lib_push_bit(decoded_data, PARADOX_DECODED_DATA_SIZE, 0);
 }
 
-bool protocol_paradox_decoder_feed(ProtocolParadox* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+bool protocol_paradox_decoder_feed_bits(ProtocolParadox* protocol, bool value, uint32_t count) {
+    for(size_t i = 0; i < count; i++) {
+        bit_lib_push_bit(protocol->encoded_data, PARADOX_ENCODED_DATA_SIZE, value);
+        if(protocol_paradox_can_be_decoded(protocol)) {
+            protocol_paradox_decode(protocol->encoded_data, protocol->data);
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
-    if(count > 0) {
-        for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, PARADOX_ENCODED_DATA_SIZE, value);
-            if(protocol_paradox_can_be_decoded(protocol)) {
-                protocol_paradox_decode(protocol->encoded_data, protocol->data);
-
-                return true;
-            }
+            return true;
         }
     }
 
     return false;
 };
 
+bool protocol_paradox_decoder_feed(ProtocolParadox* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_paradox_decoder_feed_bits(protocol, value, count);
+};
+
 static void protocol_paradox_encode(const uint8_t* decoded_data, uint8_t* encoded_data) {
     // preamble
     bit_lib_set_bits(encoded_data, 0, 0b00001111, 8);
@@ -228,6 +230,8 @@ const ProtocolBase protocol_paradox = {
         {
             .start = (ProtocolDecoderStart)protocol_paradox_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_paradox_decoder_feed,
+            .demod = &fsk_demod_rf50,
+            .feed_bits = (ProtocolDecoderFeedBits)protocol_paradox_decoder_feed_bits,
         },
     .encoder =
         {
@@ -105,25 +105,28 @@ static void protocol_pyramid_decode(ProtocolPyramid* protocol) {
     bit_lib_copy_bits(protocol->data, 16, 16, protocol->encoded_data, 81 + 8);
 }
 
-bool protocol_pyramid_decoder_feed(ProtocolPyramid* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+bool protocol_pyramid_decoder_feed_bits(ProtocolPyramid* protocol, bool value, uint32_t count) {
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
-    if(count > 0) {
-        for(size_t i = 0; i < count; i++) {
-            bit_lib_push_bit(protocol->encoded_data, PYRAMID_ENCODED_DATA_SIZE, value);
-            if(protocol_pyramid_can_be_decoded(protocol->encoded_data)) {
-                protocol_pyramid_decode(protocol);
-                result = true;
-            }
+    for(size_t i = 0; i < count; i++) {
+        bit_lib_push_bit(protocol->encoded_data, PYRAMID_ENCODED_DATA_SIZE, value);
+        if(protocol_pyramid_can_be_decoded(protocol->encoded_data)) {
+            protocol_pyramid_decode(protocol);
+            result = true;
         }
     }
 
     return result;
 };
 
+bool protocol_pyramid_decoder_feed(ProtocolPyramid* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_pyramid_decoder_feed_bits(protocol, value, count);
+};
+
 bool protocol_pyramid_get_parity(const uint8_t* bits, uint8_t type, int length) {
     int x;
     for(x = 0; length > 0; --length) x += bit_lib_get_bit(bits, length - 1);
@@ -270,6 +273,8 @@ const ProtocolBase protocol_pyramid = {
         {
             .start = (ProtocolDecoderStart)protocol_pyramid_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_pyramid_decoder_feed,
+            .demod = &fsk_demod_rf50,
+            .feed_bits = (ProtocolDecoderFeedBits)protocol_pyramid_decoder_feed_bits,
         },
     .encoder =
         {
@@ -1,6 +1,10 @@
 #include <furi.h>
 #include "fsk_demod.h"
 
+#define FSK_DEMOD_JITTER_TIME (20)
+#define FSK_DEMOD_MIN_TIME (64 - FSK_DEMOD_JITTER_TIME)
+#define FSK_DEMOD_MAX_TIME (80 + FSK_DEMOD_JITTER_TIME)
+
 struct FSKDemod {
     uint32_t low_time;
     uint32_t low_pulses;
@@ -91,3 +95,23 @@ void fsk_demod_feed(FSKDemod* demod, bool polarity, uint32_t time, bool* value,
         }
     }
 }
+
+static void* fsk_demod_rf50_alloc(void) {
+    return fsk_demod_alloc(FSK_DEMOD_MIN_TIME, 6, FSK_DEMOD_MAX_TIME, 5);
+}
+
+static void* fsk_demod_rf64_alloc(void) {
+    return fsk_demod_alloc(FSK_DEMOD_MIN_TIME, 8, FSK_DEMOD_MAX_TIME, 6);
+}
+
+const ProtocolDemod fsk_demod_rf50 = {
+    .alloc = fsk_demod_rf50_alloc,
+    .free = (ProtocolDemodFree)fsk_demod_free,
+    .feed = (ProtocolDemodFeed)fsk_demod_feed,
+};
+
+const ProtocolDemod fsk_demod_rf64 = {
+    .alloc = fsk_demod_rf64_alloc,
+    .free = (ProtocolDemodFree)fsk_demod_free,
+    .feed = (ProtocolDemodFeed)fsk_demod_feed,
+};
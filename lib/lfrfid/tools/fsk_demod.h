@@ -1,6 +1,7 @@
 #pragma once
 #include <stdint.h>
 #include <stdbool.h>
+#include <toolbox/protocols/protocol.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -39,6 +40,12 @@ void fsk_demod_free(FSKDemod* fsk_demod);
  */
 void fsk_demod_feed(FSKDemod* demod, bool polarity, uint32_t time, bool* value, uint32_t* count);
 
+/** FSK2a, fc/8 and fc/10 subcarriers, 50 clocks per bit */
+extern const ProtocolDemod fsk_demod_rf50;
+
+/** FSK2a, fc/8 and fc/10 subcarriers, 64 clocks per bit */
+extern const ProtocolDemod fsk_demod_rf64;
+
 #ifdef __cplusplus
 }
 #endif
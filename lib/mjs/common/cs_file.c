@@ -50,6 +50,29 @@ char* cs_read_file(const char* path, size_t* size) {
     return data;
 }
 
+int cs_write_file(
+    const char* path,
+    const void* header,
+    size_t header_size,
+    const void* data,
+    size_t size) WEAK;
+int cs_write_file(
+    const char* path,
+    const void* header,
+    size_t header_size,
+    const void* data,
+    size_t size) {
+    FILE* fp;
+    int ok = 0;
+    if((fp = fopen(path, "wb")) != NULL) {
+        ok = (fwrite(header, 1, header_size, fp) == header_size) &&
+             (fwrite(data, 1, size, fp) == size);
+        if(fclose(fp) != 0) ok = 0;
+        if(!ok) remove(path);
+    }
+    return ok;
+}
+
 char* cs_mmap_file(const char* path, size_t* size) WEAK;
 char* cs_mmap_file(const char* path, size_t* size) {
     char* r;
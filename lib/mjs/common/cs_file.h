@@ -33,6 +33,18 @@ extern "C" {
  */
 char *cs_read_file(const char *path, size_t *size);
 
+/*
+ * Write `header` followed by `data` to the file `path`, existing file is
+ * overwritten. Nothing is left on error.
+ * Return: 1 on success, 0 on error.
+ */
+int cs_write_file(
+    const char *path,
+    const void *header,
+    size_t header_size,
+    const void *data,
+    size_t size);
+
 #ifdef CS_MMAP
 /*
  * Only on platforms which support mmapping: mmap file `path` to the returned
@@ -29,6 +29,12 @@ extern "C" {
 /* Sub-second granularity time(). */
 double cs_time(void);
 
+/*
+ * Free running microsecond counter, only the difference of two readings
+ * taken shortly one after another is meaningful.
+ */
+uint32_t cs_time_us(void);
+
 /*
  * Similar to (non-standard) timegm, converts broken-down time into the number
  * of seconds since Unix Epoch.
@@ -1,6 +1,8 @@
 #include <furi.h>
+#include <furi_hal.h>
 #include <toolbox/stream/file_stream.h>
 #include "../cs_dbg.h"
+#include "../cs_time.h"
 #include "../frozen/frozen.h"
 
 char* cs_read_file(const char* path, size_t* size) {
@@ -29,6 +31,28 @@ char* cs_read_file(const char* path, size_t* size) {
     return data;
 }
 
+int cs_write_file(
+    const char* path,
+    const void* header,
+    size_t header_size,
+    const void* data,
+    size_t size) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    Stream* stream = file_stream_alloc(storage);
+    int ok = 0;
+    if(file_stream_open(stream, path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        ok = (stream_write(stream, header, header_size) == header_size) &&
+             (stream_write(stream, data, size) == size);
+    }
+    file_stream_close(stream);
+    stream_free(stream);
+    if(!ok) {
+        storage_common_remove(storage, path);
+    }
+    furi_record_close(RECORD_STORAGE);
+    return ok;
+}
+
 char* json_fread(const char* path) {
     UNUSED(path);
     return NULL;
@@ -53,6 +77,22 @@ int json_printer_file(struct json_out* out, const char* buf, size_t len) {
     return 0;
 }
 
+uint32_t cs_time_us(void) {
+    // Cycle counter wraps too often to be divided as is, keep the remainder
+    static uint32_t last_cycles = 0;
+    static uint32_t cycles = 0;
+    static uint32_t time_us = 0;
+
+    const uint32_t now = DWT->CYCCNT;
+    const uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+    cycles += now - last_cycles;
+    last_cycles = now;
+    time_us += cycles / cycles_per_us;
+    cycles %= cycles_per_us;
+
+    return time_us;
+}
+
 int cs_log_print_prefix(enum cs_log_level level, const char* file, int ln) {
     (void)level;
     (void)file;
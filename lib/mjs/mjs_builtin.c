@@ -111,6 +111,18 @@ static void mjs_do_gc(struct mjs* mjs) {
     mjs_return(mjs, arg0);
 }
 
+static void mjs_do_gc_stats(struct mjs* mjs) {
+    struct mjs_gc_stats stats;
+    mjs_val_t res = mjs_mk_object(mjs);
+
+    mjs_gc_get_stats(mjs, &stats);
+    mjs_set(mjs, res, "collections", ~0, mjs_mk_number(mjs, stats.collections));
+    mjs_set(mjs, res, "pause_max_us", ~0, mjs_mk_number(mjs, stats.pause_max_us));
+    mjs_set(mjs, res, "pause_avg_us", ~0, mjs_mk_number(mjs, stats.pause_avg_us));
+    mjs_set(mjs, res, "reclaimed", ~0, mjs_mk_number(mjs, (double)stats.reclaimed));
+    mjs_return(mjs, res);
+}
+
 static void mjs_s2o(struct mjs* mjs) {
     mjs_return(
         mjs,
@@ -133,6 +145,8 @@ void mjs_init_builtin(struct mjs* mjs, mjs_val_t obj) {
     mjs_set(mjs, obj, "getMJS", ~0, mjs_mk_foreign_func(mjs, (mjs_func_ptr_t)mjs_get_mjs));
     mjs_set(mjs, obj, "die", ~0, mjs_mk_foreign_func(mjs, (mjs_func_ptr_t)mjs_die));
     mjs_set(mjs, obj, "gc", ~0, mjs_mk_foreign_func(mjs, (mjs_func_ptr_t)mjs_do_gc));
+    mjs_set(
+        mjs, obj, "gc_stats", ~0, mjs_mk_foreign_func(mjs, (mjs_func_ptr_t)mjs_do_gc_stats));
     mjs_set(mjs, obj, "chr", ~0, mjs_mk_foreign_func(mjs, (mjs_func_ptr_t)mjs_chr));
     mjs_set(mjs, obj, "s2o", ~0, mjs_mk_foreign_func(mjs, (mjs_func_ptr_t)mjs_s2o));
 
@@ -60,6 +60,20 @@ struct mjs_bcode_part {
     unsigned in_rom : 1;
 };
 
+/*
+ * Own properties found recently, direct mapped by object and name. Entries
+ * are checked on hit, the cache is dropped when properties may be freed.
+ */
+#define MJS_PROP_CACHE_SIZE 32 /* Power of two */
+
+struct mjs_object;
+struct mjs_property;
+
+struct mjs_prop_cache_entry {
+    struct mjs_object* obj;
+    struct mjs_property* prop;
+};
+
 struct mjs {
     struct mbuf bcode_gen;
     struct mbuf bcode_parts;
@@ -89,9 +103,21 @@ struct mjs {
     struct gc_arena property_arena;
     struct gc_arena ffi_sig_arena;
 
+    struct mjs_prop_cache_entry prop_cache[MJS_PROP_CACHE_SIZE];
+
+    /* GC statistics, see mjs_gc_get_stats() */
+    uint32_t gc_collections;
+    uint32_t gc_pause_max_us;
+    uint64_t gc_pause_total_us;
+    uint64_t gc_reclaimed;
+
+    /* Bcode of the last file, see mjs_get_load_time_us() */
+    uint32_t load_time_us;
+
     unsigned inhibit_gc : 1;
     unsigned need_gc : 1;
     unsigned generate_jsc : 1;
+    unsigned load_cached : 1;
 };
 
 /*
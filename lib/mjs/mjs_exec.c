@@ -4,6 +4,7 @@
  */
 
 #include "common/cs_file.h"
+#include "common/cs_time.h"
 #include "common/cs_varint.h"
 
 #include "mjs_array.h"
@@ -1059,6 +1060,121 @@ clean:
     return mjs->error;
 }
 
+#if MJS_BCODE_CACHE
+#define MJS_BCODE_CACHE_MAGIC 0x43534a4d /* "MJSC" */
+/* Any change of bcode makes old files invalid, bump the version then */
+#define MJS_BCODE_CACHE_VERSION ((2 << 8) | OP_MAX)
+
+struct mjs_bcode_cache_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t source_size;
+    uint32_t source_hash;
+    uint32_t bcode_size;
+    uint32_t bcode_hash; /* Damaged file is parsed again */
+};
+
+static uint32_t mjs_bcode_cache_hash(const char* src, size_t len) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261u;
+    for(size_t i = 0; i < len; i++) {
+        hash = (hash ^ (uint8_t)src[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/* Returns allocated .jsc path for a .js file, or NULL */
+static char* mjs_bcode_cache_path(const char* path) {
+    const char* jsext = ".js";
+    size_t len = strlen(path);
+    if(len <= strlen(jsext) || strcmp(path + len - strlen(jsext), jsext) != 0) {
+        return NULL;
+    }
+
+    char* jsc_path = malloc(len + 2);
+    memcpy(jsc_path, path, len);
+    jsc_path[len] = 'c';
+    jsc_path[len + 1] = '\0';
+    return jsc_path;
+}
+
+/*
+ * Loads bcode of the source from the .jsc file and commits it as the next bcode
+ * part. Returns 1 if loaded, 0 if the file is missing or made for other source.
+ */
+static int
+    mjs_bcode_cache_load(struct mjs* mjs, const char* path, const char* src, size_t src_len) {
+    const size_t path_offset = 1 + sizeof(mjs_header_item_t) * MJS_HDR_ITEMS_CNT;
+    char* jsc_path = mjs_bcode_cache_path(path);
+    char* data = NULL;
+    size_t size = 0;
+    int loaded = 0;
+
+    if(jsc_path != NULL) {
+        data = cs_read_file(jsc_path, &size);
+        free(jsc_path);
+    }
+
+    if(data != NULL && size > sizeof(struct mjs_bcode_cache_header) + path_offset) {
+        struct mjs_bcode_cache_header header;
+        memcpy(&header, data, sizeof(header));
+        const char* bcode = data + sizeof(header);
+        size_t bcode_len = size - sizeof(header);
+        mjs_header_item_t total_size;
+        memcpy(
+            &total_size,
+            bcode + 1 + sizeof(mjs_header_item_t) * MJS_HDR_ITEM_TOTAL_SIZE,
+            sizeof(total_size));
+
+        /* File name is kept in bcode for stack traces */
+        loaded = header.magic == MJS_BCODE_CACHE_MAGIC &&
+                 header.version == MJS_BCODE_CACHE_VERSION && header.source_size == src_len &&
+                 header.source_hash == mjs_bcode_cache_hash(src, src_len) &&
+                 header.bcode_size == bcode_len &&
+                 header.bcode_hash == mjs_bcode_cache_hash(bcode, bcode_len) &&
+                 bcode[0] == OP_BCODE_HEADER &&
+                 total_size == bcode_len - 1 && strlen(path) < bcode_len - path_offset &&
+                 strcmp(bcode + path_offset, path) == 0;
+
+        if(loaded) {
+            /* Transfer the ownership of the data to mjs_bcode_commit() */
+            memmove(data, bcode, bcode_len);
+            mbuf_free(&mjs->bcode_gen);
+            mjs->bcode_gen.buf = data;
+            mjs->bcode_gen.len = bcode_len;
+            mjs->bcode_gen.size = size + 1;
+            mjs_bcode_commit(mjs);
+            data = NULL;
+        }
+    }
+
+    free(data);
+    return loaded;
+}
+
+/* Saves the last bcode part to the .jsc file */
+static void mjs_bcode_cache_save(struct mjs* mjs, const char* path, const char* src) {
+    char* jsc_path = mjs_bcode_cache_path(path);
+    if(jsc_path == NULL) return;
+
+    struct mjs_bcode_part* bp = mjs_bcode_part_get(mjs, mjs_bcode_parts_cnt(mjs) - 1);
+    size_t src_len = strlen(src);
+    struct mjs_bcode_cache_header header = {
+        .magic = MJS_BCODE_CACHE_MAGIC,
+        .version = MJS_BCODE_CACHE_VERSION,
+        .source_size = src_len,
+        .source_hash = mjs_bcode_cache_hash(src, src_len),
+        .bcode_size = bp->data.len,
+        .bcode_hash = mjs_bcode_cache_hash(bp->data.p, bp->data.len),
+    };
+
+    if(!cs_write_file(jsc_path, &header, sizeof(header), bp->data.p, bp->data.len)) {
+        LOG(LL_WARN, ("Failed to write %s", jsc_path));
+    }
+    free(jsc_path);
+}
+#endif
+
 MJS_PRIVATE mjs_err_t mjs_exec_internal(
     struct mjs* mjs,
     const char* path,
@@ -1067,6 +1183,7 @@ MJS_PRIVATE mjs_err_t mjs_exec_internal(
     mjs_val_t* res) {
     size_t off = mjs->bcode_len;
     mjs_val_t r = MJS_UNDEFINED;
+    uint32_t start_us = cs_time_us();
     mjs->error = mjs_parse(path, src, mjs);
 #if MJS_ENABLE_DEBUG
     if(cs_log_level >= LL_VERBOSE_DEBUG) mjs_dump(mjs, 1);
@@ -1135,9 +1252,15 @@ MJS_PRIVATE mjs_err_t mjs_exec_internal(
                 }
             }
         }
+#elif MJS_BCODE_CACHE
+        if(generate_jsc && path != NULL) {
+            mjs_bcode_cache_save(mjs, path, src);
+        }
 #else
         (void)generate_jsc;
 #endif
+        mjs->load_time_us = cs_time_us() - start_us;
+        mjs->load_cached = 0;
 
         mjs_execute(mjs, off, &r);
     }
@@ -1162,7 +1285,27 @@ mjs_err_t mjs_exec_file(struct mjs* mjs, const char* path, mjs_val_t* res) {
     }
 
     r = MJS_UNDEFINED;
+    uint32_t cache_us = 0;
+#if MJS_BCODE_CACHE
+    if(mjs->generate_jsc) {
+        size_t off = mjs->bcode_len;
+        uint32_t start_us = cs_time_us();
+        int loaded = mjs_bcode_cache_load(mjs, path, source_code, size);
+        cache_us = cs_time_us() - start_us;
+        if(loaded) {
+            free(source_code);
+            mjs->load_time_us = cache_us;
+            mjs->load_cached = 1;
+            mjs->error = MJS_OK;
+            mjs_execute(mjs, off, &r);
+            error = mjs->error;
+            goto clean;
+        }
+    }
+#endif
     error = mjs_exec_internal(mjs, path, source_code, -1, &r);
+    /* Failed attempt to load the .jsc file is a part of the launch too */
+    mjs->load_time_us += cache_us;
     free(source_code);
 
 clean:
@@ -1170,6 +1313,11 @@ clean:
     return error;
 }
 
+uint32_t mjs_get_load_time_us(struct mjs* mjs, int* cached) {
+    if(cached != NULL) *cached = mjs->load_cached;
+    return mjs->load_time_us;
+}
+
 mjs_err_t
     mjs_call(struct mjs* mjs, mjs_val_t* res, mjs_val_t func, mjs_val_t this_val, int nargs, ...) {
     va_list ap;
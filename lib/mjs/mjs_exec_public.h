@@ -16,6 +16,14 @@ extern "C" {
 mjs_err_t mjs_exec(struct mjs*, const char* src, mjs_val_t* res);
 
 mjs_err_t mjs_exec_file(struct mjs* mjs, const char* path, mjs_val_t* res);
+
+/*
+ * Time it took to get bcode of the last script run with mjs_exec() or
+ * mjs_exec_file(), by parsing the source or by loading the .jsc file, in
+ * microseconds. If `cached` is not NULL, it's set to 1 if bcode was loaded
+ * from the .jsc file.
+ */
+uint32_t mjs_get_load_time_us(struct mjs* mjs, int* cached);
 mjs_err_t mjs_apply(
     struct mjs* mjs,
     mjs_val_t* res,
@@ -30,4 +30,21 @@
 #endif
 #endif
 
+/*
+ * MJS_BCODE_CACHE: if enabled, and if generating of .jsc files is enabled with
+ * mjs_set_generate_jsc(), then execution of any .js file will result in
+ * creation of a .jsc file with the bcode and a hash of the source. Next time
+ * the .jsc file is loaded to RAM instead of parsing the source, if the source
+ * is the same.
+ *
+ * By default it's enabled if MJS_GENERATE_JSC is not
+ */
+#if !defined(MJS_BCODE_CACHE)
+#if MJS_GENERATE_JSC
+#define MJS_BCODE_CACHE 0
+#else
+#define MJS_BCODE_CACHE 1
+#endif
+#endif
+
 #endif /* MJS_FEATURES_H_ */
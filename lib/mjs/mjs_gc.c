@@ -5,6 +5,7 @@
 
 #include <stdio.h>
 
+#include "common/cs_time.h"
 #include "common/cs_varint.h"
 #include "common/mbuf.h"
 
@@ -227,6 +228,7 @@ void gc_sweep(struct mjs* mjs, struct gc_arena* a, size_t start) {
                         a->destructor(mjs, cur);
                     }
                     memset(cur, 0, a->cell_size);
+                    mjs->gc_reclaimed += a->cell_size;
                 }
 
                 /* Add this cell to the `free` list */
@@ -485,6 +487,10 @@ static void gc_mark_ffi_cbargs_list(struct mjs* mjs, ffi_cb_args_t* cbargs) {
 
 /* Perform garbage collection */
 void mjs_gc(struct mjs* mjs, int full) {
+    const uint32_t start_us = cs_time_us();
+    const size_t strings_len = mjs->owned_strings.len;
+    uint32_t pause_us;
+
     gc_mark_val_array(mjs, (mjs_val_t*)&mjs->vals, sizeof(mjs->vals) / sizeof(mjs_val_t));
 
     gc_mark_mbuf_pt(mjs, &mjs->owned_values);
@@ -495,6 +501,10 @@ void mjs_gc(struct mjs* mjs, int full) {
     gc_mark_ffi_cbargs_list(mjs, mjs->ffi_cb_args);
 
     gc_compact_strings(mjs);
+    mjs->gc_reclaimed += strings_len - mjs->owned_strings.len;
+
+    /* Swept cells are reused, cached properties may point to them */
+    mjs_prop_cache_reset(mjs);
 
     gc_sweep(mjs, &mjs->object_arena, 0);
     gc_sweep(mjs, &mjs->property_arena, 0);
@@ -511,6 +521,23 @@ void mjs_gc(struct mjs* mjs, int full) {
             mbuf_resize(&mjs->owned_strings, trimmed_size);
         }
     }
+
+    pause_us = cs_time_us() - start_us;
+    mjs->gc_collections++;
+    mjs->gc_pause_total_us += pause_us;
+    if(pause_us > mjs->gc_pause_max_us) {
+        mjs->gc_pause_max_us = pause_us;
+    }
+}
+
+void mjs_gc_get_stats(struct mjs* mjs, struct mjs_gc_stats* stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->collections = mjs->gc_collections;
+    stats->pause_max_us = mjs->gc_pause_max_us;
+    if(mjs->gc_collections > 0) {
+        stats->pause_avg_us = (uint32_t)(mjs->gc_pause_total_us / mjs->gc_collections);
+    }
+    stats->reclaimed = mjs->gc_reclaimed;
 }
 
 MJS_PRIVATE int gc_check_val(struct mjs* mjs, mjs_val_t v) {
@@ -18,6 +18,22 @@ extern "C" {
  */
 void mjs_gc(struct mjs* mjs, int full);
 
+struct mjs_gc_stats {
+    uint32_t collections; /* Number of collections */
+    uint32_t pause_max_us; /* Longest collection, microseconds */
+    uint32_t pause_avg_us; /* Average collection, microseconds */
+    uint64_t reclaimed; /* Bytes of strings and cells reclaimed */
+};
+
+/*
+ * Get GC statistics collected since the instance was created.
+ *
+ * Statistics only measure collections. Every collection is still a full
+ * stop-the-world mark-sweep, pause time is not bounded: there is no
+ * incremental marking and no nursery for short-lived values.
+ */
+void mjs_gc_get_stats(struct mjs* mjs, struct mjs_gc_stats* stats);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
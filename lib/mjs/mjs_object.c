@@ -50,30 +50,59 @@ int mjs_is_object_based(mjs_val_t v) {
            ((v & MJS_TAG_MASK) == MJS_TAG_ARRAY_BUF_VIEW);
 }
 
+static struct mjs_prop_cache_entry*
+    mjs_prop_cache_entry(struct mjs* mjs, struct mjs_object* o, const char* name, size_t len) {
+    /* FNV-1a over the name, mixed with the object address */
+    uint32_t hash = 2166136261u;
+    for(size_t i = 0; i < len; i++) {
+        hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+    }
+    hash ^= (uint32_t)((uintptr_t)o >> 2);
+    hash *= 2654435769u;
+    return &mjs->prop_cache[(hash >> 16) & (MJS_PROP_CACHE_SIZE - 1)];
+}
+
+MJS_PRIVATE void mjs_prop_cache_reset(struct mjs* mjs) {
+    memset(mjs->prop_cache, 0, sizeof(mjs->prop_cache));
+}
+
 MJS_PRIVATE struct mjs_property*
     mjs_get_own_property(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
     struct mjs_property* p;
     struct mjs_object* o;
+    struct mjs_prop_cache_entry* entry;
 
     if(!mjs_is_object_based(obj)) {
         return NULL;
     }
 
+    if(len == (size_t)~0) {
+        len = strlen(name);
+    }
+
     o = get_object_struct(obj);
+    entry = mjs_prop_cache_entry(mjs, o, name, len);
 
     if(len <= 5) {
         mjs_val_t ss = mjs_mk_string(mjs, name, len, 1);
+        if(entry->obj == o && entry->prop->name == ss) return entry->prop;
         for(p = o->properties; p != NULL; p = p->next) {
-            if(p->name == ss) return p;
+            if(p->name == ss) break;
         }
     } else {
+        if(entry->obj == o && mjs_strcmp(mjs, &entry->prop->name, name, len) == 0) {
+            return entry->prop;
+        }
         for(p = o->properties; p != NULL; p = p->next) {
-            if(mjs_strcmp(mjs, &p->name, name, len) == 0) return p;
+            if(mjs_strcmp(mjs, &p->name, name, len) == 0) break;
         }
-        return p;
     }
 
-    return NULL;
+    if(p != NULL) {
+        entry->obj = o;
+        entry->prop = p;
+    }
+    return p;
 }
 
 MJS_PRIVATE struct mjs_property*
@@ -237,6 +266,7 @@ int mjs_del(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
             } else {
                 get_object_struct(obj)->properties = prop->next;
             }
+            mjs_prop_cache_reset(mjs);
             mjs_destroy_property(&prop);
             return 0;
         }
@@ -26,6 +26,13 @@ struct mjs_object {
 };
 
 MJS_PRIVATE struct mjs_object* get_object_struct(mjs_val_t v);
+
+/*
+ * Drops the property lookup cache, must be called when a property can be
+ * unlinked or freed.
+ */
+MJS_PRIVATE void mjs_prop_cache_reset(struct mjs* mjs);
+
 MJS_PRIVATE struct mjs_property*
     mjs_get_own_property(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len);
 
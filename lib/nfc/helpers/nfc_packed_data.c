@@ -0,0 +1,44 @@
+#include "nfc_packed_data.h"
+
+#include <furi.h>
+#include <toolbox/hex.h>
+
+bool nfc_packed_data_write(FlipperFormat* ff, const char* key, const uint8_t* data, size_t size) {
+    furi_check(ff);
+    furi_check(key);
+    furi_check(data);
+
+    char* hex = malloc(size * 2 + 1);
+    uint8_to_hex_chars(data, (uint8_t*)hex, size * 2);
+    hex[size * 2] = '\0';
+
+    bool success = flipper_format_write_string_cstr(ff, key, hex);
+    free(hex);
+
+    return success;
+}
+
+bool nfc_packed_data_read(FlipperFormat* ff, const char* key, uint8_t* data, size_t size) {
+    furi_check(ff);
+    furi_check(key);
+    furi_check(data);
+
+    FuriString* hex = furi_string_alloc();
+    bool success = false;
+
+    do {
+        if(!flipper_format_read_string(ff, key, hex)) break;
+        if(furi_string_size(hex) != size * 2) break;
+
+        const char* hex_str = furi_string_get_cstr(hex);
+        size_t i = 0;
+        while((i < size) && hex_chars_to_uint8(&hex_str[i * 2], &data[i])) {
+            i++;
+        }
+        success = (i == size);
+    } while(false);
+
+    furi_string_free(hex);
+
+    return success;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <flipper_format/flipper_format.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Packed data is a byte array saved as a single hex string value without spaces.
+ * Large dumps are written and read as one line instead of a key per block.
+ */
+
+/** Write packed data
+ *
+ * @param      ff    FlipperFormat instance
+ * @param      key   key name
+ * @param      data  data to write
+ * @param      size  data size in bytes
+ *
+ * @return     true on success
+ */
+bool nfc_packed_data_write(FlipperFormat* ff, const char* key, const uint8_t* data, size_t size);
+
+/** Read packed data
+ *
+ * @param      ff    FlipperFormat instance
+ * @param      key   key name
+ * @param      data  buffer to read to
+ * @param      size  expected data size in bytes
+ *
+ * @return     true if the value is exactly size bytes of hex
+ */
+bool nfc_packed_data_read(FlipperFormat* ff, const char* key, uint8_t* data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -151,11 +151,7 @@ void nfc_device_set_loading_callback(
     instance->loading_callback_context = context;
 }
 
-bool nfc_device_save(NfcDevice* instance, const char* path) {
-    furi_check(instance);
-    furi_check(instance->protocol < NfcProtocolNum);
-    furi_check(path);
-
+static bool nfc_device_save_internal(NfcDevice* instance, const char* path, bool packed) {
     bool saved = false;
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
@@ -198,7 +194,11 @@ bool nfc_device_save(NfcDevice* instance, const char* path) {
         if(!flipper_format_write_hex(ff, NFC_DEVICE_UID_KEY, uid, uid_len)) break;
 
         // Write protocol-dependent data
-        if(!nfc_devices[instance->protocol]->save(instance->protocol_data, ff)) break;
+        NfcDeviceSave save = nfc_devices[instance->protocol]->save;
+        if(packed && nfc_devices[instance->protocol]->save_packed) {
+            save = nfc_devices[instance->protocol]->save_packed;
+        }
+        if(!save(instance->protocol_data, ff)) break;
 
         saved = true;
     } while(false);
@@ -214,6 +214,22 @@ bool nfc_device_save(NfcDevice* instance, const char* path) {
     return saved;
 }
 
+bool nfc_device_save(NfcDevice* instance, const char* path) {
+    furi_check(instance);
+    furi_check(instance->protocol < NfcProtocolNum);
+    furi_check(path);
+
+    return nfc_device_save_internal(instance, path, false);
+}
+
+bool nfc_device_save_packed(NfcDevice* instance, const char* path) {
+    furi_check(instance);
+    furi_check(instance->protocol < NfcProtocolNum);
+    furi_check(path);
+
+    return nfc_device_save_internal(instance, path, true);
+}
+
 static bool nfc_device_load_uid(
     FlipperFormat* ff,
     uint8_t* uid,
@@ -323,6 +339,7 @@ bool nfc_device_load(NfcDevice* instance, const char* path) {
     bool loaded = false;
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    flipper_format_set_key_index(ff, true);
 
     FuriString* temp_str;
     temp_str = furi_string_alloc();
@@ -252,6 +252,18 @@ void nfc_device_set_loading_callback(
  */
 bool nfc_device_save(NfcDevice* instance, const char* path);
 
+/**
+ * @brief Save NFC device data with block data packed into single values.
+ *
+ * Loads faster than nfc_device_save() output, but is not meant for editing by hand.
+ * Protocols without a packed form are saved as with nfc_device_save().
+ *
+ * @param[in] instance pointer to the instance to be saved.
+ * @param[in] path pointer to a character string with a full file path.
+ * @returns true if the data was successfully saved, false otherwise.
+ */
+bool nfc_device_save_packed(NfcDevice* instance, const char* path);
+
 /**
  * @brief Load NFC device data to an NfcDevice instance from a file.
  *
@@ -0,0 +1,140 @@
+#include "crypto1_batch.h"
+#include "crypto1.h"
+
+#include <furi.h>
+
+// Bitsliced Crypto1: bit N of every state word belongs to the key in lane N.
+// Filter functions are the boolean forms of the crypto1_filter() lookup tables.
+
+#define CRYPTO1_BATCH_STATE_SIZE (48U)
+#define CRYPTO1_BATCH_CLOCKS (96U)
+
+#define CRYPTO1_BATCH_BEBIT(x, n) FURI_BIT(x, (n) ^ 24)
+#define CRYPTO1_BATCH_BROADCAST(bit) (0U - (uint32_t)(bit))
+
+// 0xD938 lookup table, inputs from most significant
+static inline uint32_t crypto1_batch_fa(uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+    return ((a | b) ^ (a & d)) ^ (c & ((a ^ b) | d));
+}
+
+// 0xF22C lookup table, inputs from most significant
+static inline uint32_t crypto1_batch_fb(uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+    return ((a & b) | c) ^ ((a ^ b) & (c | d));
+}
+
+// 0xEC57E80A lookup table, inputs from least significant
+static inline uint32_t
+    crypto1_batch_fc(uint32_t a, uint32_t b, uint32_t c, uint32_t d, uint32_t e) {
+    return (a | ((b | e) & (d ^ e))) ^ ((a ^ (b & d)) & ((c ^ d) | (b & e)));
+}
+
+/*
+ * State is kept as history of feedback bits, the newest one at top[0].
+ * Odd register bit k is top[-2k], even register bit k is top[-2k - 1].
+ */
+static inline uint32_t crypto1_batch_filter(const uint32_t* top) {
+    uint32_t f4 = crypto1_batch_fb(top[-6], top[-4], top[-2], top[0]);
+    uint32_t f3 = crypto1_batch_fa(top[-14], top[-12], top[-10], top[-8]);
+    uint32_t f2 = crypto1_batch_fb(top[-22], top[-20], top[-18], top[-16]);
+    uint32_t f1 = crypto1_batch_fb(top[-30], top[-28], top[-26], top[-24]);
+    uint32_t f0 = crypto1_batch_fa(top[-38], top[-36], top[-34], top[-32]);
+    return crypto1_batch_fc(f0, f1, f2, f3, f4);
+}
+
+static inline uint32_t crypto1_batch_feedback(const uint32_t* top) {
+    // LF_POLY_ODD taps
+    uint32_t feed = top[-4] ^ top[-6] ^ top[-8] ^ top[-12] ^ top[-18] ^ top[-20] ^ top[-22] ^
+                    top[-28] ^ top[-30] ^ top[-32] ^ top[-38] ^ top[-42];
+    // LF_POLY_EVEN taps
+    feed ^= top[-5] ^ top[-23] ^ top[-33] ^ top[-35] ^ top[-37] ^ top[-47];
+    return feed;
+}
+
+static inline uint32_t crypto1_batch_bit(uint32_t* top, uint32_t in, bool is_encrypted) {
+    uint32_t out = crypto1_batch_filter(top);
+    uint32_t feed = in ^ crypto1_batch_feedback(top);
+    if(is_encrypted) feed ^= out;
+    top[1] = feed;
+    return out;
+}
+
+// Transpose 32x32 bit matrix: bit j of word i becomes bit i of word j
+static void crypto1_batch_transpose(uint32_t* matrix) {
+    uint32_t mask = 0x0000FFFF;
+    for(size_t j = 16; j != 0; j >>= 1, mask ^= mask << j) {
+        for(size_t k = 0; k < 32; k = (k + j + 1) & ~j) {
+            uint32_t t = ((matrix[k] >> j) ^ matrix[k + j]) & mask;
+            matrix[k + j] ^= t;
+            matrix[k] ^= t << j;
+        }
+    }
+}
+
+static void crypto1_batch_load_keys(uint32_t* history, const uint64_t* keys, size_t lanes) {
+    uint32_t low[32];
+    uint32_t high[32];
+
+    for(size_t i = 0; i < 32; i++) {
+        low[i] = (i < lanes) ? (uint32_t)keys[i] : 0;
+        high[i] = (i < lanes) ? (uint32_t)(keys[i] >> 32) : 0;
+    }
+    crypto1_batch_transpose(low);
+    crypto1_batch_transpose(high);
+
+    // Same bit order as crypto1_init()
+    for(size_t j = 0; j < CRYPTO1_BATCH_STATE_SIZE; j++) {
+        size_t key_bit = j ^ 7;
+        history[CRYPTO1_BATCH_STATE_SIZE - 1 - j] = (key_bit < 32) ? low[key_bit] :
+                                                                     high[key_bit - 32];
+    }
+}
+
+size_t crypto1_batch_check_reader_auth(
+    const uint64_t* keys,
+    size_t keys_count,
+    uint32_t cuid,
+    uint32_t nt,
+    uint32_t nr,
+    uint32_t ar,
+    size_t* matches,
+    size_t matches_size) {
+    furi_check(keys);
+    furi_check(matches || (matches_size == 0));
+
+    uint32_t* history =
+        malloc(sizeof(uint32_t) * (CRYPTO1_BATCH_STATE_SIZE + CRYPTO1_BATCH_CLOCKS));
+    uint32_t ks_expected = ar ^ prng_successor(nt, 64);
+    uint32_t uid_nt = cuid ^ nt;
+    size_t matches_count = 0;
+
+    for(size_t base = 0; base < keys_count && matches_count < matches_size;
+        base += CRYPTO1_BATCH_SIZE) {
+        size_t lanes = MIN(CRYPTO1_BATCH_SIZE, keys_count - base);
+        crypto1_batch_load_keys(history, &keys[base], lanes);
+        uint32_t* top = &history[CRYPTO1_BATCH_STATE_SIZE - 1];
+
+        for(size_t i = 0; i < 32; i++, top++) {
+            crypto1_batch_bit(top, CRYPTO1_BATCH_BROADCAST(CRYPTO1_BATCH_BEBIT(uid_nt, i)), false);
+        }
+        for(size_t i = 0; i < 32; i++, top++) {
+            crypto1_batch_bit(top, CRYPTO1_BATCH_BROADCAST(CRYPTO1_BATCH_BEBIT(nr, i)), true);
+        }
+
+        // Unused lanes never match, stop as soon as all lanes diverged
+        uint32_t mismatch = (lanes == 32) ? 0 : (UINT32_MAX << lanes);
+        for(size_t i = 0; (i < 32) && (mismatch != UINT32_MAX); i++, top++) {
+            uint32_t ks = crypto1_batch_bit(top, 0, false);
+            mismatch |= ks ^ CRYPTO1_BATCH_BROADCAST(CRYPTO1_BATCH_BEBIT(ks_expected, i));
+        }
+
+        uint32_t match = ~mismatch;
+        while(match && (matches_count < matches_size)) {
+            matches[matches_count++] = base + __builtin_ctz(match);
+            match &= match - 1;
+        }
+    }
+
+    free(history);
+
+    return matches_count;
+}
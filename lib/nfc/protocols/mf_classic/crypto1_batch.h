@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of keys clocked at once, one key per bit of a machine word */
+#define CRYPTO1_BATCH_SIZE (32U)
+
+/** Check candidate keys against a recorded reader authentication
+ *
+ * Keys are processed by a bitsliced Crypto1 implementation, CRYPTO1_BATCH_SIZE
+ * keys at a time. Produces the same result as crypto1_init(), crypto1_word()
+ * sequence used by MfClassic listener to verify a reader.
+ *
+ * @param keys          candidate keys
+ * @param keys_count    number of candidate keys
+ * @param cuid          card UID
+ * @param nt            card nonce
+ * @param nr            encrypted reader nonce, as sent by reader
+ * @param ar            encrypted reader response, as sent by reader
+ * @param matches       array to store indexes of matching keys
+ * @param matches_size  size of matches array
+ *
+ * @return number of matching keys stored in matches array
+ */
+size_t crypto1_batch_check_reader_auth(
+    const uint64_t* keys,
+    size_t keys_count,
+    uint32_t cuid,
+    uint32_t nt,
+    uint32_t nr,
+    uint32_t ar,
+    size_t* matches,
+    size_t matches_size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,6 +4,7 @@
 #include <toolbox/hex.h>
 
 #include <lib/bit_lib/bit_lib.h>
+#include <lib/nfc/helpers/nfc_packed_data.h>
 
 #define MF_CLASSIC_PROTOCOL_NAME "Mifare Classic"
 
@@ -14,7 +15,17 @@ typedef struct {
     const char* type_name;
 } MfClassicFeatures;
 
-static const uint32_t mf_classic_data_format_version = 2;
+// Keys and blocks are saved as known or unknown since this version
+#define MF_CLASSIC_DATA_FORMAT_VERSION_MASKS (2U)
+// Blocks and masks are saved packed since this version
+#define MF_CLASSIC_DATA_FORMAT_VERSION_PACKED (3U)
+
+#define MF_CLASSIC_BLOCKS_KEY "Blocks"
+#define MF_CLASSIC_BLOCKS_READ_KEY "Blocks read"
+#define MF_CLASSIC_KEY_A_MAP_KEY "Key A map"
+#define MF_CLASSIC_KEY_B_MAP_KEY "Key B map"
+
+#define MF_CLASSIC_BLOCKS_READ_SIZE(blocks_total) (((blocks_total) + 7) / 8)
 
 static const MfClassicFeatures mf_classic_features[MfClassicTypeNum] = {
     [MfClassicTypeMini] =
@@ -49,6 +60,7 @@ const NfcDeviceBase nfc_device_mf_classic = {
     .verify = (NfcDeviceVerify)mf_classic_verify,
     .load = (NfcDeviceLoad)mf_classic_load,
     .save = (NfcDeviceSave)mf_classic_save,
+    .save_packed = (NfcDeviceSave)mf_classic_save_packed,
     .is_equal = (NfcDeviceEqual)mf_classic_is_equal,
     .get_name = (NfcDeviceGetName)mf_classic_get_device_name,
     .get_uid = (NfcDeviceGetUid)mf_classic_get_uid,
@@ -147,6 +159,37 @@ static void mf_classic_parse_block(FuriString* block_str, MfClassicData* data, u
     }
 }
 
+static bool mf_classic_load_packed(MfClassicData* data, FlipperFormat* ff) {
+    bool parsed = false;
+
+    do {
+        uint16_t blocks_total = mf_classic_get_total_block_num(data->type);
+        if(!nfc_packed_data_read(
+               ff,
+               MF_CLASSIC_BLOCKS_KEY,
+               (uint8_t*)data->block,
+               blocks_total * sizeof(MfClassicBlock)))
+            break;
+
+        memset(data->block_read_mask, 0, sizeof(data->block_read_mask));
+        if(!nfc_packed_data_read(
+               ff,
+               MF_CLASSIC_BLOCKS_READ_KEY,
+               (uint8_t*)data->block_read_mask,
+               MF_CLASSIC_BLOCKS_READ_SIZE(blocks_total)))
+            break;
+
+        if(!flipper_format_read_hex_uint64(ff, MF_CLASSIC_KEY_A_MAP_KEY, &data->key_a_mask, 1))
+            break;
+        if(!flipper_format_read_hex_uint64(ff, MF_CLASSIC_KEY_B_MAP_KEY, &data->key_b_mask, 1))
+            break;
+
+        parsed = true;
+    } while(false);
+
+    return parsed;
+}
+
 bool mf_classic_load(MfClassicData* data, FlipperFormat* ff, uint32_t version) {
     furi_check(data);
     furi_check(ff);
@@ -178,11 +221,16 @@ bool mf_classic_load(MfClassicData* data, FlipperFormat* ff, uint32_t version) {
             if(!flipper_format_rewind(ff)) break;
             old_format = true;
         } else {
-            if(data_format_version < mf_classic_data_format_version) {
+            if(data_format_version < MF_CLASSIC_DATA_FORMAT_VERSION_MASKS) {
                 old_format = true;
             }
         }
 
+        if(data_format_version >= MF_CLASSIC_DATA_FORMAT_VERSION_PACKED) {
+            parsed = mf_classic_load_packed(data, ff);
+            break;
+        }
+
         // Read Mifare Classic blocks
         bool block_read = true;
         FuriString* block_str = furi_string_alloc();
@@ -257,11 +305,62 @@ static void
     furi_string_trim(block_str);
 }
 
-bool mf_classic_save(const MfClassicData* data, FlipperFormat* ff) {
-    furi_check(data);
-    furi_check(ff);
-
+static bool mf_classic_save_blocks(const MfClassicData* data, FlipperFormat* ff) {
     FuriString* temp_str = furi_string_alloc();
+    FuriString* block_str = furi_string_alloc();
+    bool saved = flipper_format_write_comment_cstr(
+        ff, "Mifare Classic blocks, \'??\' means unknown data");
+
+    uint16_t blocks_total = mf_classic_get_total_block_num(data->type);
+    for(size_t i = 0; saved && (i < blocks_total); i++) {
+        furi_string_printf(temp_str, "Block %d", i);
+        mf_classic_set_block_str(block_str, data, i);
+        saved = flipper_format_write_string(ff, furi_string_get_cstr(temp_str), block_str);
+    }
+
+    furi_string_free(block_str);
+    furi_string_free(temp_str);
+
+    return saved;
+}
+
+static bool mf_classic_save_blocks_packed(const MfClassicData* data, FlipperFormat* ff) {
+    bool saved = false;
+
+    do {
+        if(!flipper_format_write_comment_cstr(
+               ff, "Mifare Classic blocks, packed, data of unread blocks and keys is not valid"))
+            break;
+
+        uint16_t blocks_total = mf_classic_get_total_block_num(data->type);
+        if(!nfc_packed_data_write(
+               ff,
+               MF_CLASSIC_BLOCKS_KEY,
+               (const uint8_t*)data->block,
+               blocks_total * sizeof(MfClassicBlock)))
+            break;
+        if(!flipper_format_write_comment_cstr(ff, "Bit N of byte N / 8 is set if block N is read"))
+            break;
+        if(!nfc_packed_data_write(
+               ff,
+               MF_CLASSIC_BLOCKS_READ_KEY,
+               (const uint8_t*)data->block_read_mask,
+               MF_CLASSIC_BLOCKS_READ_SIZE(blocks_total)))
+            break;
+        if(!flipper_format_write_hex_uint64(ff, MF_CLASSIC_KEY_A_MAP_KEY, &data->key_a_mask, 1))
+            break;
+        if(!flipper_format_write_hex_uint64(ff, MF_CLASSIC_KEY_B_MAP_KEY, &data->key_b_mask, 1))
+            break;
+
+        saved = true;
+    } while(false);
+
+    return saved;
+}
+
+static bool mf_classic_save_internal(const MfClassicData* data, FlipperFormat* ff, bool packed) {
+    uint32_t data_format_version = packed ? MF_CLASSIC_DATA_FORMAT_VERSION_PACKED :
+                                            MF_CLASSIC_DATA_FORMAT_VERSION_MASKS;
     bool saved = false;
 
     do {
@@ -271,35 +370,33 @@ bool mf_classic_save(const MfClassicData* data, FlipperFormat* ff) {
         if(!flipper_format_write_string_cstr(
                ff, "Mifare Classic type", mf_classic_features[data->type].type_name))
             break;
-        if(!flipper_format_write_uint32(
-               ff, "Data format version", &mf_classic_data_format_version, 1))
-            break;
-        if(!flipper_format_write_comment_cstr(
-               ff, "Mifare Classic blocks, \'??\' means unknown data"))
+        if(!flipper_format_write_uint32(ff, "Data format version", &data_format_version, 1))
             break;
 
-        uint16_t blocks_total = mf_classic_get_total_block_num(data->type);
-        FuriString* block_str = furi_string_alloc();
-        bool block_saved = true;
-        for(size_t i = 0; i < blocks_total; i++) {
-            furi_string_printf(temp_str, "Block %d", i);
-            mf_classic_set_block_str(block_str, data, i);
-            if(!flipper_format_write_string(ff, furi_string_get_cstr(temp_str), block_str)) {
-                block_saved = false;
-                break;
-            }
+        if(packed) {
+            saved = mf_classic_save_blocks_packed(data, ff);
+        } else {
+            saved = mf_classic_save_blocks(data, ff);
         }
-        furi_string_free(block_str);
-        if(!block_saved) break;
-
-        saved = true;
     } while(false);
 
-    furi_string_free(temp_str);
-
     return saved;
 }
 
+bool mf_classic_save(const MfClassicData* data, FlipperFormat* ff) {
+    furi_check(data);
+    furi_check(ff);
+
+    return mf_classic_save_internal(data, ff, false);
+}
+
+bool mf_classic_save_packed(const MfClassicData* data, FlipperFormat* ff) {
+    furi_check(data);
+    furi_check(ff);
+
+    return mf_classic_save_internal(data, ff, true);
+}
+
 bool mf_classic_is_equal(const MfClassicData* data, const MfClassicData* other) {
     furi_check(data);
     furi_check(other);
@@ -157,6 +157,8 @@ bool mf_classic_load(MfClassicData* data, FlipperFormat* ff, uint32_t version);
 
 bool mf_classic_save(const MfClassicData* data, FlipperFormat* ff);
 
+bool mf_classic_save_packed(const MfClassicData* data, FlipperFormat* ff);
+
 bool mf_classic_is_equal(const MfClassicData* data, const MfClassicData* other);
 
 const char* mf_classic_get_device_name(const MfClassicData* data, NfcDeviceNameType name_type);
@@ -2,6 +2,7 @@
 
 #include <bit_lib/bit_lib.h>
 #include <furi.h>
+#include <lib/nfc/helpers/nfc_packed_data.h>
 
 #define MF_ULTRALIGHT_PROTOCOL_NAME "NTAG/Ultralight"
 
@@ -14,6 +15,7 @@
 #define MF_ULTRALIGHT_PAGES_TOTAL_KEY "Pages total"
 #define MF_ULTRALIGHT_PAGES_READ_KEY "Pages read"
 #define MF_ULTRALIGHT_PAGE_KEY "Page"
+#define MF_ULTRALIGHT_PAGES_DATA_KEY "Pages data"
 #define MF_ULTRALIGHT_FAILED_ATTEMPTS_KEY "Failed authentication attempts"
 
 typedef struct {
@@ -23,7 +25,10 @@ typedef struct {
     uint32_t feature_set;
 } MfUltralightFeatures;
 
-static const uint32_t mf_ultralight_data_format_version = 2;
+// Pages read count is saved since this version
+#define MF_ULTRALIGHT_DATA_FORMAT_VERSION_PAGES_READ (2U)
+// Pages are saved packed since this version
+#define MF_ULTRALIGHT_DATA_FORMAT_VERSION_PACKED (3U)
 
 static const MfUltralightFeatures mf_ultralight_features[MfUltralightTypeNum] = {
     [MfUltralightTypeUnknown] =
@@ -161,6 +166,7 @@ const NfcDeviceBase nfc_device_mf_ultralight = {
     .verify = (NfcDeviceVerify)mf_ultralight_verify,
     .load = (NfcDeviceLoad)mf_ultralight_load,
     .save = (NfcDeviceSave)mf_ultralight_save,
+    .save_packed = (NfcDeviceSave)mf_ultralight_save_packed,
     .is_equal = (NfcDeviceEqual)mf_ultralight_is_equal,
     .get_name = (NfcDeviceGetName)mf_ultralight_get_device_name,
     .get_uid = (NfcDeviceGetUid)mf_ultralight_get_uid,
@@ -299,7 +305,7 @@ bool mf_ultralight_load(MfUltralightData* data, FlipperFormat* ff, uint32_t vers
         uint32_t pages_total = 0;
         if(!flipper_format_read_uint32(ff, MF_ULTRALIGHT_PAGES_TOTAL_KEY, &pages_total, 1)) break;
         uint32_t pages_read = 0;
-        if(data_format_version < mf_ultralight_data_format_version) { //-V547
+        if(data_format_version < MF_ULTRALIGHT_DATA_FORMAT_VERSION_PAGES_READ) {
             pages_read = pages_total;
         } else {
             if(!flipper_format_read_uint32(ff, MF_ULTRALIGHT_PAGES_READ_KEY, &pages_read, 1))
@@ -312,15 +318,23 @@ bool mf_ultralight_load(MfUltralightData* data, FlipperFormat* ff, uint32_t vers
             break;
 
         bool pages_parsed = true;
-        for(size_t i = 0; i < pages_total; i++) {
-            furi_string_printf(temp_str, "%s %d", MF_ULTRALIGHT_PAGE_KEY, i);
-            if(!flipper_format_read_hex(
-                   ff,
-                   furi_string_get_cstr(temp_str),
-                   data->page[i].data,
-                   sizeof(MfUltralightPage))) {
-                pages_parsed = false;
-                break;
+        if(data_format_version >= MF_ULTRALIGHT_DATA_FORMAT_VERSION_PACKED) {
+            pages_parsed = nfc_packed_data_read(
+                ff,
+                MF_ULTRALIGHT_PAGES_DATA_KEY,
+                (uint8_t*)data->page,
+                pages_total * sizeof(MfUltralightPage));
+        } else {
+            for(size_t i = 0; i < pages_total; i++) {
+                furi_string_printf(temp_str, "%s %d", MF_ULTRALIGHT_PAGE_KEY, i);
+                if(!flipper_format_read_hex(
+                       ff,
+                       furi_string_get_cstr(temp_str),
+                       data->page[i].data,
+                       sizeof(MfUltralightPage))) {
+                    pages_parsed = false;
+                    break;
+                }
             }
         }
         if(!pages_parsed) break;
@@ -339,10 +353,10 @@ bool mf_ultralight_load(MfUltralightData* data, FlipperFormat* ff, uint32_t vers
     return parsed;
 }
 
-bool mf_ultralight_save(const MfUltralightData* data, FlipperFormat* ff) {
-    furi_check(data);
-    furi_check(ff);
-
+static bool
+    mf_ultralight_save_internal(const MfUltralightData* data, FlipperFormat* ff, bool packed) {
+    uint32_t data_format_version = packed ? MF_ULTRALIGHT_DATA_FORMAT_VERSION_PACKED :
+                                            MF_ULTRALIGHT_DATA_FORMAT_VERSION_PAGES_READ;
     FuriString* temp_str = furi_string_alloc();
     bool saved = false;
 
@@ -352,7 +366,7 @@ bool mf_ultralight_save(const MfUltralightData* data, FlipperFormat* ff) {
         if(!flipper_format_write_comment_cstr(ff, MF_ULTRALIGHT_PROTOCOL_NAME " specific data"))
             break;
         if(!flipper_format_write_uint32(
-               ff, MF_ULTRALIGHT_FORMAT_VERSION_KEY, &mf_ultralight_data_format_version, 1))
+               ff, MF_ULTRALIGHT_FORMAT_VERSION_KEY, &data_format_version, 1))
             break;
 
         const char* device_type_name =
@@ -395,15 +409,23 @@ bool mf_ultralight_save(const MfUltralightData* data, FlipperFormat* ff) {
         if(!flipper_format_write_uint32(ff, MF_ULTRALIGHT_PAGES_TOTAL_KEY, &pages_total, 1)) break;
         if(!flipper_format_write_uint32(ff, MF_ULTRALIGHT_PAGES_READ_KEY, &pages_read, 1)) break;
         bool pages_saved = true;
-        for(size_t i = 0; i < data->pages_total; i++) {
-            furi_string_printf(temp_str, "%s %d", MF_ULTRALIGHT_PAGE_KEY, i);
-            if(!flipper_format_write_hex(
-                   ff,
-                   furi_string_get_cstr(temp_str),
-                   data->page[i].data,
-                   sizeof(MfUltralightPage))) {
-                pages_saved = false;
-                break;
+        if(packed) {
+            pages_saved = nfc_packed_data_write(
+                ff,
+                MF_ULTRALIGHT_PAGES_DATA_KEY,
+                (const uint8_t*)data->page,
+                pages_total * sizeof(MfUltralightPage));
+        } else {
+            for(size_t i = 0; i < pages_total; i++) {
+                furi_string_printf(temp_str, "%s %d", MF_ULTRALIGHT_PAGE_KEY, i);
+                if(!flipper_format_write_hex(
+                       ff,
+                       furi_string_get_cstr(temp_str),
+                       data->page[i].data,
+                       sizeof(MfUltralightPage))) {
+                    pages_saved = false;
+                    break;
+                }
             }
         }
         if(!pages_saved) break;
@@ -421,6 +443,20 @@ bool mf_ultralight_save(const MfUltralightData* data, FlipperFormat* ff) {
     return saved;
 }
 
+bool mf_ultralight_save(const MfUltralightData* data, FlipperFormat* ff) {
+    furi_check(data);
+    furi_check(ff);
+
+    return mf_ultralight_save_internal(data, ff, false);
+}
+
+bool mf_ultralight_save_packed(const MfUltralightData* data, FlipperFormat* ff) {
+    furi_check(data);
+    furi_check(ff);
+
+    return mf_ultralight_save_internal(data, ff, true);
+}
+
 bool mf_ultralight_is_equal(const MfUltralightData* data, const MfUltralightData* other) {
     furi_check(data);
     furi_check(other);
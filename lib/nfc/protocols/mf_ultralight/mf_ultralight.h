@@ -191,6 +191,8 @@ bool mf_ultralight_load(MfUltralightData* data, FlipperFormat* ff, uint32_t vers
 
 bool mf_ultralight_save(const MfUltralightData* data, FlipperFormat* ff);
 
+bool mf_ultralight_save_packed(const MfUltralightData* data, FlipperFormat* ff);
+
 bool mf_ultralight_is_equal(const MfUltralightData* data, const MfUltralightData* other);
 
 const char*
@@ -154,6 +154,7 @@ typedef struct {
     NfcDeviceGetUid get_uid; /**< Pointer to the get_uid() function. */
     NfcDeviceSetUid set_uid; /**< Pointer to the set_uid() function. */
     NfcDeviceGetBaseData get_base_data; /**< Pointer to the get_base_data() function. */
+    NfcDeviceSave save_packed; /**< Optional, packed save() for files not meant for editing. */
 } NfcDeviceBase;
 
 #ifdef __cplusplus
@@ -43,6 +43,14 @@ typedef enum {
     Alutech_at_4nDecoderStepCheckDuration,
 } Alutech_at_4nDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_alutech_at_4n_trigger = {
+    .timing = &subghz_protocol_alutech_at_4n_const,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderAlutech_at_4n, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_alutech_at_4n_decoder = {
     .alloc = subghz_protocol_decoder_alutech_at_4n_alloc,
     .free = subghz_protocol_decoder_alutech_at_4n_free,
@@ -54,6 +62,8 @@ const SubGhzProtocolDecoder subghz_protocol_alutech_at_4n_decoder = {
     .serialize = subghz_protocol_decoder_alutech_at_4n_serialize,
     .deserialize = subghz_protocol_decoder_alutech_at_4n_deserialize,
     .get_string = subghz_protocol_decoder_alutech_at_4n_get_string,
+
+    .trigger = &subghz_protocol_alutech_at_4n_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_alutech_at_4n_encoder = {
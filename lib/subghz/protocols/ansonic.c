@@ -42,6 +42,14 @@ typedef enum {
     AnsonicDecoderStepCheckDuration,
 } AnsonicDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_ansonic_trigger = {
+    .timing = &subghz_protocol_ansonic_const,
+    .te_short_count = 35,
+    .te_delta_count = 35,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderAnsonic, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
     .alloc = subghz_protocol_decoder_ansonic_alloc,
     .free = subghz_protocol_decoder_ansonic_free,
@@ -53,6 +61,8 @@ const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
     .serialize = subghz_protocol_decoder_ansonic_serialize,
     .deserialize = subghz_protocol_decoder_ansonic_deserialize,
     .get_string = subghz_protocol_decoder_ansonic_get_string,
+
+    .trigger = &subghz_protocol_ansonic_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_ansonic_encoder = {
@@ -52,6 +52,14 @@ typedef enum {
     BETTDecoderStepCheckDuration,
 } BETTDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_bett_trigger = {
+    .timing = &subghz_protocol_bett_const,
+    .te_short_count = 44,
+    .te_delta_count = 15,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderBETT, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
     .alloc = subghz_protocol_decoder_bett_alloc,
     .free = subghz_protocol_decoder_bett_free,
@@ -63,6 +71,8 @@ const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
     .serialize = subghz_protocol_decoder_bett_serialize,
     .deserialize = subghz_protocol_decoder_bett_deserialize,
     .get_string = subghz_protocol_decoder_bett_get_string,
+
+    .trigger = &subghz_protocol_bett_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_bett_encoder = {
@@ -48,6 +48,14 @@ typedef enum {
     CameDecoderStepCheckDuration,
 } CameDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_came_trigger = {
+    .timing = &subghz_protocol_came_const,
+    .te_short_count = 56,
+    .te_delta_count = 47,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderCame, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
     .alloc = subghz_protocol_decoder_came_alloc,
     .free = subghz_protocol_decoder_came_free,
@@ -59,6 +67,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
     .serialize = subghz_protocol_decoder_came_serialize,
     .deserialize = subghz_protocol_decoder_came_deserialize,
     .get_string = subghz_protocol_decoder_came_get_string,
+
+    .trigger = &subghz_protocol_came_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_encoder = {
@@ -39,6 +39,14 @@ typedef enum {
     CameAtomoDecoderStepDecoderData,
 } CameAtomoDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_came_atomo_trigger = {
+    .timing = &subghz_protocol_came_atomo_const,
+    .te_long_count = 60,
+    .te_delta_count = 40,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderCameAtomo, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_came_atomo_decoder = {
     .alloc = subghz_protocol_decoder_came_atomo_alloc,
     .free = subghz_protocol_decoder_came_atomo_free,
@@ -50,6 +58,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_atomo_decoder = {
     .serialize = subghz_protocol_decoder_came_atomo_serialize,
     .deserialize = subghz_protocol_decoder_came_atomo_deserialize,
     .get_string = subghz_protocol_decoder_came_atomo_get_string,
+
+    .trigger = &subghz_protocol_came_atomo_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_atomo_encoder = {
@@ -70,6 +70,14 @@ typedef enum {
     CameTweeDecoderStepDecoderData,
 } CameTweeDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_came_twee_trigger = {
+    .timing = &subghz_protocol_came_twee_const,
+    .te_long_count = 51,
+    .te_delta_count = 20,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderCameTwee, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder = {
     .alloc = subghz_protocol_decoder_came_twee_alloc,
     .free = subghz_protocol_decoder_came_twee_free,
@@ -81,6 +89,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder = {
     .serialize = subghz_protocol_decoder_came_twee_serialize,
     .deserialize = subghz_protocol_decoder_came_twee_deserialize,
     .get_string = subghz_protocol_decoder_came_twee_get_string,
+
+    .trigger = &subghz_protocol_came_twee_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_twee_encoder = {
@@ -66,6 +66,14 @@ typedef enum {
     Chamb_CodeDecoderStepCheckDuration,
 } Chamb_CodeDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_chamb_code_trigger = {
+    .timing = &subghz_protocol_chamb_code_const,
+    .te_short_count = 39,
+    .te_delta_count = 20,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderChamb_Code, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_chamb_code_decoder = {
     .alloc = subghz_protocol_decoder_chamb_code_alloc,
     .free = subghz_protocol_decoder_chamb_code_free,
@@ -77,6 +85,8 @@ const SubGhzProtocolDecoder subghz_protocol_chamb_code_decoder = {
     .serialize = subghz_protocol_decoder_chamb_code_serialize,
     .deserialize = subghz_protocol_decoder_chamb_code_deserialize,
     .get_string = subghz_protocol_decoder_chamb_code_get_string,
+
+    .trigger = &subghz_protocol_chamb_code_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_chamb_code_encoder = {
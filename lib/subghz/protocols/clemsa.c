@@ -51,6 +51,14 @@ typedef enum {
     ClemsaDecoderStepCheckDuration,
 } ClemsaDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_clemsa_trigger = {
+    .timing = &subghz_protocol_clemsa_const,
+    .te_short_count = 51,
+    .te_delta_count = 25,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderClemsa, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder = {
     .alloc = subghz_protocol_decoder_clemsa_alloc,
     .free = subghz_protocol_decoder_clemsa_free,
@@ -62,6 +70,8 @@ const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder = {
     .serialize = subghz_protocol_decoder_clemsa_serialize,
     .deserialize = subghz_protocol_decoder_clemsa_deserialize,
     .get_string = subghz_protocol_decoder_clemsa_get_string,
+
+    .trigger = &subghz_protocol_clemsa_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_clemsa_encoder = {
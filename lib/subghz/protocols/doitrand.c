@@ -43,6 +43,14 @@ typedef enum {
     DoitrandDecoderStepCheckDuration,
 } DoitrandDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_doitrand_trigger = {
+    .timing = &subghz_protocol_doitrand_const,
+    .te_short_count = 62,
+    .te_delta_count = 30,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderDoitrand, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder = {
     .alloc = subghz_protocol_decoder_doitrand_alloc,
     .free = subghz_protocol_decoder_doitrand_free,
@@ -54,6 +62,8 @@ const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder = {
     .serialize = subghz_protocol_decoder_doitrand_serialize,
     .deserialize = subghz_protocol_decoder_doitrand_deserialize,
     .get_string = subghz_protocol_decoder_doitrand_get_string,
+
+    .trigger = &subghz_protocol_doitrand_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_doitrand_encoder = {
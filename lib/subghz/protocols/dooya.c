@@ -37,6 +37,14 @@ typedef enum {
     DooyaDecoderStepCheckDuration,
 } DooyaDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_dooya_trigger = {
+    .timing = &subghz_protocol_dooya_const,
+    .te_long_count = 12,
+    .te_delta_count = 20,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderDooya, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_dooya_decoder = {
     .alloc = subghz_protocol_decoder_dooya_alloc,
     .free = subghz_protocol_decoder_dooya_free,
@@ -48,6 +56,8 @@ const SubGhzProtocolDecoder subghz_protocol_dooya_decoder = {
     .serialize = subghz_protocol_decoder_dooya_serialize,
     .deserialize = subghz_protocol_decoder_dooya_deserialize,
     .get_string = subghz_protocol_decoder_dooya_get_string,
+
+    .trigger = &subghz_protocol_dooya_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_dooya_encoder = {
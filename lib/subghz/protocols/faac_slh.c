@@ -36,6 +36,14 @@ typedef enum {
     FaacSLHDecoderStepCheckDuration,
 } FaacSLHDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_faac_slh_trigger = {
+    .timing = &subghz_protocol_faac_slh_const,
+    .te_long_count = 2,
+    .te_delta_count = 3,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderFaacSLH, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder = {
     .alloc = subghz_protocol_decoder_faac_slh_alloc,
     .free = subghz_protocol_decoder_faac_slh_free,
@@ -47,6 +55,8 @@ const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder = {
     .serialize = subghz_protocol_decoder_faac_slh_serialize,
     .deserialize = subghz_protocol_decoder_faac_slh_deserialize,
     .get_string = subghz_protocol_decoder_faac_slh_get_string,
+
+    .trigger = &subghz_protocol_faac_slh_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_faac_slh_encoder = {
@@ -36,6 +36,14 @@ typedef enum {
     GateTXDecoderStepCheckDuration,
 } GateTXDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_gate_tx_trigger = {
+    .timing = &subghz_protocol_gate_tx_const,
+    .te_short_count = 47,
+    .te_delta_count = 47,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderGateTx, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder = {
     .alloc = subghz_protocol_decoder_gate_tx_alloc,
     .free = subghz_protocol_decoder_gate_tx_free,
@@ -47,6 +55,8 @@ const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder = {
     .serialize = subghz_protocol_decoder_gate_tx_serialize,
     .deserialize = subghz_protocol_decoder_gate_tx_deserialize,
     .get_string = subghz_protocol_decoder_gate_tx_get_string,
+
+    .trigger = &subghz_protocol_gate_tx_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_gate_tx_encoder = {
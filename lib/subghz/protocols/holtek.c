@@ -46,6 +46,14 @@ typedef enum {
     HoltekDecoderStepCheckDuration,
 } HoltekDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_holtek_trigger = {
+    .timing = &subghz_protocol_holtek_const,
+    .te_short_count = 36,
+    .te_delta_count = 36,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderHoltek, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
     .alloc = subghz_protocol_decoder_holtek_alloc,
     .free = subghz_protocol_decoder_holtek_free,
@@ -57,6 +65,8 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
     .serialize = subghz_protocol_decoder_holtek_serialize,
     .deserialize = subghz_protocol_decoder_holtek_deserialize,
     .get_string = subghz_protocol_decoder_holtek_get_string,
+
+    .trigger = &subghz_protocol_holtek_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_holtek_encoder = {
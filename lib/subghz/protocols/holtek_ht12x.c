@@ -53,6 +53,14 @@ typedef enum {
     Holtek_HT12XDecoderStepCheckDuration,
 } Holtek_HT12XDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_holtek_th12x_trigger = {
+    .timing = &subghz_protocol_holtek_th12x_const,
+    .te_short_count = 36,
+    .te_delta_count = 36,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderHoltek_HT12X, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_holtek_th12x_decoder = {
     .alloc = subghz_protocol_decoder_holtek_th12x_alloc,
     .free = subghz_protocol_decoder_holtek_th12x_free,
@@ -64,6 +72,8 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_th12x_decoder = {
     .serialize = subghz_protocol_decoder_holtek_th12x_serialize,
     .deserialize = subghz_protocol_decoder_holtek_th12x_deserialize,
     .get_string = subghz_protocol_decoder_holtek_th12x_get_string,
+
+    .trigger = &subghz_protocol_holtek_th12x_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_holtek_th12x_encoder = {
@@ -47,6 +47,14 @@ typedef enum {
     Honeywell_WDBDecoderStepCheckDuration,
 } Honeywell_WDBDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_honeywell_wdb_trigger = {
+    .timing = &subghz_protocol_honeywell_wdb_const,
+    .te_short_count = 3,
+    .te_delta_count = 1,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderHoneywell_WDB, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_honeywell_wdb_decoder = {
     .alloc = subghz_protocol_decoder_honeywell_wdb_alloc,
     .free = subghz_protocol_decoder_honeywell_wdb_free,
@@ -58,6 +66,8 @@ const SubGhzProtocolDecoder subghz_protocol_honeywell_wdb_decoder = {
     .serialize = subghz_protocol_decoder_honeywell_wdb_serialize,
     .deserialize = subghz_protocol_decoder_honeywell_wdb_deserialize,
     .get_string = subghz_protocol_decoder_honeywell_wdb_get_string,
+
+    .trigger = &subghz_protocol_honeywell_wdb_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_honeywell_wdb_encoder = {
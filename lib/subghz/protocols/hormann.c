@@ -40,6 +40,14 @@ typedef enum {
     HormannDecoderStepCheckDuration,
 } HormannDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_hormann_trigger = {
+    .timing = &subghz_protocol_hormann_const,
+    .te_short_count = 24,
+    .te_delta_count = 24,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderHormann, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_hormann_decoder = {
     .alloc = subghz_protocol_decoder_hormann_alloc,
     .free = subghz_protocol_decoder_hormann_free,
@@ -51,6 +59,8 @@ const SubGhzProtocolDecoder subghz_protocol_hormann_decoder = {
     .serialize = subghz_protocol_decoder_hormann_serialize,
     .deserialize = subghz_protocol_decoder_hormann_deserialize,
     .get_string = subghz_protocol_decoder_hormann_get_string,
+
+    .trigger = &subghz_protocol_hormann_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_hormann_encoder = {
@@ -36,6 +36,14 @@ typedef enum {
     IDoDecoderStepCheckDuration,
 } IDoDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_ido_trigger = {
+    .timing = &subghz_protocol_ido_const,
+    .te_short_count = 10,
+    .te_delta_count = 5,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderIDo, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_ido_decoder = {
     .alloc = subghz_protocol_decoder_ido_alloc,
     .free = subghz_protocol_decoder_ido_free,
@@ -47,6 +55,8 @@ const SubGhzProtocolDecoder subghz_protocol_ido_decoder = {
     .deserialize = subghz_protocol_decoder_ido_deserialize,
     .serialize = subghz_protocol_decoder_ido_serialize,
     .get_string = subghz_protocol_decoder_ido_get_string,
+
+    .trigger = &subghz_protocol_ido_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_ido_encoder = {
@@ -45,6 +45,14 @@ typedef enum {
     IntertechnoV3DecoderStepEndDuration,
 } IntertechnoV3DecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_intertechno_v3_trigger = {
+    .timing = &subghz_protocol_intertechno_v3_const,
+    .te_short_count = 37,
+    .te_delta_count = 15,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderIntertechno_V3, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_intertechno_v3_decoder = {
     .alloc = subghz_protocol_decoder_intertechno_v3_alloc,
     .free = subghz_protocol_decoder_intertechno_v3_free,
@@ -56,6 +64,8 @@ const SubGhzProtocolDecoder subghz_protocol_intertechno_v3_decoder = {
     .serialize = subghz_protocol_decoder_intertechno_v3_serialize,
     .deserialize = subghz_protocol_decoder_intertechno_v3_deserialize,
     .get_string = subghz_protocol_decoder_intertechno_v3_get_string,
+
+    .trigger = &subghz_protocol_intertechno_v3_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_intertechno_v3_encoder = {
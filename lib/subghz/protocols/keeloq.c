@@ -1,8 +1,8 @@
 #include "keeloq.h"
 #include "keeloq_common.h"
+#include "keeloq_search.h"
 
 #include "../subghz_keystore.h"
-#include <m-array.h>
 
 #include "../blocks/const.h"
 #include "../blocks/decoder.h"
@@ -27,6 +27,7 @@ struct SubGhzProtocolDecoderKeeloq {
 
     uint16_t header_count;
     SubGhzKeystore* keystore;
+    SubGhzKeeloqSearchCache search_cache;
     const char* manufacture_name;
 };
 
@@ -37,6 +38,7 @@ struct SubGhzProtocolEncoderKeeloq {
     SubGhzBlockGeneric generic;
 
     SubGhzKeystore* keystore;
+    SubGhzKeeloqSearchCache search_cache;
     const char* manufacture_name;
 };
 
@@ -47,6 +49,14 @@ typedef enum {
     KeeloqDecoderStepCheckDuration,
 } KeeloqDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_keeloq_trigger = {
+    .timing = &subghz_protocol_keeloq_const,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderKeeloq, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
     .alloc = subghz_protocol_decoder_keeloq_alloc,
     .free = subghz_protocol_decoder_keeloq_free,
@@ -58,6 +68,8 @@ const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
     .serialize = subghz_protocol_decoder_keeloq_serialize,
     .deserialize = subghz_protocol_decoder_keeloq_deserialize,
     .get_string = subghz_protocol_decoder_keeloq_get_string,
+
+    .trigger = &subghz_protocol_keeloq_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_keeloq_encoder = {
@@ -84,11 +96,13 @@ const SubGhzProtocol subghz_protocol_keeloq = {
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
  * @param keystore Pointer to a SubGhzKeystore* instance
+ * @param search_cache Pointer to a SubGhzKeeloqSearchCache* instance
  * @param manufacture_name
  */
 static void subghz_protocol_keeloq_check_remote_controller(
     SubGhzBlockGeneric* instance,
     SubGhzKeystore* keystore,
+    SubGhzKeeloqSearchCache* search_cache,
     const char** manufacture_name);
 
 void* subghz_protocol_encoder_keeloq_alloc(SubGhzEnvironment* environment) {
@@ -126,36 +140,31 @@ static bool subghz_protocol_keeloq_gen_data(SubGhzProtocolEncoderKeeloq* instanc
                        instance->generic.cnt;
     uint32_t hop = 0;
     uint64_t man = 0;
-    int res = 0;
-
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(instance->keystore), SubGhzKeyArray_t) {
-            res = strcmp(furi_string_get_cstr(manufacture_code->name), instance->manufacture_name);
-            if(res == 0) {
-                switch(manufacture_code->type) {
-                case KEELOQ_LEARNING_SIMPLE:
-                    //Simple Learning
-                    hop = subghz_protocol_keeloq_common_encrypt(decrypt, manufacture_code->key);
-                    break;
-                case KEELOQ_LEARNING_NORMAL:
-                    //Simple Learning
-                    man =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    hop = subghz_protocol_keeloq_common_encrypt(decrypt, man);
-                    break;
-                case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                        instance->generic.serial, manufacture_code->key);
-                    hop = subghz_protocol_keeloq_common_encrypt(decrypt, man);
-                    break;
-                case KEELOQ_LEARNING_UNKNOWN:
-                    //Invalid or missing encoding type in keeloq_mfcodes
-                    hop = 0;
-                    break;
-                }
-                break;
-            }
+
+    const SubGhzKey* manufacture_code =
+        subghz_keystore_find_by_name(instance->keystore, instance->manufacture_name);
+    if(manufacture_code) {
+        switch(manufacture_code->type) {
+        case KEELOQ_LEARNING_SIMPLE:
+            //Simple Learning
+            hop = subghz_protocol_keeloq_common_encrypt(decrypt, manufacture_code->key);
+            break;
+        case KEELOQ_LEARNING_NORMAL:
+            //Simple Learning
+            man = subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
+            hop = subghz_protocol_keeloq_common_encrypt(decrypt, man);
+            break;
+        case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
+            man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
+                instance->generic.serial, manufacture_code->key);
+            hop = subghz_protocol_keeloq_common_encrypt(decrypt, man);
+            break;
+        case KEELOQ_LEARNING_UNKNOWN:
+            //Invalid or missing encoding type in keeloq_mfcodes
+            hop = 0;
+            break;
         }
+    }
     if(hop) {
         uint64_t yek = (uint64_t)fix << 32 | hop;
         instance->generic.data =
@@ -269,7 +278,10 @@ SubGhzProtocolStatus
             break;
         }
         subghz_protocol_keeloq_check_remote_controller(
-            &instance->generic, instance->keystore, &instance->manufacture_name);
+            &instance->generic,
+            instance->keystore,
+            &instance->search_cache,
+            &instance->manufacture_name);
 
         if(strcmp(instance->manufacture_name, "DoorHan") != 0) {
             FURI_LOG_E(TAG, "Wrong manufacturer name");
@@ -480,12 +492,83 @@ static inline bool subghz_protocol_keeloq_check_decrypt_centurion(
     return false;
 }
 
+typedef struct {
+    SubGhzBlockGeneric* instance;
+    uint8_t btn;
+    uint16_t end_serial;
+} SubGhzProtocolKeeloqSearchContext;
+
+static bool subghz_protocol_keeloq_search_check(
+    void* context,
+    const SubGhzKey* key,
+    uint8_t step,
+    uint32_t decrypt) {
+    SubGhzProtocolKeeloqSearchContext* search_context = context;
+
+    // Centurion is only known with normal learning
+    if((key->type == KEELOQ_LEARNING_NORMAL) && (step == SubGhzKeeloqStepNormal) &&
+       (strcmp(key->name, "Centurion") == 0)) {
+        return subghz_protocol_keeloq_check_decrypt_centurion(
+            search_context->instance, decrypt, search_context->btn);
+    }
+    return subghz_protocol_keeloq_check_decrypt(
+        search_context->instance, decrypt, search_context->btn, search_context->end_serial);
+}
+
+// Unknown learning type: every learning, also with mirrored man
+// Normal Learning: https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+static const uint8_t subghz_protocol_keeloq_steps_unknown[] = {
+    SubGhzKeeloqStepSimple,
+    SubGhzKeeloqStepSimple | SubGhzKeeloqStepMirror,
+    SubGhzKeeloqStepNormal,
+    SubGhzKeeloqStepNormal | SubGhzKeeloqStepMirror,
+    SubGhzKeeloqStepSecure,
+    SubGhzKeeloqStepSecure | SubGhzKeeloqStepMirror,
+    SubGhzKeeloqStepMagicXorType1,
+    SubGhzKeeloqStepMagicXorType1 | SubGhzKeeloqStepMirror,
+};
+static const uint8_t subghz_protocol_keeloq_steps_simple[] = {SubGhzKeeloqStepSimple};
+static const uint8_t subghz_protocol_keeloq_steps_normal[] = {SubGhzKeeloqStepNormal};
+static const uint8_t subghz_protocol_keeloq_steps_secure[] = {SubGhzKeeloqStepSecure};
+static const uint8_t subghz_protocol_keeloq_steps_magic_xor_type1[] = {
+    SubGhzKeeloqStepMagicXorType1};
+static const uint8_t subghz_protocol_keeloq_steps_magic_serial_type1[] = {
+    SubGhzKeeloqStepMagicSerialType1};
+static const uint8_t subghz_protocol_keeloq_steps_magic_serial_type2[] = {
+    SubGhzKeeloqStepMagicSerialType2};
+static const uint8_t subghz_protocol_keeloq_steps_magic_serial_type3[] = {
+    SubGhzKeeloqStepMagicSerialType3};
+
+#define KEELOQ_STEPS(array) {.steps = array, .count = COUNT_OF(array)}
+
+static const SubGhzKeeloqSearchSteps subghz_protocol_keeloq_learning[] = {
+    [KEELOQ_LEARNING_UNKNOWN] = KEELOQ_STEPS(subghz_protocol_keeloq_steps_unknown),
+    [KEELOQ_LEARNING_SIMPLE] = KEELOQ_STEPS(subghz_protocol_keeloq_steps_simple),
+    [KEELOQ_LEARNING_NORMAL] = KEELOQ_STEPS(subghz_protocol_keeloq_steps_normal),
+    [KEELOQ_LEARNING_SECURE] = KEELOQ_STEPS(subghz_protocol_keeloq_steps_secure),
+    [KEELOQ_LEARNING_MAGIC_XOR_TYPE_1] =
+        KEELOQ_STEPS(subghz_protocol_keeloq_steps_magic_xor_type1),
+    [KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1] =
+        KEELOQ_STEPS(subghz_protocol_keeloq_steps_magic_serial_type1),
+    [KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2] =
+        KEELOQ_STEPS(subghz_protocol_keeloq_steps_magic_serial_type2),
+    [KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3] =
+        KEELOQ_STEPS(subghz_protocol_keeloq_steps_magic_serial_type3),
+};
+
+static const SubGhzKeeloqSearch subghz_protocol_keeloq_search = {
+    .learning = subghz_protocol_keeloq_learning,
+    .learning_count = COUNT_OF(subghz_protocol_keeloq_learning),
+    .check = subghz_protocol_keeloq_search_check,
+};
+
 /** 
  * Checking the accepted code against the database manafacture key
  * @param instance Pointer to a SubGhzBlockGeneric* instance
  * @param fix Fix part of the parcel
  * @param hop Hop encrypted part of the parcel
  * @param keystore Pointer to a SubGhzKeystore* instance
+ * @param search_cache Pointer to a SubGhzKeeloqSearchCache* instance
  * @param manufacture_name 
  * @return true on successful search
  */
@@ -494,166 +577,29 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
     uint32_t fix,
     uint32_t hop,
     SubGhzKeystore* keystore,
+    SubGhzKeeloqSearchCache* search_cache,
     const char** manufacture_name) {
     // protocol HCS300 uses 10 bits in discriminator, HCS200 uses 8 bits, for backward compatibility, we are looking for the 8-bit pattern
     // HCS300 -> uint16_t end_serial = (uint16_t)(fix & 0x3FF);
     // HCS200 -> uint16_t end_serial = (uint16_t)(fix & 0xFF);
-
-    uint16_t end_serial = (uint16_t)(fix & 0xFF);
-    uint8_t btn = (uint8_t)(fix >> 28);
-    uint32_t decrypt = 0;
-    uint64_t man;
-    uint32_t seed = 0;
-
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            switch(manufacture_code->type) {
-            case KEELOQ_LEARNING_SIMPLE:
-                // Simple Learning
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_NORMAL:
-                // Normal Learning
-                // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                man = subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if((strcmp(furi_string_get_cstr(manufacture_code->name), "Centurion") == 0)) {
-                    if(subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, btn)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        return 1;
-                    }
-                } else {
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        return 1;
-                    }
-                }
-                break;
-            case KEELOQ_LEARNING_SECURE:
-                man = subghz_protocol_keeloq_common_secure_learning(
-                    fix, seed, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
-                man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
-                man = subghz_protocol_keeloq_common_magic_serial_type1_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
-                man = subghz_protocol_keeloq_common_magic_serial_type2_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
-                man = subghz_protocol_keeloq_common_magic_serial_type3_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_UNKNOWN:
-                // Simple Learning
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-
-                // Check for mirrored man
-                uint64_t man_rev = 0;
-                uint64_t man_rev_byte = 0;
-                for(uint8_t i = 0; i < 64; i += 8) {
-                    man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                    man_rev = man_rev | man_rev_byte << (56 - i);
-                }
-
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-
-                //###########################
-                // Normal Learning
-                // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                man = subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-
-                // Check for mirrored man
-                man = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-
-                // Secure Learning
-                man = subghz_protocol_keeloq_common_secure_learning(
-                    fix, seed, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-
-                // Check for mirrored man
-                man = subghz_protocol_keeloq_common_secure_learning(fix, seed, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-
-                // Magic xor type1 learning
-                man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-
-                // Check for mirrored man
-                man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            }
-        }
+    SubGhzProtocolKeeloqSearchContext search_context = {
+        .instance = instance,
+        .btn = (uint8_t)(fix >> 28),
+        .end_serial = (uint16_t)(fix & 0xFF),
+    };
+
+    const SubGhzKey* manufacture_code = subghz_keeloq_search(
+        &subghz_protocol_keeloq_search,
+        keystore,
+        search_cache,
+        fix,
+        hop,
+        fix & 0x0FFFFFFF,
+        &search_context);
+    if(manufacture_code) {
+        *manufacture_name = manufacture_code->name;
+        return 1;
+    }
 
     *manufacture_name = "Unknown";
     instance->cnt = 0;
@@ -664,6 +610,7 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
 static void subghz_protocol_keeloq_check_remote_controller(
     SubGhzBlockGeneric* instance,
     SubGhzKeystore* keystore,
+    SubGhzKeeloqSearchCache* search_cache,
     const char** manufacture_name) {
     uint64_t key = subghz_protocol_blocks_reverse_key(instance->data, instance->data_count_bit);
     uint32_t key_fix = key >> 32;
@@ -678,7 +625,7 @@ static void subghz_protocol_keeloq_check_remote_controller(
         instance->cnt = key_hop >> 16;
     } else {
         subghz_protocol_keeloq_check_remote_controller_selector(
-            instance, key_fix, key_hop, keystore, manufacture_name);
+            instance, key_fix, key_hop, keystore, search_cache, manufacture_name);
     }
 
     instance->serial = key_fix & 0x0FFFFFFF;
@@ -699,7 +646,10 @@ SubGhzProtocolStatus subghz_protocol_decoder_keeloq_serialize(
     furi_assert(context);
     SubGhzProtocolDecoderKeeloq* instance = context;
     subghz_protocol_keeloq_check_remote_controller(
-        &instance->generic, instance->keystore, &instance->manufacture_name);
+        &instance->generic,
+        instance->keystore,
+        &instance->search_cache,
+        &instance->manufacture_name);
 
     SubGhzProtocolStatus res =
         subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
@@ -725,7 +675,10 @@ void subghz_protocol_decoder_keeloq_get_string(void* context, FuriString* output
     furi_assert(context);
     SubGhzProtocolDecoderKeeloq* instance = context;
     subghz_protocol_keeloq_check_remote_controller(
-        &instance->generic, instance->keystore, &instance->manufacture_name);
+        &instance->generic,
+        instance->keystore,
+        &instance->search_cache,
+        &instance->manufacture_name);
 
     uint32_t code_found_hi = instance->generic.data >> 32;
     uint32_t code_found_lo = instance->generic.data & 0x00000000ffffffff;
@@ -35,6 +35,85 @@ inline uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const
     return x;
 }
 
+// Keeloq NLF in algebraic form, inputs from least significant
+static inline uint32_t
+    subghz_protocol_keeloq_common_nlf(uint32_t a, uint32_t b, uint32_t c, uint32_t d, uint32_t e) {
+    uint32_t p = (a | b) ^ (b & c) ^ (d & (a ^ c));
+    uint32_t q = (a & ~b) ^ (c & ~a) ^ (d & (b ^ c));
+    return p ^ (e & q);
+}
+
+// Transpose 32x32 bit matrix: bit j of word i becomes bit i of word j
+static void subghz_protocol_keeloq_common_transpose(uint32_t* matrix) {
+    uint32_t mask = 0x0000FFFF;
+    for(size_t j = 16; j != 0; j >>= 1, mask ^= mask << j) {
+        for(size_t k = 0; k < 32; k = (k + j + 1) & ~j) {
+            uint32_t t = ((matrix[k] >> j) ^ matrix[k + j]) & mask;
+            matrix[k + j] ^= t;
+            matrix[k] ^= t << j;
+        }
+    }
+}
+
+/*
+ * Bitsliced decrypt: bit N of every word belongs to the pair in lane N.
+ * State is kept as a ring of shifted in bits, at round r bit k of the
+ * state is history[(r + 31 - k) & 63].
+ */
+void subghz_protocol_keeloq_common_decrypt_batch(
+    const uint32_t* data,
+    const uint64_t* key,
+    size_t count,
+    uint32_t* decrypt) {
+    furi_check(data);
+    furi_check(key);
+    furi_check(decrypt);
+    furi_check(count <= KEELOQ_BATCH_SIZE);
+
+    uint32_t key_low[32];
+    uint32_t key_high[32];
+    uint32_t history[64];
+
+    for(size_t i = 0; i < 32; i++) {
+        key_low[i] = (i < count) ? (uint32_t)key[i] : 0;
+        key_high[i] = (i < count) ? (uint32_t)(key[i] >> 32) : 0;
+        history[i] = (i < count) ? data[i] : 0;
+    }
+    subghz_protocol_keeloq_common_transpose(key_low);
+    subghz_protocol_keeloq_common_transpose(key_high);
+    subghz_protocol_keeloq_common_transpose(history);
+
+    // Bit k of the data goes to history[31 - k]
+    for(size_t i = 0; i < 16; i++) {
+        uint32_t t = history[i];
+        history[i] = history[31 - i];
+        history[31 - i] = t;
+    }
+
+    for(size_t r = 0; r < 528; r++) {
+        size_t top = r + 31;
+        size_t key_bit = (15 - r) & 63;
+        uint32_t k = (key_bit < 32) ? key_low[key_bit] : key_high[key_bit - 32];
+        uint32_t nlf = subghz_protocol_keeloq_common_nlf(
+            history[top & 63],
+            history[(top - 8) & 63],
+            history[(top - 19) & 63],
+            history[(top - 25) & 63],
+            history[(top - 30) & 63]);
+        history[(top + 1) & 63] = history[(top - 31) & 63] ^ history[(top - 15) & 63] ^ k ^ nlf;
+    }
+
+    uint32_t result[32];
+    for(size_t k = 0; k < 32; k++) {
+        result[k] = history[(528 + 31 - k) & 63];
+    }
+    subghz_protocol_keeloq_common_transpose(result);
+
+    for(size_t i = 0; i < count; i++) {
+        decrypt[i] = result[i];
+    }
+}
+
 /** Normal Learning
  * @param data - serial number (28bit)
  * @param key - manufacture (64bit)
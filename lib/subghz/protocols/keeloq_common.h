@@ -25,6 +25,9 @@
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2 6u
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3 7u
 
+/** Number of keys decrypted at once, one key per bit of a machine word */
+#define KEELOQ_BATCH_SIZE (32U)
+
 /**
  * Simple Learning Encrypt
  * @param data - 0xBSSSCCCC, B(4bit) key, S(10bit) serial&0x3FF, C(16bit) counter
@@ -41,6 +44,20 @@ uint32_t subghz_protocol_keeloq_common_encrypt(const uint32_t data, const uint64
  */
 uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const uint64_t key);
 
+/** 
+ * Simple Learning Decrypt of a batch, bitsliced
+ * Same result as subghz_protocol_keeloq_common_decrypt() for every pair of data and key.
+ * @param data - keeloq encrypt data, one per key
+ * @param key - manufacture (64bit), up to KEELOQ_BATCH_SIZE keys
+ * @param count - number of keys
+ * @param decrypt - array to store decrypted data, one per key
+ */
+void subghz_protocol_keeloq_common_decrypt_batch(
+    const uint32_t* data,
+    const uint64_t* key,
+    size_t count,
+    uint32_t* decrypt);
+
 /** 
  * Normal Learning
  * @param data - serial number (28bit)
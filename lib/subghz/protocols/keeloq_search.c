@@ -0,0 +1,200 @@
+#include "keeloq_search.h"
+
+#include <furi.h>
+
+#define SUBGHZ_KEELOQ_SEARCH_NOT_FOUND KEELOQ_BATCH_SIZE
+
+// Seed is not known from a parcel, secure learning is checked with zero seed
+#define SUBGHZ_KEELOQ_SEARCH_SECURE_SEED 0
+
+typedef struct {
+    const SubGhzKey* key[KEELOQ_BATCH_SIZE];
+    size_t key_index[KEELOQ_BATCH_SIZE];
+    uint8_t step[KEELOQ_BATCH_SIZE];
+    uint64_t man[KEELOQ_BATCH_SIZE];
+    uint32_t data[KEELOQ_BATCH_SIZE];
+    uint32_t learning_low[KEELOQ_BATCH_SIZE];
+    uint32_t learning_high[KEELOQ_BATCH_SIZE];
+    uint32_t decrypt[KEELOQ_BATCH_SIZE];
+    size_t count;
+} SubGhzKeeloqSearchBatch;
+
+static void subghz_keeloq_search_batch_add(
+    SubGhzKeeloqSearchBatch* batch,
+    const SubGhzKey* key,
+    size_t key_index,
+    uint8_t step) {
+    size_t i = batch->count++;
+    batch->key[i] = key;
+    batch->key_index[i] = key_index;
+    batch->step[i] = step;
+    batch->man[i] = (step & SubGhzKeeloqStepMirror) ? __builtin_bswap64(key->key) : key->key;
+}
+
+/** Derive manufacture keys, decrypt hop and check in order
+ * @return index of the first match in the batch or SUBGHZ_KEELOQ_SEARCH_NOT_FOUND
+ */
+static size_t subghz_keeloq_search_batch_flush(
+    const SubGhzKeeloqSearch* search,
+    SubGhzKeeloqSearchBatch* batch,
+    uint32_t fix,
+    uint32_t hop,
+    void* context) {
+    const uint32_t serial = fix & 0x0FFFFFFF;
+    const size_t count = batch->count;
+    bool has_learning = false;
+
+    // Normal and secure learning take two decrypts with the keystore key
+    for(size_t i = 0; i < count; i++) {
+        uint8_t step = batch->step[i] & ~SubGhzKeeloqStepMirror;
+        if(step == SubGhzKeeloqStepNormal) {
+            batch->data[i] = serial | 0x20000000;
+            batch->learning_high[i] = serial | 0x60000000;
+            has_learning = true;
+        } else if(step == SubGhzKeeloqStepSecure) {
+            batch->data[i] = serial;
+            batch->learning_high[i] = SUBGHZ_KEELOQ_SEARCH_SECURE_SEED;
+            has_learning = true;
+        } else {
+            batch->data[i] = 0;
+            batch->learning_high[i] = 0;
+        }
+    }
+    if(has_learning) {
+        subghz_protocol_keeloq_common_decrypt_batch(
+            batch->data, batch->man, count, batch->learning_low);
+        memcpy(batch->data, batch->learning_high, sizeof(uint32_t) * count);
+        subghz_protocol_keeloq_common_decrypt_batch(
+            batch->data, batch->man, count, batch->learning_high);
+    }
+
+    for(size_t i = 0; i < count; i++) {
+        uint64_t man = batch->man[i];
+        switch(batch->step[i] & ~SubGhzKeeloqStepMirror) {
+        case SubGhzKeeloqStepNormal:
+            man = ((uint64_t)batch->learning_high[i] << 32) | batch->learning_low[i];
+            break;
+        case SubGhzKeeloqStepSecure:
+            man = ((uint64_t)batch->learning_low[i] << 32) | batch->learning_high[i];
+            break;
+        case SubGhzKeeloqStepMagicXorType1:
+            man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man);
+            break;
+        case SubGhzKeeloqStepMagicSerialType1:
+            man = subghz_protocol_keeloq_common_magic_serial_type1_learning(fix, man);
+            break;
+        case SubGhzKeeloqStepMagicSerialType2:
+            man = subghz_protocol_keeloq_common_magic_serial_type2_learning(fix, man);
+            break;
+        case SubGhzKeeloqStepMagicSerialType3:
+            man = subghz_protocol_keeloq_common_magic_serial_type3_learning(fix, man);
+            break;
+        default:
+            break;
+        }
+        batch->man[i] = man;
+        batch->data[i] = hop;
+    }
+    subghz_protocol_keeloq_common_decrypt_batch(batch->data, batch->man, count, batch->decrypt);
+
+    size_t found = SUBGHZ_KEELOQ_SEARCH_NOT_FOUND;
+    for(size_t i = 0; i < count; i++) {
+        if(search->check(context, batch->key[i], batch->step[i], batch->decrypt[i])) {
+            found = i;
+            break;
+        }
+    }
+
+    batch->count = 0;
+    return found;
+}
+
+static SubGhzKeeloqSearchCacheEntry*
+    subghz_keeloq_search_cache_get(SubGhzKeeloqSearchCache* cache, uint32_t serial) {
+    for(size_t i = 0; i < SUBGHZ_KEELOQ_SEARCH_CACHE_SIZE; i++) {
+        if(cache->entries[i].valid && (cache->entries[i].serial == serial)) {
+            return &cache->entries[i];
+        }
+    }
+    return NULL;
+}
+
+static void subghz_keeloq_search_cache_set(
+    SubGhzKeeloqSearchCache* cache,
+    uint32_t serial,
+    size_t key_index,
+    uint8_t step) {
+    if(key_index > UINT16_MAX) return;
+
+    SubGhzKeeloqSearchCacheEntry* entry = subghz_keeloq_search_cache_get(cache, serial);
+    if(!entry) {
+        entry = &cache->entries[cache->next];
+        cache->next = (cache->next + 1) % SUBGHZ_KEELOQ_SEARCH_CACHE_SIZE;
+    }
+
+    entry->serial = serial;
+    entry->key_index = key_index;
+    entry->step = step;
+    entry->valid = true;
+}
+
+const SubGhzKey* subghz_keeloq_search(
+    const SubGhzKeeloqSearch* search,
+    SubGhzKeystore* keystore,
+    SubGhzKeeloqSearchCache* cache,
+    uint32_t fix,
+    uint32_t hop,
+    uint32_t serial,
+    void* context) {
+    furi_check(search);
+    furi_check(keystore);
+
+    size_t keys_count = 0;
+    const SubGhzKey* keys = subghz_keystore_get_keys(keystore, &keys_count);
+    SubGhzKeeloqSearchBatch* batch = malloc(sizeof(SubGhzKeeloqSearchBatch));
+    batch->count = 0;
+    const SubGhzKey* key = NULL;
+    size_t found = SUBGHZ_KEELOQ_SEARCH_NOT_FOUND;
+
+    // Keystore may change after the key was remembered, the check tells if it is still right
+    SubGhzKeeloqSearchCacheEntry* entry = cache ? subghz_keeloq_search_cache_get(cache, serial) :
+                                                  NULL;
+    if(entry && (entry->key_index < keys_count)) {
+        subghz_keeloq_search_batch_add(
+            batch, &keys[entry->key_index], entry->key_index, entry->step);
+        found = subghz_keeloq_search_batch_flush(search, batch, fix, hop, context);
+    }
+
+    if(found == SUBGHZ_KEELOQ_SEARCH_NOT_FOUND) {
+        for(size_t i = 0; (i < keys_count) && (found == SUBGHZ_KEELOQ_SEARCH_NOT_FOUND); i++) {
+            const SubGhzKey* manufacture_code = &keys[i];
+            if(manufacture_code->type >= search->learning_count) continue;
+
+            const SubGhzKeeloqSearchSteps* learning = &search->learning[manufacture_code->type];
+            for(size_t s = 0; s < learning->count; s++) {
+                subghz_keeloq_search_batch_add(batch, manufacture_code, i, learning->steps[s]);
+                if(batch->count == KEELOQ_BATCH_SIZE) {
+                    found = subghz_keeloq_search_batch_flush(search, batch, fix, hop, context);
+                    if(found != SUBGHZ_KEELOQ_SEARCH_NOT_FOUND) break;
+                }
+            }
+        }
+
+        if((found == SUBGHZ_KEELOQ_SEARCH_NOT_FOUND) && batch->count) {
+            found = subghz_keeloq_search_batch_flush(search, batch, fix, hop, context);
+        }
+
+        if(cache && (found != SUBGHZ_KEELOQ_SEARCH_NOT_FOUND)) {
+            subghz_keeloq_search_cache_set(
+                cache, serial, batch->key_index[found], batch->step[found]);
+        }
+    }
+
+    if(found != SUBGHZ_KEELOQ_SEARCH_NOT_FOUND) {
+        key = batch->key[found];
+    }
+
+    free(batch);
+
+    return key;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "keeloq_common.h"
+#include "../subghz_keystore.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Manufacture key search for KeeLoq based protocols.
+ * Every keystore key is tried with the learning steps of its type, in
+ * keystore order, hop decrypts are done KEELOQ_BATCH_SIZE at a time.
+ */
+
+typedef enum {
+    SubGhzKeeloqStepSimple,
+    SubGhzKeeloqStepNormal,
+    SubGhzKeeloqStepSecure,
+    SubGhzKeeloqStepMagicXorType1,
+    SubGhzKeeloqStepMagicSerialType1,
+    SubGhzKeeloqStepMagicSerialType2,
+    SubGhzKeeloqStepMagicSerialType3,
+
+    SubGhzKeeloqStepMirror = 0x80, /**< Flag, keystore key with mirrored byte order */
+} SubGhzKeeloqStep;
+
+/** Learning steps for a keystore key type */
+typedef struct {
+    const uint8_t* steps;
+    size_t count;
+} SubGhzKeeloqSearchSteps;
+
+/**
+ * Check decrypted hop
+ * @param context Check context
+ * @param key Keystore key the manufacture key comes from
+ * @param step Learning step, SubGhzKeeloqStep
+ * @param decrypt Decrypted hop
+ * @return true if the manufacture key is found
+ */
+typedef bool (*SubGhzKeeloqSearchCheck)(
+    void* context,
+    const SubGhzKey* key,
+    uint8_t step,
+    uint32_t decrypt);
+
+typedef struct {
+    const SubGhzKeeloqSearchSteps* learning; /**< Steps indexed by KEELOQ_LEARNING_* type */
+    size_t learning_count;
+    SubGhzKeeloqSearchCheck check;
+} SubGhzKeeloqSearch;
+
+#define SUBGHZ_KEELOQ_SEARCH_CACHE_SIZE (8U)
+
+typedef struct {
+    uint32_t serial;
+    uint16_t key_index;
+    uint8_t step;
+    bool valid;
+} SubGhzKeeloqSearchCacheEntry;
+
+/** Keys found for recently seen serials */
+typedef struct {
+    SubGhzKeeloqSearchCacheEntry entries[SUBGHZ_KEELOQ_SEARCH_CACHE_SIZE];
+    size_t next;
+} SubGhzKeeloqSearchCache;
+
+/**
+ * Find manufacture key for a parcel
+ * Key remembered for the serial is checked first, then the whole keystore.
+ * @param search Pointer to a SubGhzKeeloqSearch protocol description
+ * @param keystore Pointer to a SubGhzKeystore* instance
+ * @param cache Pointer to a SubGhzKeeloqSearchCache, NULL to search without cache
+ * @param fix Fix part of the parcel
+ * @param hop Hop encrypted part of the parcel
+ * @param serial Serial number, cache key
+ * @param context Check context
+ * @return found keystore key or NULL
+ */
+const SubGhzKey* subghz_keeloq_search(
+    const SubGhzKeeloqSearch* search,
+    SubGhzKeystore* keystore,
+    SubGhzKeeloqSearchCache* cache,
+    uint32_t fix,
+    uint32_t hop,
+    uint32_t serial,
+    void* context);
+
+#ifdef __cplusplus
+}
+#endif
@@ -38,6 +38,14 @@ typedef enum {
     KIADecoderStepCheckDuration,
 } KIADecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_kia_trigger = {
+    .timing = &subghz_protocol_kia_const,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderKIA, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_kia_decoder = {
     .alloc = subghz_protocol_decoder_kia_alloc,
     .free = subghz_protocol_decoder_kia_free,
@@ -49,6 +57,8 @@ const SubGhzProtocolDecoder subghz_protocol_kia_decoder = {
     .serialize = subghz_protocol_decoder_kia_serialize,
     .deserialize = subghz_protocol_decoder_kia_deserialize,
     .get_string = subghz_protocol_decoder_kia_get_string,
+
+    .trigger = &subghz_protocol_kia_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_kia_encoder = {
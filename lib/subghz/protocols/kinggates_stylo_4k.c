@@ -43,6 +43,14 @@ typedef enum {
     KingGates_stylo_4kDecoderStepCheckDuration,
 } KingGates_stylo_4kDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_kinggates_stylo_4k_trigger = {
+    .timing = &subghz_protocol_kinggates_stylo_4k_const,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderKingGates_stylo_4k, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_kinggates_stylo_4k_decoder = {
     .alloc = subghz_protocol_decoder_kinggates_stylo_4k_alloc,
     .free = subghz_protocol_decoder_kinggates_stylo_4k_free,
@@ -54,6 +62,8 @@ const SubGhzProtocolDecoder subghz_protocol_kinggates_stylo_4k_decoder = {
     .serialize = subghz_protocol_decoder_kinggates_stylo_4k_serialize,
     .deserialize = subghz_protocol_decoder_kinggates_stylo_4k_deserialize,
     .get_string = subghz_protocol_decoder_kinggates_stylo_4k_get_string,
+
+    .trigger = &subghz_protocol_kinggates_stylo_4k_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_kinggates_stylo_4k_encoder = {
@@ -233,17 +243,19 @@ static void subghz_protocol_kinggates_stylo_4k_remote_controller(
     instance->btn = (fix >> 17) & 0x0F;
     instance->serial = ((fix >> 5) & 0xFFFF0000) | (fix & 0xFFFF);
 
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(manufacture_code->type == KEELOQ_LEARNING_SIMPLE) {
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(((decrypt >> 28) == instance->btn) && (((decrypt >> 24) & 0x0F) == 0x0C) &&
-                   (((decrypt >> 16) & 0xFF) == (instance->serial & 0xFF))) {
-                    ret = true;
-                    break;
-                }
-            }
+    size_t keys_count = 0;
+    const SubGhzKey* keys = subghz_keystore_get_keys(keystore, &keys_count);
+    size_t simple_count = 0;
+    const uint16_t* simple =
+        subghz_keystore_get_type_index(keystore, KEELOQ_LEARNING_SIMPLE, &simple_count);
+    for(size_t i = 0; i < simple_count; i++) {
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, keys[simple[i]].key);
+        if(((decrypt >> 28) == instance->btn) && (((decrypt >> 24) & 0x0F) == 0x0C) &&
+           (((decrypt >> 16) & 0xFF) == (instance->serial & 0xFF))) {
+            ret = true;
+            break;
         }
+    }
     if(ret) {
         instance->cnt = decrypt & 0xFFFF;
     } else {
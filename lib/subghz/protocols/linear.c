@@ -42,6 +42,14 @@ typedef enum {
     LinearDecoderStepCheckDuration,
 } LinearDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_linear_trigger = {
+    .timing = &subghz_protocol_linear_const,
+    .te_short_count = 42,
+    .te_delta_count = 20,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderLinear, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
     .alloc = subghz_protocol_decoder_linear_alloc,
     .free = subghz_protocol_decoder_linear_free,
@@ -53,6 +61,8 @@ const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
     .serialize = subghz_protocol_decoder_linear_serialize,
     .deserialize = subghz_protocol_decoder_linear_deserialize,
     .get_string = subghz_protocol_decoder_linear_get_string,
+
+    .trigger = &subghz_protocol_linear_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_linear_encoder = {
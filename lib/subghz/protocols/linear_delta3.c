@@ -43,6 +43,14 @@ typedef enum {
     LinearDecoderStepCheckDuration,
 } LinearDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_linear_delta3_trigger = {
+    .timing = &subghz_protocol_linear_delta3_const,
+    .te_short_count = 70,
+    .te_delta_count = 24,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderLinearDelta3, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_linear_delta3_decoder = {
     .alloc = subghz_protocol_decoder_linear_delta3_alloc,
     .free = subghz_protocol_decoder_linear_delta3_free,
@@ -54,6 +62,8 @@ const SubGhzProtocolDecoder subghz_protocol_linear_delta3_decoder = {
     .serialize = subghz_protocol_decoder_linear_delta3_serialize,
     .deserialize = subghz_protocol_decoder_linear_delta3_deserialize,
     .get_string = subghz_protocol_decoder_linear_delta3_get_string,
+
+    .trigger = &subghz_protocol_linear_delta3_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_linear_delta3_encoder = {
@@ -38,6 +38,14 @@ typedef enum {
     MagellanDecoderStepCheckDuration,
 } MagellanDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_magellan_trigger = {
+    .timing = &subghz_protocol_magellan_const,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderMagellan, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_magellan_decoder = {
     .alloc = subghz_protocol_decoder_magellan_alloc,
     .free = subghz_protocol_decoder_magellan_free,
@@ -49,6 +57,8 @@ const SubGhzProtocolDecoder subghz_protocol_magellan_decoder = {
     .serialize = subghz_protocol_decoder_magellan_serialize,
     .deserialize = subghz_protocol_decoder_magellan_deserialize,
     .get_string = subghz_protocol_decoder_magellan_get_string,
+
+    .trigger = &subghz_protocol_magellan_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_magellan_encoder = {
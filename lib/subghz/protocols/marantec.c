@@ -38,6 +38,14 @@ typedef enum {
     MarantecDecoderStepDecoderData,
 } MarantecDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_marantec_trigger = {
+    .timing = &subghz_protocol_marantec_const,
+    .te_long_count = 5,
+    .te_delta_count = 8,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderMarantec, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_marantec_decoder = {
     .alloc = subghz_protocol_decoder_marantec_alloc,
     .free = subghz_protocol_decoder_marantec_free,
@@ -49,6 +57,8 @@ const SubGhzProtocolDecoder subghz_protocol_marantec_decoder = {
     .serialize = subghz_protocol_decoder_marantec_serialize,
     .deserialize = subghz_protocol_decoder_marantec_deserialize,
     .get_string = subghz_protocol_decoder_marantec_get_string,
+
+    .trigger = &subghz_protocol_marantec_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_marantec_encoder = {
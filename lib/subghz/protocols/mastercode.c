@@ -50,6 +50,14 @@ typedef enum {
     MastercodeDecoderStepCheckDuration,
 } MastercodeDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_mastercode_trigger = {
+    .timing = &subghz_protocol_mastercode_const,
+    .te_short_count = 15,
+    .te_delta_count = 15,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderMastercode, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_mastercode_decoder = {
     .alloc = subghz_protocol_decoder_mastercode_alloc,
     .free = subghz_protocol_decoder_mastercode_free,
@@ -61,6 +69,8 @@ const SubGhzProtocolDecoder subghz_protocol_mastercode_decoder = {
     .serialize = subghz_protocol_decoder_mastercode_serialize,
     .deserialize = subghz_protocol_decoder_mastercode_deserialize,
     .get_string = subghz_protocol_decoder_mastercode_get_string,
+
+    .trigger = &subghz_protocol_mastercode_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_mastercode_encoder = {
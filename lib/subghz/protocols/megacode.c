@@ -48,6 +48,14 @@ typedef enum {
     MegaCodeDecoderStepCheckDuration,
 } MegaCodeDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_megacode_trigger = {
+    .timing = &subghz_protocol_megacode_const,
+    .te_short_count = 13,
+    .te_delta_count = 17,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderMegaCode, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_megacode_decoder = {
     .alloc = subghz_protocol_decoder_megacode_alloc,
     .free = subghz_protocol_decoder_megacode_free,
@@ -59,6 +67,8 @@ const SubGhzProtocolDecoder subghz_protocol_megacode_decoder = {
     .serialize = subghz_protocol_decoder_megacode_serialize,
     .deserialize = subghz_protocol_decoder_megacode_deserialize,
     .get_string = subghz_protocol_decoder_megacode_get_string,
+
+    .trigger = &subghz_protocol_megacode_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_megacode_encoder = {
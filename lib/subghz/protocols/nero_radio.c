@@ -38,6 +38,14 @@ typedef enum {
     NeroRadioDecoderStepCheckDuration,
 } NeroRadioDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_nero_radio_trigger = {
+    .timing = &subghz_protocol_nero_radio_const,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderNeroRadio, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_nero_radio_decoder = {
     .alloc = subghz_protocol_decoder_nero_radio_alloc,
     .free = subghz_protocol_decoder_nero_radio_free,
@@ -49,6 +57,8 @@ const SubGhzProtocolDecoder subghz_protocol_nero_radio_decoder = {
     .serialize = subghz_protocol_decoder_nero_radio_serialize,
     .deserialize = subghz_protocol_decoder_nero_radio_deserialize,
     .get_string = subghz_protocol_decoder_nero_radio_get_string,
+
+    .trigger = &subghz_protocol_nero_radio_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nero_radio_encoder = {
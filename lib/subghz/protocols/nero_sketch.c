@@ -37,6 +37,14 @@ typedef enum {
     NeroSketchDecoderStepCheckDuration,
 } NeroSketchDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_nero_sketch_trigger = {
+    .timing = &subghz_protocol_nero_sketch_const,
+    .te_short_count = 1,
+    .te_delta_count = 1,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderNeroSketch, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_nero_sketch_decoder = {
     .alloc = subghz_protocol_decoder_nero_sketch_alloc,
     .free = subghz_protocol_decoder_nero_sketch_free,
@@ -48,6 +56,8 @@ const SubGhzProtocolDecoder subghz_protocol_nero_sketch_decoder = {
     .serialize = subghz_protocol_decoder_nero_sketch_serialize,
     .deserialize = subghz_protocol_decoder_nero_sketch_deserialize,
     .get_string = subghz_protocol_decoder_nero_sketch_get_string,
+
+    .trigger = &subghz_protocol_nero_sketch_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nero_sketch_encoder = {
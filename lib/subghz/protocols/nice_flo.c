@@ -35,6 +35,14 @@ typedef enum {
     NiceFloDecoderStepCheckDuration,
 } NiceFloDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_nice_flo_trigger = {
+    .timing = &subghz_protocol_nice_flo_const,
+    .te_short_count = 36,
+    .te_delta_count = 36,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderNiceFlo, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
     .alloc = subghz_protocol_decoder_nice_flo_alloc,
     .free = subghz_protocol_decoder_nice_flo_free,
@@ -46,6 +54,8 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
     .serialize = subghz_protocol_decoder_nice_flo_serialize,
     .deserialize = subghz_protocol_decoder_nice_flo_deserialize,
     .get_string = subghz_protocol_decoder_nice_flo_get_string,
+
+    .trigger = &subghz_protocol_nice_flo_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flo_encoder = {
@@ -49,6 +49,14 @@ typedef enum {
     NiceFlorSDecoderStepCheckDuration,
 } NiceFlorSDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_nice_flor_s_trigger = {
+    .timing = &subghz_protocol_nice_flor_s_const,
+    .te_short_count = 38,
+    .te_delta_count = 38,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderNiceFlorS, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
     .alloc = subghz_protocol_decoder_nice_flor_s_alloc,
     .free = subghz_protocol_decoder_nice_flor_s_free,
@@ -60,6 +68,8 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
     .serialize = subghz_protocol_decoder_nice_flor_s_serialize,
     .deserialize = subghz_protocol_decoder_nice_flor_s_deserialize,
     .get_string = subghz_protocol_decoder_nice_flor_s_get_string,
+
+    .trigger = &subghz_protocol_nice_flor_s_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flor_s_encoder = {
@@ -38,6 +38,14 @@ typedef enum {
     Phoenix_V2DecoderStepCheckDuration,
 } Phoenix_V2DecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_phoenix_v2_trigger = {
+    .timing = &subghz_protocol_phoenix_v2_const,
+    .te_short_count = 60,
+    .te_delta_count = 30,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderPhoenix_V2, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_phoenix_v2_decoder = {
     .alloc = subghz_protocol_decoder_phoenix_v2_alloc,
     .free = subghz_protocol_decoder_phoenix_v2_free,
@@ -49,6 +57,8 @@ const SubGhzProtocolDecoder subghz_protocol_phoenix_v2_decoder = {
     .serialize = subghz_protocol_decoder_phoenix_v2_serialize,
     .deserialize = subghz_protocol_decoder_phoenix_v2_deserialize,
     .get_string = subghz_protocol_decoder_phoenix_v2_get_string,
+
+    .trigger = &subghz_protocol_phoenix_v2_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_phoenix_v2_encoder = {
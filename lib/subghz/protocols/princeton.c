@@ -46,6 +46,14 @@ typedef enum {
     PrincetonDecoderStepCheckDuration,
 } PrincetonDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_princeton_trigger = {
+    .timing = &subghz_protocol_princeton_const,
+    .te_short_count = 36,
+    .te_delta_count = 36,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderPrinceton, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_princeton_decoder = {
     .alloc = subghz_protocol_decoder_princeton_alloc,
     .free = subghz_protocol_decoder_princeton_free,
@@ -57,6 +65,8 @@ const SubGhzProtocolDecoder subghz_protocol_princeton_decoder = {
     .serialize = subghz_protocol_decoder_princeton_serialize,
     .deserialize = subghz_protocol_decoder_princeton_deserialize,
     .get_string = subghz_protocol_decoder_princeton_get_string,
+
+    .trigger = &subghz_protocol_princeton_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_princeton_encoder = {
@@ -1,6 +1,7 @@
 #include "raw.h"
 #include <lib/flipper_format/flipper_format.h>
 #include "../subghz_file_encoder_worker.h"
+#include "../subghz_raw_file.h"
 
 #include "../blocks/const.h"
 #include "../blocks/decoder.h"
@@ -31,6 +32,7 @@ struct SubGhzProtocolDecoderRAW {
     uint32_t file_is_open;
     FuriString* file_name;
     size_t sample_write;
+    SubGhzProtocolRAWEncoding encoding;
     bool last_level;
     bool pause;
 };
@@ -157,6 +159,14 @@ bool subghz_protocol_raw_save_to_file_init(
             FURI_LOG_E(TAG, "Unable to add Protocol");
             break;
         }
+        if(instance->encoding == SubGhzProtocolRAWEncodingVarint &&
+           !flipper_format_write_string_cstr(
+               instance->flipper_file,
+               SUBGHZ_RAW_FILE_ENCODING_KEY,
+               SUBGHZ_RAW_FILE_ENCODING_VARINT)) {
+            FURI_LOG_E(TAG, "Unable to add " SUBGHZ_RAW_FILE_ENCODING_KEY);
+            break;
+        }
 
         instance->upload_raw = malloc(SUBGHZ_DOWNLOAD_MAX_SIZE * sizeof(int32_t));
         instance->file_is_open = RAWFileIsOpenWrite;
@@ -176,8 +186,18 @@ static bool subghz_protocol_raw_save_to_file_write(SubGhzProtocolDecoderRAW* ins
 
     bool is_write = false;
     if(instance->file_is_open == RAWFileIsOpenWrite) {
-        if(!flipper_format_write_int32(
-               instance->flipper_file, "RAW_Data", instance->upload_raw, instance->ind_write)) {
+        bool written = false;
+        if(instance->encoding == SubGhzProtocolRAWEncodingVarint) {
+            written = subghz_raw_file_write_blocks(
+                flipper_format_get_raw_stream(instance->flipper_file),
+                instance->upload_raw,
+                instance->ind_write);
+        } else {
+            written = flipper_format_write_int32(
+                instance->flipper_file, "RAW_Data", instance->upload_raw, instance->ind_write);
+        }
+
+        if(!written) {
             FURI_LOG_E(TAG, "Unable to add RAW_Data");
         } else {
             instance->sample_write += instance->ind_write;
@@ -188,6 +208,15 @@ static bool subghz_protocol_raw_save_to_file_write(SubGhzProtocolDecoderRAW* ins
     return is_write;
 }
 
+void subghz_protocol_raw_save_to_file_set_encoding(
+    SubGhzProtocolDecoderRAW* instance,
+    SubGhzProtocolRAWEncoding encoding) {
+    furi_check(instance);
+    furi_check(instance->file_is_open == RAWFileIsOpenClose);
+
+    instance->encoding = encoding;
+}
+
 void subghz_protocol_raw_save_to_file_stop(SubGhzProtocolDecoderRAW* instance) {
     furi_check(instance);
 
@@ -223,6 +252,7 @@ void* subghz_protocol_decoder_raw_alloc(SubGhzEnvironment* environment) {
     instance->base.protocol = &subghz_protocol_raw;
     instance->upload_raw = NULL;
     instance->ind_write = 0;
+    instance->encoding = SubGhzProtocolRAWEncodingText;
     instance->last_level = false;
     instance->file_is_open = RAWFileIsOpenClose;
     instance->file_name = furi_string_alloc();
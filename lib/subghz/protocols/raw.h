@@ -13,6 +13,11 @@ typedef void (*SubGhzProtocolEncoderRAWCallbackEnd)(void* context);
 typedef struct SubGhzProtocolDecoderRAW SubGhzProtocolDecoderRAW;
 typedef struct SubGhzProtocolEncoderRAW SubGhzProtocolEncoderRAW;
 
+typedef enum {
+    SubGhzProtocolRAWEncodingText, /**< RAW_Data lines of decimal durations */
+    SubGhzProtocolRAWEncodingVarint, /**< Binary blocks of varint durations */
+} SubGhzProtocolRAWEncoding;
+
 extern const SubGhzProtocolDecoder subghz_protocol_raw_decoder;
 extern const SubGhzProtocolEncoder subghz_protocol_raw_encoder;
 extern const SubGhzProtocol subghz_protocol_raw;
@@ -29,6 +34,16 @@ bool subghz_protocol_raw_save_to_file_init(
     const char* dev_name,
     SubGhzRadioPreset* preset);
 
+/**
+ * Set encoding of the durations for the next file opened for writing
+ * Text is the default, playback supports both encodings.
+ * @param instance Pointer to a SubGhzProtocolDecoderRAW instance
+ * @param encoding Durations encoding, SubGhzProtocolRAWEncoding
+ */
+void subghz_protocol_raw_save_to_file_set_encoding(
+    SubGhzProtocolDecoderRAW* instance,
+    SubGhzProtocolRAWEncoding encoding);
+
 /**
  * Stop writing file to flash
  * @param instance Pointer to a SubGhzProtocolDecoderRAW instance
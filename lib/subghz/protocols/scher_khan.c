@@ -44,6 +44,14 @@ typedef enum {
     ScherKhanDecoderStepCheckDuration,
 } ScherKhanDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_scher_khan_trigger = {
+    .timing = &subghz_protocol_scher_khan_const,
+    .te_short_count = 2,
+    .te_delta_count = 1,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderScherKhan, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_scher_khan_decoder = {
     .alloc = subghz_protocol_decoder_scher_khan_alloc,
     .free = subghz_protocol_decoder_scher_khan_free,
@@ -55,6 +63,8 @@ const SubGhzProtocolDecoder subghz_protocol_scher_khan_decoder = {
     .serialize = subghz_protocol_decoder_scher_khan_serialize,
     .deserialize = subghz_protocol_decoder_scher_khan_deserialize,
     .get_string = subghz_protocol_decoder_scher_khan_get_string,
+
+    .trigger = &subghz_protocol_scher_khan_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_scher_khan_encoder = {
@@ -59,6 +59,14 @@ typedef enum {
     SecPlus_v1DecoderStepDecoderData,
 } SecPlus_v1DecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_secplus_v1_trigger = {
+    .timing = &subghz_protocol_secplus_v1_const,
+    .te_short_count = 120,
+    .te_delta_count = 120,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderSecPlus_v1, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_secplus_v1_decoder = {
     .alloc = subghz_protocol_decoder_secplus_v1_alloc,
     .free = subghz_protocol_decoder_secplus_v1_free,
@@ -70,6 +78,8 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v1_decoder = {
     .serialize = subghz_protocol_decoder_secplus_v1_serialize,
     .deserialize = subghz_protocol_decoder_secplus_v1_deserialize,
     .get_string = subghz_protocol_decoder_secplus_v1_get_string,
+
+    .trigger = &subghz_protocol_secplus_v1_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_secplus_v1_encoder = {
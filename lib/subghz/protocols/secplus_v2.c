@@ -51,6 +51,14 @@ typedef enum {
     SecPlus_v2DecoderStepDecoderData,
 } SecPlus_v2DecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_secplus_v2_trigger = {
+    .timing = &subghz_protocol_secplus_v2_const,
+    .te_long_count = 130,
+    .te_delta_count = 100,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderSecPlus_v2, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_secplus_v2_decoder = {
     .alloc = subghz_protocol_decoder_secplus_v2_alloc,
     .free = subghz_protocol_decoder_secplus_v2_free,
@@ -62,6 +70,8 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v2_decoder = {
     .serialize = subghz_protocol_decoder_secplus_v2_serialize,
     .deserialize = subghz_protocol_decoder_secplus_v2_deserialize,
     .get_string = subghz_protocol_decoder_secplus_v2_get_string,
+
+    .trigger = &subghz_protocol_secplus_v2_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_secplus_v2_encoder = {
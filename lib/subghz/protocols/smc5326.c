@@ -61,6 +61,14 @@ typedef enum {
     SMC5326DecoderStepCheckDuration,
 } SMC5326DecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_smc5326_trigger = {
+    .timing = &subghz_protocol_smc5326_const,
+    .te_short_count = 24,
+    .te_delta_count = 12,
+    .level = false,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderSMC5326, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder = {
     .alloc = subghz_protocol_decoder_smc5326_alloc,
     .free = subghz_protocol_decoder_smc5326_free,
@@ -72,6 +80,8 @@ const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder = {
     .serialize = subghz_protocol_decoder_smc5326_serialize,
     .deserialize = subghz_protocol_decoder_smc5326_deserialize,
     .get_string = subghz_protocol_decoder_smc5326_get_string,
+
+    .trigger = &subghz_protocol_smc5326_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_smc5326_encoder = {
@@ -42,6 +42,14 @@ typedef enum {
     SomfyKeytisDecoderStepDecoderData,
 } SomfyKeytisDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_somfy_keytis_trigger = {
+    .timing = &subghz_protocol_somfy_keytis_const,
+    .te_short_count = 4,
+    .te_delta_count = 4,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderSomfyKeytis, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_somfy_keytis_decoder = {
     .alloc = subghz_protocol_decoder_somfy_keytis_alloc,
     .free = subghz_protocol_decoder_somfy_keytis_free,
@@ -53,6 +61,8 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_keytis_decoder = {
     .serialize = subghz_protocol_decoder_somfy_keytis_serialize,
     .deserialize = subghz_protocol_decoder_somfy_keytis_deserialize,
     .get_string = subghz_protocol_decoder_somfy_keytis_get_string,
+
+    .trigger = &subghz_protocol_somfy_keytis_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_somfy_keytis_encoder = {
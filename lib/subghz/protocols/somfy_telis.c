@@ -41,6 +41,14 @@ typedef enum {
     SomfyTelisDecoderStepDecoderData,
 } SomfyTelisDecoderStep;
 
+static const SubGhzProtocolDecoderTrigger subghz_protocol_somfy_telis_trigger = {
+    .timing = &subghz_protocol_somfy_telis_const,
+    .te_short_count = 4,
+    .te_delta_count = 4,
+    .level = true,
+    .block_decoder_offset = offsetof(SubGhzProtocolDecoderSomfyTelis, decoder),
+};
+
 const SubGhzProtocolDecoder subghz_protocol_somfy_telis_decoder = {
     .alloc = subghz_protocol_decoder_somfy_telis_alloc,
     .free = subghz_protocol_decoder_somfy_telis_free,
@@ -52,6 +60,8 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_telis_decoder = {
     .serialize = subghz_protocol_decoder_somfy_telis_serialize,
     .deserialize = subghz_protocol_decoder_somfy_telis_deserialize,
     .get_string = subghz_protocol_decoder_somfy_telis_get_string,
+
+    .trigger = &subghz_protocol_somfy_telis_trigger,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_somfy_telis_encoder = {
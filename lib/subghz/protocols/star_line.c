@@ -1,8 +1,8 @@
 #include "star_line.h"
 #include "keeloq_common.h"
+#include "keeloq_search.h"
 
 #include "../subghz_keystore.h"
-#include <m-array.h>
 
 #include "../blocks/const.h"
 #include "../blocks/decoder.h"
@@ -27,6 +27,7 @@ struct SubGhzProtocolDecoderStarLine {
 
     uint16_t header_count;
     SubGhzKeystore* keystore;
+    SubGhzKeeloqSearchCache search_cache;
     const char* manufacture_name;
 };
 
@@ -201,12 +202,56 @@ static inline bool subghz_protocol_star_line_check_decrypt(
     return false;
 }
 
+typedef struct {
+    SubGhzBlockGeneric* instance;
+    uint8_t btn;
+    uint16_t end_serial;
+} SubGhzProtocolStarLineSearchContext;
+
+static bool subghz_protocol_star_line_search_check(
+    void* context,
+    const SubGhzKey* key,
+    uint8_t step,
+    uint32_t decrypt) {
+    UNUSED(key);
+    UNUSED(step);
+    SubGhzProtocolStarLineSearchContext* search_context = context;
+    return subghz_protocol_star_line_check_decrypt(
+        search_context->instance, decrypt, search_context->btn, search_context->end_serial);
+}
+
+// Unknown learning type: simple and normal learning, also with mirrored man
+// Normal Learning: https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+static const uint8_t subghz_protocol_star_line_steps_unknown[] = {
+    SubGhzKeeloqStepSimple,
+    SubGhzKeeloqStepSimple | SubGhzKeeloqStepMirror,
+    SubGhzKeeloqStepNormal,
+    SubGhzKeeloqStepNormal | SubGhzKeeloqStepMirror,
+};
+static const uint8_t subghz_protocol_star_line_steps_simple[] = {SubGhzKeeloqStepSimple};
+static const uint8_t subghz_protocol_star_line_steps_normal[] = {SubGhzKeeloqStepNormal};
+
+#define STAR_LINE_STEPS(array) {.steps = array, .count = COUNT_OF(array)}
+
+static const SubGhzKeeloqSearchSteps subghz_protocol_star_line_learning[] = {
+    [KEELOQ_LEARNING_UNKNOWN] = STAR_LINE_STEPS(subghz_protocol_star_line_steps_unknown),
+    [KEELOQ_LEARNING_SIMPLE] = STAR_LINE_STEPS(subghz_protocol_star_line_steps_simple),
+    [KEELOQ_LEARNING_NORMAL] = STAR_LINE_STEPS(subghz_protocol_star_line_steps_normal),
+};
+
+static const SubGhzKeeloqSearch subghz_protocol_star_line_search = {
+    .learning = subghz_protocol_star_line_learning,
+    .learning_count = COUNT_OF(subghz_protocol_star_line_learning),
+    .check = subghz_protocol_star_line_search_check,
+};
+
 /** 
  * Checking the accepted code against the database manafacture key
  * @param instance Pointer to a SubGhzBlockGeneric* instance
  * @param fix Fix part of the parcel
  * @param hop Hop encrypted part of the parcel
  * @param keystore Pointer to a SubGhzKeystore* instance
+ * @param search_cache Pointer to a SubGhzKeeloqSearchCache* instance
  * @param manufacture_name 
  * @return true on successful search
  */
@@ -215,72 +260,26 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
     uint32_t fix,
     uint32_t hop,
     SubGhzKeystore* keystore,
+    SubGhzKeeloqSearchCache* search_cache,
     const char** manufacture_name) {
-    uint16_t end_serial = (uint16_t)(fix & 0xFF);
-    uint8_t btn = (uint8_t)(fix >> 24);
-    uint32_t decrypt = 0;
-    uint64_t man_normal_learning;
-
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            switch(manufacture_code->type) {
-            case KEELOQ_LEARNING_SIMPLE:
-                //Simple Learning
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_NORMAL:
-                // Normal_Learning
-                // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                man_normal_learning =
-                    subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
-                if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_UNKNOWN:
-                // Simple Learning
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                // Check for mirrored man
-                uint64_t man_rev = 0;
-                uint64_t man_rev_byte = 0;
-                for(uint8_t i = 0; i < 64; i += 8) {
-                    man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                    man_rev = man_rev | man_rev_byte << (56 - i);
-                }
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                //###########################
-                // Normal_Learning
-                // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                man_normal_learning =
-                    subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
-                if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                man_normal_learning = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
-                if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            }
-        }
+    SubGhzProtocolStarLineSearchContext search_context = {
+        .instance = instance,
+        .btn = (uint8_t)(fix >> 24),
+        .end_serial = (uint16_t)(fix & 0xFF),
+    };
+
+    const SubGhzKey* manufacture_code = subghz_keeloq_search(
+        &subghz_protocol_star_line_search,
+        keystore,
+        search_cache,
+        fix,
+        hop,
+        fix & 0x00FFFFFF,
+        &search_context);
+    if(manufacture_code) {
+        *manufacture_name = manufacture_code->name;
+        return 1;
+    }
 
     *manufacture_name = "Unknown";
     instance->cnt = 0;
@@ -292,18 +291,20 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
  * @param keystore Pointer to a SubGhzKeystore* instance
+ * @param search_cache Pointer to a SubGhzKeeloqSearchCache* instance
  * @param manufacture_name
  */
 static void subghz_protocol_star_line_check_remote_controller(
     SubGhzBlockGeneric* instance,
     SubGhzKeystore* keystore,
+    SubGhzKeeloqSearchCache* search_cache,
     const char** manufacture_name) {
     uint64_t key = subghz_protocol_blocks_reverse_key(instance->data, instance->data_count_bit);
     uint32_t key_fix = key >> 32;
     uint32_t key_hop = key & 0x00000000ffffffff;
 
     subghz_protocol_star_line_check_remote_controller_selector(
-        instance, key_fix, key_hop, keystore, manufacture_name);
+        instance, key_fix, key_hop, keystore, search_cache, manufacture_name);
 
     instance->serial = key_fix & 0x00FFFFFF;
     instance->btn = key_fix >> 24;
@@ -323,7 +324,10 @@ SubGhzProtocolStatus subghz_protocol_decoder_star_line_serialize(
     furi_assert(context);
     SubGhzProtocolDecoderStarLine* instance = context;
     subghz_protocol_star_line_check_remote_controller(
-        &instance->generic, instance->keystore, &instance->manufacture_name);
+        &instance->generic,
+        instance->keystore,
+        &instance->search_cache,
+        &instance->manufacture_name);
     SubGhzProtocolStatus ret =
         subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
 
@@ -354,7 +358,10 @@ void subghz_protocol_decoder_star_line_get_string(void* context, FuriString* out
     SubGhzProtocolDecoderStarLine* instance = context;
 
     subghz_protocol_star_line_check_remote_controller(
-        &instance->generic, instance->keystore, &instance->manufacture_name);
+        &instance->generic,
+        instance->keystore,
+        &instance->search_cache,
+        &instance->manufacture_name);
 
     uint32_t code_found_hi = instance->generic.data >> 32;
     uint32_t code_found_lo = instance->generic.data & 0x00000000ffffffff;
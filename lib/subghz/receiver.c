@@ -2,27 +2,68 @@
 
 #include "registry.h"
 #include "protocols/protocol_items.h"
+#include "blocks/decoder.h"
 
 #include <m-array.h>
 
+#define SUBGHZ_RECEIVER_INDEX_SLOTS_MAX (64U)
+#define SUBGHZ_RECEIVER_INDEX_BUCKET_SHIFT (9U)
+#define SUBGHZ_RECEIVER_INDEX_BUCKET_COUNT (128U)
+
 typedef struct {
     SubGhzProtocolEncoderBase* base;
+    const uint32_t* parser_step; // NULL for decoders fed with every pulse
 } SubGhzReceiverSlot;
 
 ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
 #define M_OPL_SubGhzReceiverSlotArray_t() ARRAY_OPLIST(SubGhzReceiverSlotArray, M_POD_OPLIST)
 
+// Per level and duration bucket: slots whose decoder can leave reset step
+typedef uint64_t SubGhzReceiverIndex[2][SUBGHZ_RECEIVER_INDEX_BUCKET_COUNT];
+
 struct SubGhzReceiver {
     SubGhzReceiverSlotArray_t slots;
     SubGhzProtocolFlag filter;
 
+    SubGhzReceiverIndex* index;
+    uint64_t unindexed; // Slots without trigger, fed with every pulse
+    uint64_t active; // Indexed slots in the middle of a frame
+
     SubGhzReceiverCallback callback;
     void* context;
 };
 
+static inline size_t subghz_receiver_index_bucket(uint32_t duration) {
+    size_t bucket = duration >> SUBGHZ_RECEIVER_INDEX_BUCKET_SHIFT;
+    return MIN(bucket, SUBGHZ_RECEIVER_INDEX_BUCKET_COUNT - 1);
+}
+
+static void subghz_receiver_index_add(
+    SubGhzReceiver* instance,
+    size_t slot_index,
+    const SubGhzProtocolDecoderTrigger* trigger) {
+    const SubGhzBlockConst* timing = trigger->timing;
+    uint32_t center = timing->te_short * trigger->te_short_count +
+                      timing->te_long * trigger->te_long_count;
+    uint32_t delta = timing->te_delta * trigger->te_delta_count;
+    uint32_t min = (center > delta) ? (center - delta) : 0;
+    uint32_t max = center + delta;
+
+    uint64_t* buckets = (*instance->index)[trigger->level ? 1 : 0];
+    for(size_t i = subghz_receiver_index_bucket(min); i <= subghz_receiver_index_bucket(max);
+        i++) {
+        buckets[i] |= 1ULL << slot_index;
+    }
+}
+
 SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
     SubGhzReceiver* instance = malloc(sizeof(SubGhzReceiver));
     SubGhzReceiverSlotArray_init(instance->slots);
+    instance->index = malloc(sizeof(SubGhzReceiverIndex));
+    memset(instance->index, 0, sizeof(SubGhzReceiverIndex));
+    instance->unindexed = 0;
+    instance->active = 0;
+
     const SubGhzProtocolRegistry* protocol_registry_items =
         subghz_environment_get_protocol_registry(environment);
 
@@ -31,8 +72,23 @@ SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
             subghz_protocol_registry_get_by_index(protocol_registry_items, i);
 
         if(protocol->decoder && protocol->decoder->alloc) {
+            size_t slot_index = SubGhzReceiverSlotArray_size(instance->slots);
             SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_push_new(instance->slots);
             slot->base = protocol->decoder->alloc(environment);
+            slot->parser_step = NULL;
+
+            if(slot_index >= SUBGHZ_RECEIVER_INDEX_SLOTS_MAX) {
+                // Out of index space, fed with every pulse
+            } else if(protocol->decoder->trigger) {
+                const SubGhzProtocolDecoderTrigger* trigger = protocol->decoder->trigger;
+                const SubGhzBlockDecoder* block_decoder =
+                    (const SubGhzBlockDecoder*)((uint8_t*)slot->base +
+                                                trigger->block_decoder_offset);
+                slot->parser_step = &block_decoder->parser_step;
+                subghz_receiver_index_add(instance, slot_index, trigger);
+            } else {
+                instance->unindexed |= 1ULL << slot_index;
+            }
         }
     }
 
@@ -55,6 +111,7 @@ void subghz_receiver_free(SubGhzReceiver* instance) {
         }
     SubGhzReceiverSlotArray_clear(instance->slots);
 
+    free(instance->index);
     free(instance);
 }
 
@@ -62,12 +119,35 @@ void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t durat
     furi_check(instance);
     furi_check(instance->slots);
 
-    for
-        M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
-            if((slot->base->protocol->flag & instance->filter) != 0) {
-                slot->base->protocol->decoder->feed(slot->base, level, duration);
+    // Idle decoders only get pulses that can take them out of reset step
+    uint64_t mask = (*instance->index)[level ? 1 : 0][subghz_receiver_index_bucket(duration)] |
+                    instance->active | instance->unindexed;
+
+    while(mask) {
+        size_t slot_index = __builtin_ctzll(mask);
+        mask &= mask - 1;
+
+        SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, slot_index);
+        if((slot->base->protocol->flag & instance->filter) != 0) {
+            slot->base->protocol->decoder->feed(slot->base, level, duration);
+        }
+        if(slot->parser_step) {
+            if(*slot->parser_step) {
+                instance->active |= 1ULL << slot_index;
+            } else {
+                instance->active &= ~(1ULL << slot_index);
             }
         }
+    }
+
+    // Slots that didn't fit into the index
+    size_t slots_count = SubGhzReceiverSlotArray_size(instance->slots);
+    for(size_t i = SUBGHZ_RECEIVER_INDEX_SLOTS_MAX; i < slots_count; i++) {
+        SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, i);
+        if((slot->base->protocol->flag & instance->filter) != 0) {
+            slot->base->protocol->decoder->feed(slot->base, level, duration);
+        }
+    }
 }
 
 void subghz_receiver_reset(SubGhzReceiver* instance) {
@@ -78,6 +158,7 @@ void subghz_receiver_reset(SubGhzReceiver* instance) {
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
             slot->base->protocol->decoder->reset(slot->base);
         }
+    instance->active = 0;
 }
 
 static void subghz_receiver_rx_callback(SubGhzProtocolDecoderBase* decoder_base, void* context) {
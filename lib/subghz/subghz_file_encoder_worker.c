@@ -1,4 +1,5 @@
 #include "subghz_file_encoder_worker.h"
+#include "subghz_raw_file.h"
 
 #include <toolbox/stream/stream.h>
 #include <flipper_format/flipper_format.h>
@@ -8,6 +9,14 @@
 #define TAG "SubGhzFileEncoderWorker"
 
 #define SUBGHZ_FILE_ENCODER_LOAD 512
+#define SUBGHZ_FILE_ENCODER_SEND_TIMEOUT 100
+#define SUBGHZ_FILE_ENCODER_RAW_DATA_KEY "RAW_Data:"
+#define SUBGHZ_FILE_ENCODER_DURATION_DIGITS_MAX 9
+#define SUBGHZ_FILE_ENCODER_TEXT_CHUNK 512
+
+_Static_assert(
+    SUBGHZ_FILE_ENCODER_LOAD >= SUBGHZ_RAW_FILE_BLOCK_DURATIONS_MAX,
+    "Varint block doesn't fit into the load");
 
 struct SubGhzFileEncoderWorker {
     FuriThread* thread;
@@ -18,7 +27,12 @@ struct SubGhzFileEncoderWorker {
 
     volatile bool worker_running;
     volatile bool worker_stoping;
-    bool is_storage_slow;
+    SubGhzFileEncoderWorkerStats stats;
+    SubGhzFileEncoderWorkerParser parser;
+    int32_t* durations;
+    char* text_buffer;
+    uint8_t* block_buffer;
+    bool is_varint;
     FuriString* str_data;
     FuriString* file_path;
     const SubGhzDevice* device;
@@ -37,36 +51,201 @@ void subghz_file_encoder_worker_callback_end(
     instance->context_end = context_end;
 }
 
-void subghz_file_encoder_worker_add_level_duration(
+static bool subghz_file_encoder_worker_add_level_durations(
     SubGhzFileEncoderWorker* instance,
-    int32_t duration) {
-    size_t ret = furi_stream_buffer_send(instance->stream, &duration, sizeof(int32_t), 100);
-    if(sizeof(int32_t) != ret) FURI_LOG_E(TAG, "Invalid add duration in the stream");
+    const int32_t* durations,
+    size_t count) {
+    const uint8_t* data = (const uint8_t*)durations;
+    size_t size = count * sizeof(int32_t);
+
+    // Whole batch at once, wait for space only if the line is longer than the free space
+    while(size && instance->worker_running) {
+        size_t ret = furi_stream_buffer_send(
+            instance->stream, data, size, SUBGHZ_FILE_ENCODER_SEND_TIMEOUT);
+        data += ret;
+        size -= ret;
+    }
+
+    if(size) FURI_LOG_E(TAG, "Invalid add duration in the stream");
+    return size == 0;
 }
 
-bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, const char* strStart) {
-    char* str1;
-    bool res = false;
-    // Line sample: "RAW_Data: -1, 2, -2..."
+static inline bool subghz_file_encoder_worker_is_separator(char c) {
+    return (c == ' ') || (c == ',') || (c == '\t') || (c == '\r');
+}
+
+typedef enum {
+    SubGhzFileEncoderWorkerParserStateLine,
+    SubGhzFileEncoderWorkerParserStateKey,
+    SubGhzFileEncoderWorkerParserStateValues,
+} SubGhzFileEncoderWorkerParserState;
 
-    // Look for a key in the line
-    str1 = strstr(strStart, "RAW_Data: ");
+void subghz_file_encoder_worker_parser_reset(SubGhzFileEncoderWorkerParser* parser) {
+    furi_check(parser);
+    memset(parser, 0, sizeof(SubGhzFileEncoderWorkerParser));
+}
 
-    if(str1 != NULL) {
-        // Skip key
-        str1 = strchr(str1, ' ');
+bool subghz_file_encoder_worker_parse_raw_data(
+    SubGhzFileEncoderWorkerParser* parser,
+    const char* data,
+    size_t data_size,
+    size_t* position,
+    int32_t* durations,
+    size_t durations_max,
+    size_t* durations_count) {
+    furi_check(parser);
+    furi_check(data || !data_size);
+    furi_check(position);
+    furi_check(durations);
+    furi_check(durations_count);
+
+    const char* key = SUBGHZ_FILE_ENCODER_RAW_DATA_KEY;
+    const size_t key_size = strlen(key);
+    size_t pos = *position;
+    size_t count = 0;
+    bool result = true;
+
+    // Line sample: "RAW_Data: -1 2 -2..."
+    while(result && (pos < data_size) && (count < durations_max)) {
+        const char c = data[pos++];
+
+        if(parser->state == SubGhzFileEncoderWorkerParserStateLine) {
+            if((c == '\n') || subghz_file_encoder_worker_is_separator(c)) continue;
+            parser->state = SubGhzFileEncoderWorkerParserStateKey;
+            parser->key_position = 0;
+        }
 
-        // Check that there is still an element in the line
-        while(strchr(str1, ' ') != NULL) {
-            str1 = strchr(str1, ' ');
+        if(parser->state == SubGhzFileEncoderWorkerParserStateKey) {
+            if(c != key[parser->key_position++]) {
+                result = false;
+            } else if(parser->key_position == key_size) {
+                parser->state = SubGhzFileEncoderWorkerParserStateValues;
+            }
+        } else if((c >= '0') && (c <= '9')) {
+            // Every value is a plain decimal
+            if(parser->digits == SUBGHZ_FILE_ENCODER_DURATION_DIGITS_MAX) {
+                result = false;
+            } else {
+                parser->value = parser->value * 10 + (c - '0');
+                parser->digits++;
+            }
+        } else if((c == '-') && !parser->negative && !parser->digits) {
+            parser->negative = true;
+        } else if((c == '\n') || subghz_file_encoder_worker_is_separator(c)) {
+            if(parser->digits) {
+                durations[count++] = parser->negative ? -parser->value : parser->value;
+            } else if(parser->negative) {
+                result = false;
+            }
+            parser->value = 0;
+            parser->digits = 0;
+            parser->negative = false;
 
-            // Skip space
-            str1 += 1;
-            subghz_file_encoder_worker_add_level_duration(instance, atoi(str1));
+            if(c == '\n') {
+                parser->state = SubGhzFileEncoderWorkerParserStateLine;
+                parser->lines++;
+            }
+        } else {
+            result = false;
         }
-        res = true;
     }
-    return res;
+
+    *position = pos;
+    *durations_count = count;
+    return result;
+}
+
+static bool subghz_file_encoder_worker_data_parse(
+    SubGhzFileEncoderWorker* instance,
+    const char* data,
+    size_t data_size) {
+    size_t position = 0;
+    uint32_t lines = instance->parser.lines;
+
+    // A chunk can't have more values than the durations array holds, loop just in case
+    do {
+        size_t count = 0;
+        if(!subghz_file_encoder_worker_parse_raw_data(
+               &instance->parser,
+               data,
+               data_size,
+               &position,
+               instance->durations,
+               SUBGHZ_FILE_ENCODER_LOAD,
+               &count)) {
+            FURI_LOG_E(TAG, "Malformed RAW_Data at line %lu", instance->parser.lines + 1);
+            return false;
+        }
+        if(!subghz_file_encoder_worker_add_level_durations(instance, instance->durations, count))
+            return false;
+        instance->stats.durations += count;
+    } while(position < data_size);
+
+    instance->stats.blocks += instance->parser.lines - lines;
+    return true;
+}
+
+static bool
+    subghz_file_encoder_worker_load_text(SubGhzFileEncoderWorker* instance, Stream* stream) {
+    // Lines are longer than the stream cache, so the file is parsed in chunks instead
+    size_t size =
+        stream_read(stream, (uint8_t*)instance->text_buffer, SUBGHZ_FILE_ENCODER_TEXT_CHUNK);
+
+    if(size == 0) {
+        // End of file, flush the last value if the file doesn't end with a new line
+        subghz_file_encoder_worker_data_parse(instance, "\n", 1);
+        return false;
+    }
+
+    return subghz_file_encoder_worker_data_parse(instance, instance->text_buffer, size);
+}
+
+static bool
+    subghz_file_encoder_worker_load_block(SubGhzFileEncoderWorker* instance, Stream* stream) {
+    size_t count = 0;
+
+    if(!subghz_raw_file_read_block(stream, instance->block_buffer, instance->durations, &count))
+        return false;
+    if(!subghz_file_encoder_worker_add_level_durations(instance, instance->durations, count))
+        return false;
+
+    instance->stats.durations += count;
+    instance->stats.blocks++;
+    return true;
+}
+
+static bool
+    subghz_file_encoder_worker_load_encoding(SubGhzFileEncoderWorker* instance, Stream* stream) {
+    // Varint files have the encoding line right after the header
+    size_t data_start = stream_tell(stream);
+    const char* line = NULL;
+    size_t line_size = 0;
+    const char* encoding_key = SUBGHZ_RAW_FILE_ENCODING_KEY ":";
+    const char* encoding_varint =
+        SUBGHZ_RAW_FILE_ENCODING_KEY ": " SUBGHZ_RAW_FILE_ENCODING_VARINT;
+
+    instance->is_varint = false;
+    if(stream_read_line_view(stream, &line, &line_size) &&
+       (line_size >= strlen(encoding_key)) &&
+       (memcmp(line, encoding_key, strlen(encoding_key)) == 0)) {
+        if((line_size != strlen(encoding_varint)) ||
+           (memcmp(line, encoding_varint, line_size) != 0)) {
+            FURI_LOG_E(TAG, "Unsupported %.*s", (int)line_size, line);
+            return false;
+        }
+        if(!instance->block_buffer) {
+            instance->block_buffer = malloc(SUBGHZ_RAW_FILE_BLOCK_SIZE_MAX);
+        }
+        instance->is_varint = true;
+        return true;
+    }
+
+    return stream_seek(stream, data_start, StreamOffsetFromStart);
+}
+
+static void subghz_file_encoder_worker_add_reset(SubGhzFileEncoderWorker* instance) {
+    int32_t duration = LEVEL_DURATION_RESET;
+    subghz_file_encoder_worker_add_level_durations(instance, &duration, 1);
 }
 
 LevelDuration subghz_file_encoder_worker_get_level_duration(void* context) {
@@ -87,7 +266,7 @@ LevelDuration subghz_file_encoder_worker_get_level_duration(void* context) {
         }
         return level_duration;
     } else {
-        instance->is_storage_slow = true;
+        instance->stats.underruns++;
         return level_duration_wait();
     }
 }
@@ -101,10 +280,11 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
     SubGhzFileEncoderWorker* instance = context;
     FURI_LOG_I(TAG, "Worker start");
     bool res = false;
-    instance->is_storage_slow = false;
+    memset(&instance->stats, 0, sizeof(SubGhzFileEncoderWorkerStats));
+    subghz_file_encoder_worker_parser_reset(&instance->parser);
     Stream* stream = flipper_format_get_raw_stream(instance->flipper_format);
     do {
-        if(!flipper_format_file_open_existing(
+        if(!flipper_format_buffered_file_open_existing(
                instance->flipper_format, furi_string_get_cstr(instance->file_path))) {
             FURI_LOG_E(
                 TAG,
@@ -119,6 +299,7 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
 
         //skip the end of the previous line "\n"
         stream_seek(stream, 1, StreamOffsetFromCurrent);
+        if(!subghz_file_encoder_worker_load_encoding(instance, stream)) break;
         res = true;
         instance->worker_stoping = false;
         FURI_LOG_I(TAG, "Start transmission");
@@ -127,15 +308,11 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
     while(res && instance->worker_running) {
         size_t stream_free_byte = furi_stream_buffer_spaces_available(instance->stream);
         if((stream_free_byte / sizeof(int32_t)) >= SUBGHZ_FILE_ENCODER_LOAD) {
-            if(stream_read_line(stream, instance->str_data)) {
-                furi_string_trim(instance->str_data);
-                if(!subghz_file_encoder_worker_data_parse(
-                       instance, furi_string_get_cstr(instance->str_data))) {
-                    subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
-                    break;
-                }
-            } else {
-                subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
+            bool loaded = instance->is_varint ?
+                              subghz_file_encoder_worker_load_block(instance, stream) :
+                              subghz_file_encoder_worker_load_text(instance, stream);
+            if(!loaded) {
+                subghz_file_encoder_worker_add_reset(instance);
                 break;
             }
         } else {
@@ -143,11 +320,15 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
         }
     }
     //waiting for the end of the transfer
-    if(instance->is_storage_slow) {
-        FURI_LOG_E(TAG, "Storage is slow");
+    if(instance->stats.underruns) {
+        FURI_LOG_E(TAG, "Storage is slow, %lu underruns", instance->stats.underruns);
     }
 
-    FURI_LOG_I(TAG, "End read file");
+    FURI_LOG_I(
+        TAG,
+        "End read file, %lu blocks, %lu durations",
+        instance->stats.blocks,
+        instance->stats.durations);
     while(instance->device && !subghz_devices_is_async_complete_tx(instance->device) &&
           instance->worker_running) {
         furi_delay_ms(5);
@@ -160,7 +341,7 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
         }
         furi_delay_ms(50);
     }
-    flipper_format_file_close(instance->flipper_format);
+    flipper_format_buffered_file_close(instance->flipper_format);
 
     FURI_LOG_I(TAG, "Worker stop");
     return 0;
@@ -174,7 +355,10 @@ SubGhzFileEncoderWorker* subghz_file_encoder_worker_alloc(void) {
     instance->stream = furi_stream_buffer_alloc(sizeof(int32_t) * 2048, sizeof(int32_t));
 
     instance->storage = furi_record_open(RECORD_STORAGE);
-    instance->flipper_format = flipper_format_file_alloc(instance->storage);
+    instance->flipper_format = flipper_format_buffered_file_alloc(instance->storage);
+    instance->durations = malloc(sizeof(int32_t) * SUBGHZ_FILE_ENCODER_LOAD);
+    instance->text_buffer = malloc(SUBGHZ_FILE_ENCODER_TEXT_CHUNK);
+    instance->block_buffer = NULL;
 
     instance->str_data = furi_string_alloc();
     instance->file_path = furi_string_alloc();
@@ -191,6 +375,9 @@ void subghz_file_encoder_worker_free(SubGhzFileEncoderWorker* instance) {
 
     furi_string_free(instance->str_data);
     furi_string_free(instance->file_path);
+    free(instance->durations);
+    free(instance->text_buffer);
+    free(instance->block_buffer);
 
     flipper_format_free(instance->flipper_format);
     furi_record_close(RECORD_STORAGE);
@@ -228,3 +415,11 @@ bool subghz_file_encoder_worker_is_running(SubGhzFileEncoderWorker* instance) {
     furi_assert(instance);
     return instance->worker_running;
 }
+
+void subghz_file_encoder_worker_get_stats(
+    SubGhzFileEncoderWorker* instance,
+    SubGhzFileEncoderWorkerStats* stats) {
+    furi_assert(instance);
+    furi_assert(stats);
+    *stats = instance->stats;
+}
@@ -6,6 +6,22 @@ typedef void (*SubGhzFileEncoderWorkerCallbackEnd)(void* context);
 
 typedef struct SubGhzFileEncoderWorker SubGhzFileEncoderWorker;
 
+typedef struct {
+    uint32_t blocks; /**< RAW_Data lines or varint blocks loaded */
+    uint32_t durations; /**< Durations loaded for transmission */
+    uint32_t underruns; /**< Durations requested while none were loaded */
+} SubGhzFileEncoderWorkerStats;
+
+/** RAW_Data parser state, carried over between chunks of a file */
+typedef struct {
+    uint8_t state;
+    uint8_t key_position;
+    uint8_t digits;
+    bool negative;
+    int32_t value;
+    uint32_t lines; /**< Complete RAW_Data lines */
+} SubGhzFileEncoderWorkerParser;
+
 /** 
  * End callback SubGhzWorker.
  * @param instance SubGhzFileEncoderWorker instance
@@ -59,3 +75,43 @@ void subghz_file_encoder_worker_stop(SubGhzFileEncoderWorker* instance);
  * @return bool - true if running
  */
 bool subghz_file_encoder_worker_is_running(SubGhzFileEncoderWorker* instance);
+
+/** 
+ * Get statistics of the last or current run
+ * @param instance Pointer to a SubGhzFileEncoderWorker instance
+ * @param stats Pointer to a SubGhzFileEncoderWorkerStats to fill
+ */
+void subghz_file_encoder_worker_get_stats(
+    SubGhzFileEncoderWorker* instance,
+    SubGhzFileEncoderWorkerStats* stats);
+
+/**
+ * Reset RAW_Data parser to the start of a line
+ * @param parser Pointer to a SubGhzFileEncoderWorkerParser instance
+ */
+void subghz_file_encoder_worker_parser_reset(SubGhzFileEncoderWorkerParser* parser);
+
+/** 
+ * Parse durations of RAW_Data lines.
+ * Data may be split at any byte, a value cut at the end of data is carried
+ * over to the next call in the parser state. Parsing stops at the end of data
+ * or when the durations array is full, call again with the same position to
+ * get the rest. Feed a "\n" at the end of file to get the last value of a line
+ * without the line ending. Empty lines are skipped.
+ * @param parser Pointer to a SubGhzFileEncoderWorkerParser instance
+ * @param data Data chunk, doesn't need to be null-terminated
+ * @param data_size Data chunk size
+ * @param position Parse position in the chunk
+ * @param durations Array to store durations
+ * @param durations_max Size of the durations array
+ * @param durations_count Number of stored durations
+ * @return bool - false if a line is not a RAW_Data line or has a malformed value
+ */
+bool subghz_file_encoder_worker_parse_raw_data(
+    SubGhzFileEncoderWorkerParser* parser,
+    const char* data,
+    size_t data_size,
+    size_t* position,
+    int32_t* durations,
+    size_t durations_max,
+    size_t* durations_count);
@@ -5,6 +5,7 @@
 
 #include <storage/storage.h>
 #include <toolbox/hex.h>
+#include <toolbox/crc32_calc.h>
 #include <toolbox/stream/stream.h>
 #include <flipper_format/flipper_format.h>
 #include <flipper_format/flipper_format_i.h>
@@ -21,19 +22,94 @@
 #define SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE 512
 #define SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE (SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE * 2)
 
+#define SUBGHZ_KEYSTORE_CACHE_MAGIC (0x434B4753UL) // "SGKC"
+#define SUBGHZ_KEYSTORE_CACHE_VERSION 1
+#define SUBGHZ_KEYSTORE_CACHE_ALIGN 16
+#define SUBGHZ_KEYSTORE_CACHE_CHUNK_KEYS 32
+#define SUBGHZ_KEYSTORE_CACHE_CHUNK_SIZE \
+    (SUBGHZ_KEYSTORE_CACHE_CHUNK_KEYS * sizeof(SubGhzKeystoreCacheKey))
+#define SUBGHZ_KEYSTORE_CACHE_NAMES_SIZE_MAX (64 * 1024)
+#define SUBGHZ_KEYSTORE_CACHE_HEAP_RESERVE (4 * 1024)
+
+/*
+ * Binary cache of a keystore file: header, then names and keys encrypted
+ * with the same key as the keystore file, so they don't leak either.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t source_crc; /**< CRC32 of the keystore file the cache is made from */
+    uint32_t source_size;
+    uint32_t keys_count;
+    uint32_t names_size; /**< Zero terminated names, padded to the AES block */
+    uint32_t crc; /**< CRC32 of decrypted names and keys */
+    uint8_t iv[16];
+} SubGhzKeystoreCacheHeader;
+
+typedef struct {
+    uint64_t key;
+    uint32_t name; /**< Name offset in the names */
+    uint16_t type;
+    uint16_t reserved;
+} SubGhzKeystoreCacheKey;
+
+_Static_assert(
+    sizeof(SubGhzKeystoreCacheKey) % SUBGHZ_KEYSTORE_CACHE_ALIGN == 0,
+    "Cache key must be a whole number of AES blocks");
+
+#define SUBGHZ_KEYSTORE_NAMES_BLOCK_SIZE 1024
+#define SUBGHZ_KEYSTORE_NAMES_TABLE_SIZE_MIN 64
+#define SUBGHZ_KEYSTORE_KEYS_CAPACITY_MIN 64
+
 typedef enum {
     SubGhzKeystoreEncryptionNone,
     SubGhzKeystoreEncryptionAES256,
 } SubGhzKeystoreEncryption;
 
+// Names are stored in blocks that never move, so SubGhzKey keeps plain pointers
+typedef struct SubGhzKeystoreNamesBlock {
+    struct SubGhzKeystoreNamesBlock* next;
+    size_t size;
+    size_t used;
+    char data[];
+} SubGhzKeystoreNamesBlock;
+
+typedef struct {
+    const char* name;
+    uint16_t index;
+} SubGhzKeystoreNameIndex;
+
 struct SubGhzKeystore {
-    SubGhzKeyArray_t data;
+    SubGhzKey* keys;
+    size_t keys_count;
+    size_t keys_capacity;
+
+    // Name interning, open addressing hash table over the names blocks
+    SubGhzKeystoreNamesBlock* names_blocks;
+    const char** names_table;
+    size_t names_table_size;
+    size_t names_count;
+
+    // Built on demand after keys are added
+    bool index_valid;
+    uint16_t* type_index;
+    uint16_t type_index_offset[SUBGHZ_KEYSTORE_TYPE_INDEX_COUNT + 1];
+    SubGhzKeystoreNameIndex* name_index;
 };
 
 SubGhzKeystore* subghz_keystore_alloc(void) {
     SubGhzKeystore* instance = malloc(sizeof(SubGhzKeystore));
 
-    SubGhzKeyArray_init(instance->data);
+    instance->keys = NULL;
+    instance->keys_count = 0;
+    instance->keys_capacity = 0;
+    instance->names_blocks = NULL;
+    instance->names_table = NULL;
+    instance->names_table_size = 0;
+    instance->names_count = 0;
+    instance->index_valid = false;
+    instance->type_index = NULL;
+    instance->name_index = NULL;
 
     return instance;
 }
@@ -41,38 +117,263 @@ SubGhzKeystore* subghz_keystore_alloc(void) {
 void subghz_keystore_free(SubGhzKeystore* instance) {
     furi_assert(instance);
 
-    for
-        M_EACH(manufacture_code, instance->data, SubGhzKeyArray_t) {
-            furi_string_free(manufacture_code->name);
-            manufacture_code->key = 0;
-        }
-    SubGhzKeyArray_clear(instance->data);
+    // Wipe keys before freeing
+    if(instance->keys) {
+        memset(instance->keys, 0, sizeof(SubGhzKey) * instance->keys_capacity);
+        free(instance->keys);
+    }
+
+    while(instance->names_blocks) {
+        SubGhzKeystoreNamesBlock* block = instance->names_blocks;
+        instance->names_blocks = block->next;
+        free(block);
+    }
+    free(instance->names_table);
+    free(instance->type_index);
+    free(instance->name_index);
 
     free(instance);
 }
 
-static void subghz_keystore_add_key(
+/** Allocate a names block
+ * @param keep_top block is taken at once, keep the partly used block on top
+ */
+static SubGhzKeystoreNamesBlock* subghz_keystore_names_block_alloc(
+    SubGhzKeystore* instance,
+    size_t block_size,
+    bool keep_top) {
+    SubGhzKeystoreNamesBlock* block = malloc(sizeof(SubGhzKeystoreNamesBlock) + block_size);
+    block->size = block_size;
+    block->used = 0;
+    if(instance->names_blocks && keep_top) {
+        block->next = instance->names_blocks->next;
+        instance->names_blocks->next = block;
+    } else {
+        block->next = instance->names_blocks;
+        instance->names_blocks = block;
+    }
+    return block;
+}
+
+static char* subghz_keystore_names_alloc(SubGhzKeystore* instance, size_t size) {
+    // Word aligned, cache names are decrypted in place
+    size = (size + 3) & ~3U;
+    SubGhzKeystoreNamesBlock* block = instance->names_blocks;
+    if(!block || (block->size - block->used < size)) {
+        size_t block_size = MAX(size, (size_t)SUBGHZ_KEYSTORE_NAMES_BLOCK_SIZE);
+        block = subghz_keystore_names_block_alloc(
+            instance, block_size, block_size > SUBGHZ_KEYSTORE_NAMES_BLOCK_SIZE);
+    }
+
+    char* data = &block->data[block->used];
+    block->used += size;
+    return data;
+}
+
+static uint32_t subghz_keystore_name_hash(const char* name) {
+    // FNV-1a
+    uint32_t hash = 2166136261UL;
+    while(*name) {
+        hash = (hash ^ (uint8_t)*name++) * 16777619UL;
+    }
+    return hash;
+}
+
+static const char** subghz_keystore_names_find(SubGhzKeystore* instance, const char* name) {
+    size_t mask = instance->names_table_size - 1;
+    size_t i = subghz_keystore_name_hash(name) & mask;
+    while(instance->names_table[i] && (strcmp(instance->names_table[i], name) != 0)) {
+        i = (i + 1) & mask;
+    }
+    return &instance->names_table[i];
+}
+
+static void subghz_keystore_names_grow(SubGhzKeystore* instance) {
+    const char** table = instance->names_table;
+    size_t table_size = instance->names_table_size;
+
+    instance->names_table_size =
+        table_size ? table_size * 2 : SUBGHZ_KEYSTORE_NAMES_TABLE_SIZE_MIN;
+    instance->names_table = malloc(sizeof(const char*) * instance->names_table_size);
+    memset(instance->names_table, 0, sizeof(const char*) * instance->names_table_size);
+
+    for(size_t i = 0; i < table_size; i++) {
+        if(table[i]) *subghz_keystore_names_find(instance, table[i]) = table[i];
+    }
+    free(table);
+}
+
+/** Free the names block, names interned from it are dropped from the table */
+static void
+    subghz_keystore_names_block_free(SubGhzKeystore* instance, SubGhzKeystoreNamesBlock* block) {
+    const char** table = instance->names_table;
+    if(table) {
+        instance->names_table = malloc(sizeof(const char*) * instance->names_table_size);
+        memset(instance->names_table, 0, sizeof(const char*) * instance->names_table_size);
+        instance->names_count = 0;
+        for(size_t i = 0; i < instance->names_table_size; i++) {
+            if(!table[i] || ((table[i] >= block->data) && (table[i] < &block->data[block->size])))
+                continue;
+            *subghz_keystore_names_find(instance, table[i]) = table[i];
+            instance->names_count++;
+        }
+        free(table);
+    }
+
+    SubGhzKeystoreNamesBlock** link = &instance->names_blocks;
+    while(*link != block) {
+        link = &(*link)->next;
+    }
+    *link = block->next;
+    free(block);
+}
+
+/** Get the interned copy of the name
+ * @param stored name is already in a names block and can be interned as is
+ */
+static const char* subghz_keystore_names_intern(
+    SubGhzKeystore* instance,
+    const char* name,
+    bool stored) {
+    // Keep the table at most half full
+    if((instance->names_count + 1) * 2 > instance->names_table_size) {
+        subghz_keystore_names_grow(instance);
+    }
+
+    const char** slot = subghz_keystore_names_find(instance, name);
+    if(!*slot) {
+        if(!stored) {
+            size_t size = strlen(name) + 1;
+            char* copy = subghz_keystore_names_alloc(instance, size);
+            memcpy(copy, name, size);
+            name = copy;
+        }
+        *slot = name;
+        instance->names_count++;
+    }
+    return *slot;
+}
+
+static bool subghz_keystore_add_interned_key(
     SubGhzKeystore* instance,
     const char* name,
     uint64_t key,
     uint16_t type) {
-    SubGhzKey* manufacture_code = SubGhzKeyArray_push_raw(instance->data);
-    manufacture_code->name = furi_string_alloc_set(name);
+    if(instance->keys_count >= SUBGHZ_KEYSTORE_KEYS_MAX) {
+        FURI_LOG_E(TAG, "Keystore is full");
+        return false;
+    }
+
+    if(instance->keys_count == instance->keys_capacity) {
+        instance->keys_capacity =
+            MAX(instance->keys_capacity * 2, (size_t)SUBGHZ_KEYSTORE_KEYS_CAPACITY_MIN);
+        instance->keys_capacity = MIN(instance->keys_capacity, (size_t)SUBGHZ_KEYSTORE_KEYS_MAX);
+        instance->keys = realloc(instance->keys, sizeof(SubGhzKey) * instance->keys_capacity);
+    }
+
+    SubGhzKey* manufacture_code = &instance->keys[instance->keys_count++];
     manufacture_code->key = key;
+    manufacture_code->name = name;
     manufacture_code->type = type;
+    instance->index_valid = false;
+
+    return true;
+}
+
+bool subghz_keystore_add_key(
+    SubGhzKeystore* instance,
+    const char* name,
+    uint64_t key,
+    uint16_t type) {
+    furi_check(instance);
+    furi_check(name);
+
+    return subghz_keystore_add_interned_key(
+        instance, subghz_keystore_names_intern(instance, name, false), key, type);
+}
+
+static void subghz_keystore_shrink(SubGhzKeystore* instance) {
+    if(instance->keys_count && (instance->keys_count < instance->keys_capacity)) {
+        instance->keys = realloc(instance->keys, sizeof(SubGhzKey) * instance->keys_count);
+        instance->keys_capacity = instance->keys_count;
+    }
+}
+
+static int subghz_keystore_name_index_cmp(const void* a, const void* b) {
+    const SubGhzKeystoreNameIndex* name_a = a;
+    const SubGhzKeystoreNameIndex* name_b = b;
+    // Names are interned, same name is the same pointer
+    if(name_a->name != name_b->name) {
+        return ((uintptr_t)name_a->name < (uintptr_t)name_b->name) ? -1 : 1;
+    }
+    return (int)name_a->index - (int)name_b->index;
+}
+
+static void subghz_keystore_update_index(SubGhzKeystore* instance) {
+    if(instance->index_valid) return;
+
+    free(instance->type_index);
+    free(instance->name_index);
+    instance->type_index = malloc(sizeof(uint16_t) * MAX(instance->keys_count, 1U));
+    instance->name_index =
+        malloc(sizeof(SubGhzKeystoreNameIndex) * MAX(instance->keys_count, 1U));
+
+    // Counting sort by type, keeps the order of keys with the same type
+    uint16_t* offset = instance->type_index_offset;
+    memset(offset, 0, sizeof(instance->type_index_offset));
+    for(size_t i = 0; i < instance->keys_count; i++) {
+        if(instance->keys[i].type < SUBGHZ_KEYSTORE_TYPE_INDEX_COUNT) {
+            offset[instance->keys[i].type + 1]++;
+        }
+    }
+    for(size_t type = 0; type < SUBGHZ_KEYSTORE_TYPE_INDEX_COUNT; type++) {
+        offset[type + 1] += offset[type];
+    }
+    uint16_t position[SUBGHZ_KEYSTORE_TYPE_INDEX_COUNT];
+    memcpy(position, offset, sizeof(position));
+    for(size_t i = 0; i < instance->keys_count; i++) {
+        if(instance->keys[i].type < SUBGHZ_KEYSTORE_TYPE_INDEX_COUNT) {
+            instance->type_index[position[instance->keys[i].type]++] = i;
+        }
+    }
+
+    for(size_t i = 0; i < instance->keys_count; i++) {
+        instance->name_index[i].name = instance->keys[i].name;
+        instance->name_index[i].index = i;
+    }
+    qsort(
+        instance->name_index,
+        instance->keys_count,
+        sizeof(SubGhzKeystoreNameIndex),
+        subghz_keystore_name_index_cmp);
+
+    instance->index_valid = true;
 }
 
 static bool subghz_keystore_process_line(SubGhzKeystore* instance, char* line) {
+    char* type_end = NULL;
+    char* name = NULL;
     uint64_t key = 0;
-    uint16_t type = 0;
-    char skey[17] = {0};
-    char name[65] = {0};
-    int ret = sscanf(line, "%16s:%hu:%64s", skey, &type, name);
-    key = strtoull(skey, NULL, 16);
-    if(ret == 3) {
-        subghz_keystore_add_key(instance, name, key, type);
-        return true;
+    unsigned long type = 0;
+
+    // KEY:TYPE:NAME, 16 hex digits of key, name up to the end of line
+    char* key_end = strchr(line, ':');
+    if(key_end && (key_end - line <= 16) && (key_end != line)) {
+        *key_end = '\0';
+        key = strtoull(line, NULL, 16);
+        type = strtoul(key_end + 1, &type_end, 10);
+        if((type_end != key_end + 1) && (*type_end == ':') && (type <= UINT16_MAX)) {
+            name = type_end + 1;
+        }
+    }
+
+    // Names were read with %64s before, keep the same limit
+    size_t name_length = name ? strcspn(name, " \t") : 0;
+    if(name_length) {
+        name[MIN(name_length, 64U)] = '\0';
+        return subghz_keystore_add_key(instance, name, key, type);
     } else {
+        if(key_end) *key_end = ':';
         FURI_LOG_E(TAG, "Failed to load line: %s\r\n", line);
         return false;
     }
@@ -236,6 +537,8 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
     } while(0);
     flipper_format_free(flipper_format);
 
+    subghz_keystore_shrink(instance);
+
     furi_record_close(RECORD_STORAGE);
 
     furi_string_free(filetype);
@@ -281,47 +584,46 @@ bool subghz_keystore_save(SubGhzKeystore* instance, const char* file_name, uint8
 
         Stream* stream = flipper_format_get_raw_stream(flipper_format);
         size_t encrypted_line_count = 0;
-        for
-            M_EACH(key, instance->data, SubGhzKeyArray_t) {
-                // Wipe buffer before packing
-                memset(decrypted_line, 0, SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE);
-                memset(encrypted_line, 0, SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE);
-                // Form unecreypted line
-                int len = snprintf(
-                    decrypted_line,
-                    SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE,
-                    "%08lX%08lX:%hu:%s",
-                    (uint32_t)(key->key >> 32),
-                    (uint32_t)key->key,
-                    key->type,
-                    furi_string_get_cstr(key->name));
-                // Verify length and align
-                furi_assert(len > 0);
-                if(len % 16 != 0) {
-                    len += (16 - len % 16);
-                }
-                furi_assert(len % 16 == 0);
-                furi_assert(len <= SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE);
-                // Form encrypted line
-                if(!furi_hal_crypto_encrypt(
-                       (uint8_t*)decrypted_line, (uint8_t*)encrypted_line, len)) {
-                    FURI_LOG_E(TAG, "Encryption failed");
-                    break;
-                }
-                // HEX Encode encrypted line
-                const char xx[] = "0123456789ABCDEF";
-                for(int i = 0; i < len; i++) {
-                    size_t cursor = len - i - 1;
-                    size_t hex_cursor = len * 2 - i * 2 - 1;
-                    encrypted_line[hex_cursor] = xx[encrypted_line[cursor] & 0xF];
-                    encrypted_line[hex_cursor - 1] = xx[(encrypted_line[cursor] >> 4) & 0xF];
-                }
-                stream_write_cstring(stream, encrypted_line);
-                stream_write_char(stream, '\n');
-                encrypted_line_count++;
+        for(size_t key_index = 0; key_index < instance->keys_count; key_index++) {
+            const SubGhzKey* key = &instance->keys[key_index];
+            // Wipe buffer before packing
+            memset(decrypted_line, 0, SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE);
+            memset(encrypted_line, 0, SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE);
+            // Form unecreypted line
+            int len = snprintf(
+                decrypted_line,
+                SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE,
+                "%08lX%08lX:%hu:%s",
+                (uint32_t)(key->key >> 32),
+                (uint32_t)key->key,
+                key->type,
+                key->name);
+            // Verify length and align
+            furi_assert(len > 0);
+            if(len % 16 != 0) {
+                len += (16 - len % 16);
+            }
+            furi_assert(len % 16 == 0);
+            furi_assert(len <= SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE);
+            // Form encrypted line
+            if(!furi_hal_crypto_encrypt((uint8_t*)decrypted_line, (uint8_t*)encrypted_line, len)) {
+                FURI_LOG_E(TAG, "Encryption failed");
+                break;
             }
+            // HEX Encode encrypted line
+            const char xx[] = "0123456789ABCDEF";
+            for(int i = 0; i < len; i++) {
+                size_t cursor = len - i - 1;
+                size_t hex_cursor = len * 2 - i * 2 - 1;
+                encrypted_line[hex_cursor] = xx[encrypted_line[cursor] & 0xF];
+                encrypted_line[hex_cursor - 1] = xx[(encrypted_line[cursor] >> 4) & 0xF];
+            }
+            stream_write_cstring(stream, encrypted_line);
+            stream_write_char(stream, '\n');
+            encrypted_line_count++;
+        }
         furi_hal_crypto_enclave_unload_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT);
-        size_t total_keys = SubGhzKeyArray_size(instance->data);
+        size_t total_keys = instance->keys_count;
         result = encrypted_line_count == total_keys;
         if(result) {
             FURI_LOG_I(TAG, "Success. Encrypted: %zu of %zu", encrypted_line_count, total_keys);
@@ -338,9 +640,389 @@ bool subghz_keystore_save(SubGhzKeystore* instance, const char* file_name, uint8
     return result;
 }
 
-SubGhzKeyArray_t* subghz_keystore_get_data(SubGhzKeystore* instance) {
-    furi_assert(instance);
-    return &instance->data;
+const SubGhzKey* subghz_keystore_get_keys(SubGhzKeystore* instance, size_t* count) {
+    furi_check(instance);
+    furi_check(count);
+
+    *count = instance->keys_count;
+    return instance->keys;
+}
+
+const uint16_t*
+    subghz_keystore_get_type_index(SubGhzKeystore* instance, uint16_t type, size_t* count) {
+    furi_check(instance);
+    furi_check(type < SUBGHZ_KEYSTORE_TYPE_INDEX_COUNT);
+    furi_check(count);
+
+    subghz_keystore_update_index(instance);
+    *count = instance->type_index_offset[type + 1] - instance->type_index_offset[type];
+    return &instance->type_index[instance->type_index_offset[type]];
+}
+
+const SubGhzKey* subghz_keystore_find_by_name(SubGhzKeystore* instance, const char* name) {
+    furi_check(instance);
+    furi_check(name);
+
+    if(!instance->names_count) return NULL;
+
+    const char* interned = *subghz_keystore_names_find(instance, name);
+    if(!interned) return NULL;
+
+    subghz_keystore_update_index(instance);
+
+    // Lower bound, the first key with the name
+    size_t low = 0;
+    size_t high = instance->keys_count;
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if((uintptr_t)instance->name_index[middle].name < (uintptr_t)interned) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if((low < instance->keys_count) && (instance->name_index[low].name == interned)) {
+        return &instance->keys[instance->name_index[low].index];
+    }
+    return NULL;
+}
+
+// Storage timestamp changes on every write, remove and card mount. While it and
+// the size are the same, the source file is the one hashed last time.
+typedef struct {
+    bool valid;
+    uint32_t path_crc;
+    uint32_t size;
+    uint32_t timestamp;
+    uint32_t crc;
+} SubGhzKeystoreSourceStamp;
+
+static SubGhzKeystoreSourceStamp subghz_keystore_source_stamp = {0};
+
+static void subghz_keystore_source_stamp_set(
+    Storage* storage,
+    const char* file_name,
+    uint32_t crc,
+    uint32_t size) {
+    SubGhzKeystoreSourceStamp stamp = {
+        .path_crc = crc32_calc_buffer(0, file_name, strlen(file_name)),
+        .size = size,
+        .crc = crc,
+    };
+    stamp.valid = (storage_common_timestamp(storage, file_name, &stamp.timestamp) == FSE_OK);
+
+    FURI_CRITICAL_ENTER();
+    subghz_keystore_source_stamp = stamp;
+    FURI_CRITICAL_EXIT();
+}
+
+static bool subghz_keystore_source_hash(
+    Storage* storage,
+    const char* file_name,
+    uint32_t* crc,
+    uint32_t* size) {
+    File* file = storage_file_alloc(storage);
+    bool result = false;
+
+    SubGhzKeystoreSourceStamp stamp;
+    FURI_CRITICAL_ENTER();
+    stamp = subghz_keystore_source_stamp;
+    FURI_CRITICAL_EXIT();
+    uint32_t timestamp = 0;
+    bool is_same = stamp.valid &&
+                   (stamp.path_crc == crc32_calc_buffer(0, file_name, strlen(file_name))) &&
+                   (storage_common_timestamp(storage, file_name, &timestamp) == FSE_OK) &&
+                   (stamp.timestamp == timestamp);
+
+    if(storage_file_open(file, file_name, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        *size = storage_file_size(file);
+        if(is_same && (stamp.size == *size)) {
+            *crc = stamp.crc;
+        } else {
+            // Storage has changed since, CRC tells if the file is still the same
+            *crc = crc32_calc_file(file, NULL, NULL);
+            subghz_keystore_source_stamp_set(storage, file_name, *crc, *size);
+        }
+        result = true;
+    } else {
+        FURI_LOG_E(TAG, "Unable to open file for read: %s", file_name);
+    }
+
+    storage_file_free(file);
+    return result;
+}
+
+static bool subghz_keystore_cache_read(
+    SubGhzKeystore* instance,
+    Storage* storage,
+    const char* cache_file_name,
+    uint32_t source_crc,
+    uint32_t source_size) {
+    File* file = storage_file_alloc(storage);
+    SubGhzKeystoreCacheKey* chunk = malloc(SUBGHZ_KEYSTORE_CACHE_CHUNK_SIZE);
+    const size_t keys_start = instance->keys_count;
+    SubGhzKeystoreCacheHeader header;
+    SubGhzKeystoreNamesBlock* names_block = NULL;
+    bool key_loaded = false;
+    bool result = false;
+
+    do {
+        if(!storage_file_open(file, cache_file_name, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        if((header.magic != SUBGHZ_KEYSTORE_CACHE_MAGIC) ||
+           (header.version != SUBGHZ_KEYSTORE_CACHE_VERSION) ||
+           (header.source_crc != source_crc) || (header.source_size != source_size)) {
+            FURI_LOG_I(TAG, "Cache is outdated");
+            break;
+        }
+        if((header.keys_count > SUBGHZ_KEYSTORE_KEYS_MAX - keys_start) ||
+           (header.names_size == 0) || (header.names_size % SUBGHZ_KEYSTORE_CACHE_ALIGN) ||
+           (header.names_size > SUBGHZ_KEYSTORE_CACHE_NAMES_SIZE_MAX) ||
+           (storage_file_size(file) != sizeof(header) + header.names_size +
+                                           header.keys_count * sizeof(SubGhzKeystoreCacheKey))) {
+            FURI_LOG_E(TAG, "Invalid cache");
+            break;
+        }
+
+        subghz_keystore_mess_with_iv(header.iv);
+        if(!furi_hal_crypto_enclave_load_key(
+               SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT, header.iv)) {
+            FURI_LOG_E(TAG, "Unable to load decryption key");
+            break;
+        }
+        key_loaded = true;
+
+        if(memmgr_heap_get_max_free_block() <
+           sizeof(SubGhzKeystoreNamesBlock) + header.names_size +
+               SUBGHZ_KEYSTORE_CACHE_HEAP_RESERVE) {
+            FURI_LOG_W(TAG, "Not enough memory to load cache");
+            break;
+        }
+
+        // Names are decrypted in place and interned as is, own block can be dropped on error
+        names_block = subghz_keystore_names_block_alloc(instance, header.names_size, true);
+        names_block->used = header.names_size;
+        char* names = names_block->data;
+        if((storage_file_read(file, names, header.names_size) != header.names_size) ||
+           !furi_hal_crypto_decrypt((uint8_t*)names, (uint8_t*)names, header.names_size) ||
+           (names[header.names_size - 1] != '\0')) {
+            FURI_LOG_E(TAG, "Invalid cache names");
+            break;
+        }
+        uint32_t crc = crc32_calc_buffer(0, names, header.names_size);
+
+        size_t keys_left = header.keys_count;
+        while(keys_left) {
+            size_t count = MIN(keys_left, SUBGHZ_KEYSTORE_CACHE_CHUNK_KEYS);
+            size_t size = count * sizeof(SubGhzKeystoreCacheKey);
+            if((storage_file_read(file, chunk, size) != size) ||
+               !furi_hal_crypto_decrypt((uint8_t*)chunk, (uint8_t*)chunk, size)) {
+                break;
+            }
+            crc = crc32_calc_buffer(crc, chunk, size);
+
+            for(size_t i = 0; i < count; i++) {
+                if(chunk[i].name >= header.names_size) break;
+                const char* name =
+                    subghz_keystore_names_intern(instance, &names[chunk[i].name], true);
+                if(!subghz_keystore_add_interned_key(instance, name, chunk[i].key, chunk[i].type))
+                    break;
+            }
+            keys_left -= count;
+            if(instance->keys_count != keys_start + header.keys_count - keys_left) break;
+        }
+        memset(chunk, 0, SUBGHZ_KEYSTORE_CACHE_CHUNK_SIZE);
+
+        result = (instance->keys_count == keys_start + header.keys_count) && (crc == header.crc);
+        if(!result) FURI_LOG_E(TAG, "Invalid cache keys");
+    } while(false);
+
+    if(key_loaded) furi_hal_crypto_enclave_unload_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT);
+    if(!result) {
+        instance->keys_count = keys_start;
+        if(names_block) subghz_keystore_names_block_free(instance, names_block);
+    }
+
+    free(chunk);
+    storage_file_free(file);
+
+    return result;
+}
+
+static void subghz_keystore_cache_key_pack(
+    SubGhzKeystoreCacheKey* cache_key,
+    const SubGhzKey* manufacture_code,
+    uint32_t name_offset) {
+    cache_key->key = manufacture_code->key;
+    cache_key->name = name_offset;
+    cache_key->type = manufacture_code->type;
+    cache_key->reserved = 0;
+}
+
+// Names of the keys from keys_start on, each name once. Name index groups keys by name.
+static size_t subghz_keystore_cache_names(
+    SubGhzKeystore* instance,
+    size_t keys_start,
+    uint32_t* names_offset,
+    char* names_data) {
+    const char* name = NULL;
+    uint32_t offset = 0;
+    bool is_stored = false;
+    size_t names_size = 0;
+
+    subghz_keystore_update_index(instance);
+    for(size_t i = 0; i < instance->keys_count; i++) {
+        const SubGhzKeystoreNameIndex* entry = &instance->name_index[i];
+        if(entry->name != name) {
+            name = entry->name;
+            is_stored = false;
+        }
+        if(entry->index < keys_start) continue;
+
+        if(!is_stored) {
+            offset = names_size;
+            names_size += strlen(name) + 1;
+            if(names_data) strcpy(&names_data[offset], name);
+            is_stored = true;
+        }
+        names_offset[entry->index - keys_start] = offset;
+    }
+
+    return names_size;
+}
+
+static bool subghz_keystore_cache_write(
+    SubGhzKeystore* instance,
+    Storage* storage,
+    const char* cache_file_name,
+    size_t keys_start,
+    uint32_t source_crc,
+    uint32_t source_size) {
+    const size_t keys_count = instance->keys_count - keys_start;
+    const SubGhzKey* keys = &instance->keys[keys_start];
+
+    uint32_t* names_offset = malloc(sizeof(uint32_t) * MAX(keys_count, 1U));
+    size_t names_size = subghz_keystore_cache_names(instance, keys_start, names_offset, NULL);
+    names_size = (names_size / SUBGHZ_KEYSTORE_CACHE_ALIGN + 1) * SUBGHZ_KEYSTORE_CACHE_ALIGN;
+
+    File* file = storage_file_alloc(storage);
+    SubGhzKeystoreCacheKey* chunk = malloc(SUBGHZ_KEYSTORE_CACHE_CHUNK_SIZE);
+    uint8_t* names_data = malloc(names_size);
+    SubGhzKeystoreCacheHeader header = {
+        .magic = SUBGHZ_KEYSTORE_CACHE_MAGIC,
+        .version = SUBGHZ_KEYSTORE_CACHE_VERSION,
+        .source_crc = source_crc,
+        .source_size = source_size,
+        .keys_count = keys_count,
+        .names_size = names_size,
+    };
+    uint8_t iv[sizeof(header.iv)];
+    bool key_loaded = false;
+    bool result = false;
+
+    memset(names_data, 0, names_size);
+    subghz_keystore_cache_names(instance, keys_start, names_offset, (char*)names_data);
+
+    // Header is written first, so CRC of the plain payload is taken beforehand
+    header.crc = crc32_calc_buffer(0, names_data, names_size);
+    for(size_t i = 0; i < keys_count; i++) {
+        subghz_keystore_cache_key_pack(&chunk[0], &keys[i], names_offset[i]);
+        header.crc = crc32_calc_buffer(header.crc, &chunk[0], sizeof(SubGhzKeystoreCacheKey));
+    }
+
+    do {
+        if(names_size > SUBGHZ_KEYSTORE_CACHE_NAMES_SIZE_MAX) break;
+
+        furi_hal_random_fill_buf(header.iv, sizeof(header.iv));
+        memcpy(iv, header.iv, sizeof(iv));
+        subghz_keystore_mess_with_iv(iv);
+
+        if(!storage_file_open(file, cache_file_name, FSAM_WRITE, FSOM_CREATE_ALWAYS)) break;
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        if(!furi_hal_crypto_enclave_load_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT, iv)) {
+            FURI_LOG_E(TAG, "Unable to load encryption key");
+            break;
+        }
+        key_loaded = true;
+
+        if(!furi_hal_crypto_encrypt(names_data, names_data, names_size) ||
+           (storage_file_write(file, names_data, names_size) != names_size))
+            break;
+
+        size_t written = 0;
+        while(written < keys_count) {
+            size_t count = MIN(keys_count - written, SUBGHZ_KEYSTORE_CACHE_CHUNK_KEYS);
+            size_t size = count * sizeof(SubGhzKeystoreCacheKey);
+            for(size_t i = 0; i < count; i++) {
+                subghz_keystore_cache_key_pack(
+                    &chunk[i], &keys[written + i], names_offset[written + i]);
+            }
+            if(!furi_hal_crypto_encrypt((uint8_t*)chunk, (uint8_t*)chunk, size) ||
+               (storage_file_write(file, chunk, size) != size))
+                break;
+            written += count;
+        }
+
+        result = (written == keys_count);
+    } while(false);
+
+    if(key_loaded) furi_hal_crypto_enclave_unload_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT);
+
+    // Wipe plain keys and names before freeing
+    memset(chunk, 0, SUBGHZ_KEYSTORE_CACHE_CHUNK_SIZE);
+    memset(names_data, 0, names_size);
+    free(chunk);
+    free(names_data);
+    free(names_offset);
+    storage_file_free(file);
+
+    if(!result) storage_simply_remove(storage, cache_file_name);
+
+    return result;
+}
+
+bool subghz_keystore_load_cached(
+    SubGhzKeystore* instance,
+    const char* file_name,
+    const char* cache_file_name) {
+    furi_check(instance);
+    furi_check(file_name);
+    furi_check(cache_file_name);
+
+    bool result = false;
+    uint32_t source_crc = 0;
+    uint32_t source_size = 0;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    do {
+        if(!subghz_keystore_source_hash(storage, file_name, &source_crc, &source_size)) break;
+
+        if(subghz_keystore_cache_read(
+               instance, storage, cache_file_name, source_crc, source_size)) {
+            FURI_LOG_I(TAG, "Loaded from cache %s", cache_file_name);
+            subghz_keystore_shrink(instance);
+            result = true;
+            break;
+        }
+
+        size_t keys_start = instance->keys_count;
+        if(!subghz_keystore_load(instance, file_name)) break;
+        result = true;
+
+        if(!subghz_keystore_cache_write(
+               instance, storage, cache_file_name, keys_start, source_crc, source_size)) {
+            FURI_LOG_W(TAG, "Unable to write cache %s", cache_file_name);
+        }
+        // Cache write has changed the storage timestamp, the source is still the same
+        subghz_keystore_source_stamp_set(storage, file_name, source_crc, source_size);
+    } while(false);
+
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
 }
 
 bool subghz_keystore_raw_encrypted_save(
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <furi.h>
-#include <m-array.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -9,14 +8,16 @@ extern "C" {
 #endif
 
 typedef struct {
-    FuriString* name;
     uint64_t key;
+    const char* name; /**< Interned, valid till the keystore is freed */
     uint16_t type;
 } SubGhzKey;
 
-ARRAY_DEF(SubGhzKeyArray, SubGhzKey, M_POD_OPLIST)
+/** Key types below this value are indexed, see subghz_keystore_get_type_index */
+#define SUBGHZ_KEYSTORE_TYPE_INDEX_COUNT (16U)
 
-#define M_OPL_SubGhzKeyArray_t() ARRAY_OPLIST(SubGhzKeyArray, M_POD_OPLIST)
+/** Keystore capacity, key index fits into uint16_t */
+#define SUBGHZ_KEYSTORE_KEYS_MAX (UINT16_MAX)
 
 typedef struct SubGhzKeystore SubGhzKeystore;
 
@@ -39,6 +40,20 @@ void subghz_keystore_free(SubGhzKeystore* instance);
  */
 bool subghz_keystore_load(SubGhzKeystore* instance, const char* filename);
 
+/** 
+ * Loading manufacture key from file, through the binary cache
+ * Cache is used if it was made from the same file, otherwise the file is
+ * loaded and the cache is made again.
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param filename Full path to the file
+ * @param cache_filename Full path to the cache file
+ * @return true On success
+ */
+bool subghz_keystore_load_cached(
+    SubGhzKeystore* instance,
+    const char* filename,
+    const char* cache_filename);
+
 /** 
  * Save manufacture key to file
  * @param instance Pointer to a SubGhzKeystore instance
@@ -48,11 +63,44 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* filename);
 bool subghz_keystore_save(SubGhzKeystore* instance, const char* filename, uint8_t* iv);
 
 /** 
- * Get array of keys and names manufacture
+ * Add manufacture key
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param name Manufacture name
+ * @param key Manufacture key
+ * @param type Learning type
+ * @return true On success, false if the keystore is full
+ */
+bool subghz_keystore_add_key(
+    SubGhzKeystore* instance,
+    const char* name,
+    uint64_t key,
+    uint16_t type);
+
+/** 
+ * Get manufacture keys, in the order of loading
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param count Number of keys
+ * @return const SubGhzKey* array of keys, valid till the next key is added
+ */
+const SubGhzKey* subghz_keystore_get_keys(SubGhzKeystore* instance, size_t* count);
+
+/** 
+ * Get indexes of manufacture keys with the type, in the order of loading
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param type Learning type, less than SUBGHZ_KEYSTORE_TYPE_INDEX_COUNT
+ * @param count Number of indexes
+ * @return const uint16_t* array of indexes in subghz_keystore_get_keys
+ */
+const uint16_t*
+    subghz_keystore_get_type_index(SubGhzKeystore* instance, uint16_t type, size_t* count);
+
+/** 
+ * Find the first manufacture key with the name
  * @param instance Pointer to a SubGhzKeystore instance
- * @return SubGhzKeyArray_t*
+ * @param name Manufacture name
+ * @return const SubGhzKey* found key or NULL
  */
-SubGhzKeyArray_t* subghz_keystore_get_data(SubGhzKeystore* instance);
+const SubGhzKey* subghz_keystore_find_by_name(SubGhzKeystore* instance, const char* name);
 
 /** 
  * Save RAW encrypted to file
@@ -0,0 +1,220 @@
+#include "subghz_raw_file.h"
+#include "subghz_file_encoder_worker.h"
+
+#include <toolbox/stream/buffered_file_stream.h>
+#include <toolbox/varint.h>
+
+#define TAG "SubGhzRawFile"
+
+#define SUBGHZ_RAW_FILE_VARINT_SIZE_MAX 5
+#define SUBGHZ_RAW_FILE_WRITE_CHUNK 64
+#define SUBGHZ_RAW_FILE_RAW_DATA_KEY "RAW_Data:"
+#define SUBGHZ_RAW_FILE_TEXT_CHUNK 512
+
+bool subghz_raw_file_write_blocks(Stream* stream, const int32_t* durations, size_t count) {
+    furi_check(stream);
+    furi_check(durations || !count);
+
+    uint8_t buffer[SUBGHZ_RAW_FILE_WRITE_CHUNK + SUBGHZ_RAW_FILE_VARINT_SIZE_MAX];
+    bool result = true;
+
+    while(result && count) {
+        // Fill the block till the durations or the payload limit
+        SubGhzRawFileBlockHeader header = {
+            .magic = SUBGHZ_RAW_FILE_BLOCK_MAGIC,
+            .count = 0,
+            .size = 0,
+        };
+        while((header.count < count) && (header.count < SUBGHZ_RAW_FILE_BLOCK_DURATIONS_MAX)) {
+            size_t length = varint_int32_length(durations[header.count]);
+            if(header.size + length > SUBGHZ_RAW_FILE_BLOCK_SIZE_MAX) break;
+            header.size += length;
+            header.count++;
+        }
+
+        if(stream_write(stream, (const uint8_t*)&header, sizeof(SubGhzRawFileBlockHeader)) !=
+           sizeof(SubGhzRawFileBlockHeader)) {
+            result = false;
+            break;
+        }
+
+        size_t used = 0;
+        for(size_t i = 0; i < header.count; i++) {
+            used += varint_int32_pack(durations[i], &buffer[used]);
+            if((used >= SUBGHZ_RAW_FILE_WRITE_CHUNK) || (i == header.count - 1U)) {
+                if(stream_write(stream, buffer, used) != used) {
+                    result = false;
+                    break;
+                }
+                used = 0;
+            }
+        }
+
+        durations += header.count;
+        count -= header.count;
+    }
+
+    if(!result) FURI_LOG_E(TAG, "Unable to write block");
+    return result;
+}
+
+bool subghz_raw_file_read_block(
+    Stream* stream,
+    uint8_t* buffer,
+    int32_t* durations,
+    size_t* count) {
+    furi_check(stream);
+    furi_check(buffer);
+    furi_check(durations);
+    furi_check(count);
+
+    SubGhzRawFileBlockHeader header;
+    bool result = false;
+    *count = 0;
+
+    do {
+        if(stream_read(stream, (uint8_t*)&header, sizeof(SubGhzRawFileBlockHeader)) !=
+           sizeof(SubGhzRawFileBlockHeader))
+            break;
+
+        if((header.magic != SUBGHZ_RAW_FILE_BLOCK_MAGIC) ||
+           (header.count > SUBGHZ_RAW_FILE_BLOCK_DURATIONS_MAX) ||
+           (header.size > SUBGHZ_RAW_FILE_BLOCK_SIZE_MAX)) {
+            FURI_LOG_E(TAG, "Invalid block header");
+            break;
+        }
+
+        if(stream_read(stream, buffer, header.size) != header.size) {
+            FURI_LOG_E(TAG, "Block is truncated");
+            break;
+        }
+
+        size_t offset = 0;
+        size_t i = 0;
+        for(; (i < header.count) && (offset < header.size); i++) {
+            offset += varint_int32_unpack(&durations[i], &buffer[offset], header.size - offset);
+        }
+
+        // Every duration is decoded and the payload is consumed exactly
+        if((i != header.count) || (offset != header.size)) {
+            FURI_LOG_E(TAG, "Invalid block payload");
+            break;
+        }
+
+        *count = header.count;
+        result = true;
+    } while(false);
+
+    return result;
+}
+
+static bool subghz_raw_file_line_has_key(const char* line, size_t line_size, const char* key) {
+    size_t key_size = strlen(key);
+    return (line_size >= key_size) && (memcmp(line, key, key_size) == 0);
+}
+
+static bool subghz_raw_file_write_line(Stream* stream, const char* line, size_t line_size) {
+    return (stream_write(stream, (const uint8_t*)line, line_size) == line_size) &&
+           (stream_write_char(stream, '\n') == 1);
+}
+
+bool subghz_raw_file_convert_to_varint(
+    Storage* storage,
+    const char* source_path,
+    const char* destination_path) {
+    furi_check(storage);
+    furi_check(source_path);
+    furi_check(destination_path);
+
+    Stream* source = buffered_file_stream_alloc(storage);
+    Stream* destination = buffered_file_stream_alloc(storage);
+    int32_t* durations = malloc(sizeof(int32_t) * SUBGHZ_RAW_FILE_BLOCK_DURATIONS_MAX);
+    char* text = malloc(SUBGHZ_RAW_FILE_TEXT_CHUNK);
+    const char* encoding_line =
+        SUBGHZ_RAW_FILE_ENCODING_KEY ": " SUBGHZ_RAW_FILE_ENCODING_VARINT;
+    bool result = false;
+
+    do {
+        if(!buffered_file_stream_open(source, source_path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            FURI_LOG_E(TAG, "Unable to open file for read: %s", source_path);
+            break;
+        }
+        if(!buffered_file_stream_open(
+               destination, destination_path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS)) {
+            FURI_LOG_E(TAG, "Unable to open file for write: %s", destination_path);
+            break;
+        }
+
+        // Header lines are short, copy them as is till the first RAW_Data line
+        const char* line = NULL;
+        size_t line_size = 0;
+        size_t data_start = stream_tell(source);
+        bool error = false;
+
+        while(!error && stream_read_line_view(source, &line, &line_size)) {
+            if(subghz_raw_file_line_has_key(line, line_size, SUBGHZ_RAW_FILE_RAW_DATA_KEY)) {
+                error = !stream_seek(source, data_start, StreamOffsetFromStart);
+                break;
+            }
+            if(subghz_raw_file_line_has_key(line, line_size, SUBGHZ_RAW_FILE_ENCODING_KEY)) {
+                FURI_LOG_E(TAG, "Not a text RAW file");
+                error = true;
+            } else {
+                error = !subghz_raw_file_write_line(destination, line, line_size);
+            }
+            data_start = stream_tell(source);
+        }
+        if(error ||
+           !subghz_raw_file_write_line(destination, encoding_line, strlen(encoding_line))) {
+            break;
+        }
+
+        // RAW_Data lines are longer than the stream cache, parse them in chunks
+        SubGhzFileEncoderWorkerParser parser;
+        subghz_file_encoder_worker_parser_reset(&parser);
+        size_t count = 0;
+        bool is_end = false;
+
+        while(!error && !is_end) {
+            size_t size = stream_read(source, (uint8_t*)text, SUBGHZ_RAW_FILE_TEXT_CHUNK);
+            if(size == 0) {
+                // Flush the last value if the file doesn't end with a new line
+                text[0] = '\n';
+                size = 1;
+                is_end = true;
+            }
+
+            size_t position = 0;
+            while(!error && (position < size)) {
+                size_t parsed = 0;
+                if(!subghz_file_encoder_worker_parse_raw_data(
+                       &parser,
+                       text,
+                       size,
+                       &position,
+                       &durations[count],
+                       SUBGHZ_RAW_FILE_BLOCK_DURATIONS_MAX - count,
+                       &parsed)) {
+                    FURI_LOG_E(TAG, "Malformed RAW_Data at line %lu", parser.lines + 1);
+                    error = true;
+                }
+                count += parsed;
+                // Blocks are always full, except the last one
+                if(!error && ((count == SUBGHZ_RAW_FILE_BLOCK_DURATIONS_MAX) || is_end)) {
+                    error = !subghz_raw_file_write_blocks(destination, durations, count);
+                    count = 0;
+                }
+            }
+        }
+        if(error) break;
+
+        result = buffered_file_stream_sync(destination);
+    } while(false);
+
+    free(text);
+    free(durations);
+    stream_free(destination);
+    stream_free(source);
+
+    return result;
+}
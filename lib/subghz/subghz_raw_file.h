@@ -0,0 +1,75 @@
+#pragma once
+
+#include <furi.h>
+#include <storage/storage.h>
+#include <toolbox/stream/stream.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Varint RAW file: the usual RAW file header, followed by the encoding key
+ * line and binary blocks of zigzag varint durations, till the end of file.
+ *
+ *   Protocol: RAW
+ *   RAW_Encoding: Varint
+ *   [block header][payload][block header][payload]...
+ *
+ * Every block has its own header with the number of durations and the size
+ * of the payload, so blocks can be skipped without decoding.
+ */
+
+#define SUBGHZ_RAW_FILE_ENCODING_KEY "RAW_Encoding"
+#define SUBGHZ_RAW_FILE_ENCODING_VARINT "Varint"
+
+#define SUBGHZ_RAW_FILE_BLOCK_MAGIC (0x42574152UL) // "RAWB"
+#define SUBGHZ_RAW_FILE_BLOCK_DURATIONS_MAX (512U)
+#define SUBGHZ_RAW_FILE_BLOCK_SIZE_MAX (1024U)
+
+typedef struct {
+    uint32_t magic;
+    uint16_t count; /**< Durations in the block */
+    uint16_t size; /**< Payload size in bytes */
+} SubGhzRawFileBlockHeader;
+
+/**
+ * Write durations as varint blocks
+ * Durations that don't fit into one block are split over several blocks.
+ * @param stream Pointer to a Stream instance, at the position to write
+ * @param durations Signed durations, negative for low level
+ * @param count Number of durations
+ * @return bool - true if all durations were written
+ */
+bool subghz_raw_file_write_blocks(Stream* stream, const int32_t* durations, size_t count);
+
+/**
+ * Read the next varint block
+ * @param stream Pointer to a Stream instance, at the block header
+ * @param buffer Payload buffer, at least SUBGHZ_RAW_FILE_BLOCK_SIZE_MAX bytes
+ * @param durations Array to store durations, at least SUBGHZ_RAW_FILE_BLOCK_DURATIONS_MAX
+ * @param count Number of stored durations
+ * @return bool - false on the end of file or a damaged block
+ */
+bool subghz_raw_file_read_block(
+    Stream* stream,
+    uint8_t* buffer,
+    int32_t* durations,
+    size_t* count);
+
+/**
+ * Convert a text RAW file to the varint encoding
+ * Header lines are copied as is, RAW_Data lines are replaced with varint blocks.
+ * @param storage Pointer to a Storage instance
+ * @param source_path Text RAW file path
+ * @param destination_path Varint RAW file path, overwritten if exists
+ * @return bool - true if converted
+ */
+bool subghz_raw_file_convert_to_varint(
+    Storage* storage,
+    const char* source_path,
+    const char* destination_path);
+
+#ifdef __cplusplus
+}
+#endif
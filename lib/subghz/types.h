@@ -8,6 +8,7 @@
 #include <lib/toolbox/level_duration.h>
 
 #include "environment.h"
+#include "blocks/const.h"
 #include <furi.h>
 #include <furi_hal.h>
 
@@ -24,6 +25,7 @@
 
 #define SUBGHZ_KEYSTORE_DIR_NAME EXT_PATH("subghz/assets/keeloq_mfcodes")
 #define SUBGHZ_KEYSTORE_DIR_USER_NAME EXT_PATH("subghz/assets/keeloq_mfcodes_user")
+#define SUBGHZ_KEYSTORE_CACHE_DIR_NAME EXT_PATH("subghz/assets/.keeloq_mfcodes.cache")
 #define SUBGHZ_CAME_ATOMO_DIR_NAME EXT_PATH("subghz/assets/came_atomo")
 #define SUBGHZ_NICE_FLOR_S_DIR_NAME EXT_PATH("subghz/assets/nice_flor_s")
 #define SUBGHZ_ALUTECH_AT_4N_DIR_NAME EXT_PATH("subghz/assets/alutech_at_4n")
@@ -81,6 +83,23 @@ typedef void (*SubGhzGetString)(void* decoder, FuriString* output);
 typedef void (*SubGhzEncoderStop)(void* encoder);
 typedef LevelDuration (*SubGhzEncoderYield)(void* context);
 
+/**
+ * Pulse that takes an idle decoder out of its reset step.
+ *
+ * Used by SubGhzReceiver to skip decoders that can't react to a pulse:
+ * decoder in reset step is only fed with pulses of matching level and
+ * duration within te * count +- te_delta * te_delta_count.
+ * Decoder must have no side effects on any other pulse while in reset step.
+ */
+typedef struct {
+    const SubGhzBlockConst* timing; /**< Protocol timing constants */
+    uint16_t te_short_count; /**< Pulse length in te_short units */
+    uint16_t te_long_count; /**< Pulse length in te_long units */
+    uint16_t te_delta_count; /**< Pulse tolerance in te_delta units */
+    bool level; /**< Pulse level */
+    size_t block_decoder_offset; /**< Offset of SubGhzBlockDecoder in decoder instance */
+} SubGhzProtocolDecoderTrigger;
+
 typedef struct {
     SubGhzAlloc alloc;
     SubGhzFree free;
@@ -92,6 +111,8 @@ typedef struct {
     SubGhzGetString get_string;
     SubGhzSerialize serialize;
     SubGhzDeserialize deserialize;
+
+    const SubGhzProtocolDecoderTrigger* trigger; /**< Optional, NULL to feed every pulse */
 } SubGhzProtocolDecoder;
 
 typedef struct {
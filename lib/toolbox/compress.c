@@ -249,7 +249,7 @@ bool compress_decode(
         *data_res_size = res_buff_size;
         result = !decode_failed;
     } else if(data_out_size >= data_in_size - 1) {
-        memcpy(data_out, &data_in[1], data_in_size);
+        memcpy(data_out, &data_in[1], data_in_size - 1);
         *data_res_size = data_in_size - 1;
         result = true;
     } else {
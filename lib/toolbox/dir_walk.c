@@ -3,6 +3,9 @@
 
 LIST_DEF(DirIndexList, uint32_t);
 
+#define DIR_WALK_NAME_LENGTH (256U)
+#define DIR_WALK_BATCH_SIZE (8U)
+
 struct DirWalk {
     File* file;
     FuriString* path;
@@ -11,6 +14,10 @@ struct DirWalk {
     bool recursive;
     DirWalkFilterCb filter_cb;
     void* filter_context;
+    FileInfo* batch_info;
+    char* batch_names;
+    size_t batch_count;
+    size_t batch_pos;
 };
 
 DirWalk* dir_walk_alloc(Storage* storage) {
@@ -22,6 +29,10 @@ DirWalk* dir_walk_alloc(Storage* storage) {
     DirIndexList_init(dir_walk->index_list);
     dir_walk->recursive = true;
     dir_walk->filter_cb = NULL;
+    dir_walk->batch_info = malloc(sizeof(FileInfo) * DIR_WALK_BATCH_SIZE);
+    dir_walk->batch_names = malloc(DIR_WALK_NAME_LENGTH * DIR_WALK_BATCH_SIZE);
+    dir_walk->batch_count = 0;
+    dir_walk->batch_pos = 0;
     return dir_walk;
 }
 
@@ -31,6 +42,8 @@ void dir_walk_free(DirWalk* dir_walk) {
     storage_file_free(dir_walk->file);
     furi_string_free(dir_walk->path);
     DirIndexList_clear(dir_walk->index_list);
+    free(dir_walk->batch_info);
+    free(dir_walk->batch_names);
     free(dir_walk);
 }
 
@@ -45,10 +58,27 @@ void dir_walk_set_filter_cb(DirWalk* dir_walk, DirWalkFilterCb cb, void* context
     dir_walk->filter_context = context;
 }
 
+static bool dir_walk_batch_read(DirWalk* dir_walk) {
+    dir_walk->batch_pos = 0;
+    dir_walk->batch_count = storage_dir_read_batch(
+        dir_walk->file,
+        dir_walk->batch_info,
+        dir_walk->batch_names,
+        DIR_WALK_NAME_LENGTH,
+        DIR_WALK_BATCH_SIZE);
+    return dir_walk->batch_count > 0;
+}
+
+static void dir_walk_batch_reset(DirWalk* dir_walk) {
+    dir_walk->batch_pos = 0;
+    dir_walk->batch_count = 0;
+}
+
 bool dir_walk_open(DirWalk* dir_walk, const char* path) {
     furi_check(dir_walk);
     furi_string_set(dir_walk->path, path);
     dir_walk->current_index = 0;
+    dir_walk_batch_reset(dir_walk);
     return storage_dir_open(dir_walk->file, path);
 }
 
@@ -63,18 +93,22 @@ static bool dir_walk_filter(DirWalk* dir_walk, const char* name, FileInfo* filei
 static DirWalkResult
     dir_walk_iter(DirWalk* dir_walk, FuriString* return_path, FileInfo* fileinfo) {
     DirWalkResult result = DirWalkError;
-    char* name = malloc(256); // FIXME: remove magic number
-    FileInfo info;
     bool end = false;
 
     while(!end) {
-        storage_dir_read(dir_walk->file, &info, name, 255);
+        if(dir_walk->batch_pos == dir_walk->batch_count) {
+            dir_walk_batch_read(dir_walk);
+        }
+
+        if(dir_walk->batch_pos < dir_walk->batch_count) {
+            const char* name = &dir_walk->batch_names[dir_walk->batch_pos * DIR_WALK_NAME_LENGTH];
+            FileInfo* info = &dir_walk->batch_info[dir_walk->batch_pos];
+            dir_walk->batch_pos++;
 
-        if(storage_file_get_error(dir_walk->file) == FSE_OK) {
             result = DirWalkOK;
             dir_walk->current_index++;
 
-            if(dir_walk_filter(dir_walk, name, &info)) {
+            if(dir_walk_filter(dir_walk, name, info)) {
                 if(return_path != NULL) {
                     furi_string_printf( //-V576
                         return_path,
@@ -84,19 +118,20 @@ static DirWalkResult
                 }
 
                 if(fileinfo != NULL) {
-                    memcpy(fileinfo, &info, sizeof(FileInfo));
+                    memcpy(fileinfo, info, sizeof(FileInfo));
                 }
 
                 end = true;
             }
 
-            if(file_info_is_dir(&info) && dir_walk->recursive) {
+            if(file_info_is_dir(info) && dir_walk->recursive) {
                 // step into
                 DirIndexList_push_back(dir_walk->index_list, dir_walk->current_index);
                 dir_walk->current_index = 0;
                 storage_dir_close(dir_walk->file);
 
                 furi_string_cat_printf(dir_walk->path, "/%s", name);
+                dir_walk_batch_reset(dir_walk);
                 storage_dir_open(dir_walk->file, furi_string_get_cstr(dir_walk->path));
             }
         } else if(storage_file_get_error(dir_walk->file) == FSE_NOT_EXIST) {
@@ -117,22 +152,24 @@ static DirWalkResult
                     furi_string_left(dir_walk->path, last_char);
                 }
 
+                dir_walk_batch_reset(dir_walk);
                 storage_dir_open(dir_walk->file, furi_string_get_cstr(dir_walk->path));
 
-                // rewind
-                while(true) {
-                    if(index == dir_walk->current_index) {
-                        result = DirWalkOK;
-                        break;
-                    }
-
-                    if(!storage_dir_read(dir_walk->file, &info, name, 255)) {
+                // rewind, entries read past the index stay in the batch
+                result = DirWalkOK;
+                while(dir_walk->current_index < index) {
+                    if((dir_walk->batch_pos == dir_walk->batch_count) &&
+                       !dir_walk_batch_read(dir_walk)) {
                         result = DirWalkError;
                         end = true;
                         break;
                     }
 
-                    dir_walk->current_index++;
+                    size_t skip = MIN(
+                        dir_walk->batch_count - dir_walk->batch_pos,
+                        index - dir_walk->current_index);
+                    dir_walk->batch_pos += skip;
+                    dir_walk->current_index += skip;
                 }
             }
         } else {
@@ -141,7 +178,6 @@ static DirWalkResult
         }
     }
 
-    free(name);
     return result;
 }
 
@@ -164,4 +200,5 @@ void dir_walk_close(DirWalk* dir_walk) {
     DirIndexList_reset(dir_walk->index_list);
     furi_string_reset(dir_walk->path);
     dir_walk->current_index = 0;
+    dir_walk_batch_reset(dir_walk);
 }
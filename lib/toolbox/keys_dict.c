@@ -5,14 +5,48 @@
 #include <toolbox/stream/file_stream.h>
 #include <toolbox/stream/buffered_file_stream.h>
 #include <toolbox/args.h>
+#include <toolbox/crc32_calc.h>
 
 #define TAG "KeysDict"
 
+#define KEYS_DICT_INDEX_MAGIC (0x5844494BU) // "KIDX"
+#define KEYS_DICT_INDEX_VERSION (1U)
+#define KEYS_DICT_INDEX_KEYS_MIN (64U)
+#define KEYS_DICT_INDEX_KEY_SIZE_MAX (sizeof(uint64_t))
+#define KEYS_DICT_INDEX_HEAP_RESERVE (4096U)
+#define KEYS_DICT_INDEX_BUFFER_SIZE (512U)
+
+/*
+ * Index file layout:
+ * - KeysDictIndexHeader
+ * - total_keys keys in text file order, big endian, key_size bytes each
+ * - same keys sorted, used for binary search
+ */
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t key_size;
+    uint16_t reserved;
+    uint32_t total_keys;
+    uint32_t source_size;
+    uint32_t source_crc;
+    uint32_t data_crc;
+} FURI_PACKED KeysDictIndexHeader;
+
+typedef enum {
+    KeysDictIndexSectionOrdered = 0,
+    KeysDictIndexSectionSorted = 1,
+} KeysDictIndexSection;
+
 struct KeysDict {
     Stream* stream;
     size_t key_size;
     size_t key_size_symbols;
     size_t total_keys;
+
+    FuriString* index_path;
+    Stream* index_stream; // NULL if keys are read from the text file
+    size_t index_next_key;
 };
 
 static inline void keys_dict_add_ending_new_line(KeysDict* instance) {
@@ -30,26 +64,259 @@ static inline void keys_dict_add_ending_new_line(KeysDict* instance) {
 }
 
 static bool keys_dict_read_key_line(KeysDict* instance, FuriString* line, bool* is_endfile) {
-    if(stream_read_line(instance->stream, line) == false) {
+    const char* data = NULL;
+    size_t data_size = 0;
+
+    if(stream_read_line_view(instance->stream, &data, &data_size) == false) {
         *is_endfile = true;
     }
 
     else {
-        FURI_LOG_T(
-            TAG, "Read line: %s, len: %zu", furi_string_get_cstr(line), furi_string_size(line));
+        FURI_LOG_T(TAG, "Read line: %.*s, len: %zu", (int)data_size, data, data_size);
 
-        bool is_comment = furi_string_get_char(line, 0) == '#';
+        bool is_comment = data_size > 0 && data[0] == '#';
+        bool is_correct_size = data_size >= instance->key_size_symbols - 1;
 
-        if(!is_comment) {
-            furi_string_left(line, instance->key_size_symbols - 1);
+        if(!is_comment && is_correct_size) {
+            furi_string_set_strn(line, data, instance->key_size_symbols - 1);
+            return true;
         }
+    }
+
+    return false;
+}
 
-        bool is_correct_size = furi_string_size(line) == instance->key_size_symbols - 1;
+static uint32_t keys_dict_stream_crc(Stream* stream, size_t size) {
+    uint8_t* buffer = malloc(KEYS_DICT_INDEX_BUFFER_SIZE);
+    uint32_t crc = 0;
 
-        return !is_comment && is_correct_size;
+    while(size > 0) {
+        size_t to_read = MIN(size, KEYS_DICT_INDEX_BUFFER_SIZE);
+        size_t was_read = stream_read(stream, buffer, to_read);
+        crc = crc32_calc_buffer(crc, buffer, was_read);
+        if(was_read != to_read) break;
+        size -= was_read;
     }
 
-    return false;
+    free(buffer);
+    return crc;
+}
+
+static inline size_t keys_dict_index_key_offset(
+    KeysDict* instance,
+    KeysDictIndexSection section,
+    size_t key_index) {
+    return sizeof(KeysDictIndexHeader) +
+           (section * instance->total_keys + key_index) * instance->key_size;
+}
+
+static void keys_dict_index_close(KeysDict* instance) {
+    if(instance->index_stream) {
+        buffered_file_stream_close(instance->index_stream);
+        stream_free(instance->index_stream);
+        instance->index_stream = NULL;
+    }
+}
+
+static void keys_dict_index_remove(KeysDict* instance) {
+    keys_dict_index_close(instance);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    if(storage_common_stat(storage, furi_string_get_cstr(instance->index_path), NULL) == FSE_OK) {
+        storage_simply_remove(storage, furi_string_get_cstr(instance->index_path));
+    }
+    furi_record_close(RECORD_STORAGE);
+}
+
+static bool keys_dict_index_open(KeysDict* instance, Storage* storage) {
+    instance->index_stream = buffered_file_stream_alloc(storage);
+
+    bool index_valid = false;
+
+    do {
+        if(!buffered_file_stream_open(
+               instance->index_stream,
+               furi_string_get_cstr(instance->index_path),
+               FSAM_READ,
+               FSOM_OPEN_EXISTING))
+            break;
+
+        KeysDictIndexHeader header;
+        if(stream_read(instance->index_stream, (uint8_t*)&header, sizeof(header)) !=
+           sizeof(header))
+            break;
+        if(header.magic != KEYS_DICT_INDEX_MAGIC || header.version != KEYS_DICT_INDEX_VERSION ||
+           header.key_size != instance->key_size)
+            break;
+
+        // Index is only valid for the exact text file it was built from
+        size_t source_size = stream_size(instance->stream);
+        if(header.source_size != source_size) break;
+        stream_rewind(instance->stream);
+        if(header.source_crc != keys_dict_stream_crc(instance->stream, source_size)) break;
+
+        size_t data_size = 2 * header.total_keys * instance->key_size;
+        if(stream_size(instance->index_stream) != sizeof(header) + data_size) break;
+        if(header.data_crc != keys_dict_stream_crc(instance->index_stream, data_size)) break;
+
+        instance->total_keys = header.total_keys;
+        index_valid = true;
+    } while(false);
+
+    if(index_valid) {
+        stream_seek(
+            instance->index_stream,
+            keys_dict_index_key_offset(instance, KeysDictIndexSectionOrdered, 0),
+            StreamOffsetFromStart);
+        instance->index_next_key = 0;
+    } else {
+        keys_dict_index_close(instance);
+    }
+
+    stream_rewind(instance->stream);
+
+    return index_valid;
+}
+
+static int keys_dict_index_compare(const void* a, const void* b) {
+    const uint64_t key_a = *(const uint64_t*)a;
+    const uint64_t key_b = *(const uint64_t*)b;
+    return (key_a > key_b) - (key_a < key_b);
+}
+
+static void keys_dict_index_write_keys(
+    KeysDict* instance,
+    Stream* stream,
+    const uint64_t* keys,
+    uint32_t* crc) {
+    uint8_t key[KEYS_DICT_INDEX_KEY_SIZE_MAX];
+
+    for(size_t i = 0; i < instance->total_keys; i++) {
+        uint64_t key_int = keys[i];
+        for(size_t j = instance->key_size; j > 0; j--) {
+            key[j - 1] = (uint8_t)key_int;
+            key_int >>= 8;
+        }
+        stream_write(stream, key, instance->key_size);
+        *crc = crc32_calc_buffer(*crc, key, instance->key_size);
+    }
+}
+
+static bool keys_dict_get_next_key_str(KeysDict* instance, FuriString* key);
+static void keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint64_t* key_int);
+
+static bool keys_dict_index_build(KeysDict* instance, Storage* storage) {
+    size_t keys_size = instance->total_keys * sizeof(uint64_t);
+    if(memmgr_heap_get_max_free_block() < keys_size + KEYS_DICT_INDEX_HEAP_RESERVE) {
+        FURI_LOG_W(TAG, "Not enough memory to build index");
+        return false;
+    }
+
+    uint64_t* keys = malloc(keys_size);
+    FuriString* key_str = furi_string_alloc();
+
+    stream_rewind(instance->stream);
+    size_t keys_read = 0;
+    while(keys_read < instance->total_keys && keys_dict_get_next_key_str(instance, key_str)) {
+        keys_dict_str_to_int(instance, key_str, &keys[keys_read++]);
+    }
+
+    KeysDictIndexHeader header = {
+        .magic = KEYS_DICT_INDEX_MAGIC,
+        .version = KEYS_DICT_INDEX_VERSION,
+        .key_size = instance->key_size,
+        .total_keys = instance->total_keys,
+        .source_size = stream_size(instance->stream),
+    };
+    stream_rewind(instance->stream);
+    header.source_crc = keys_dict_stream_crc(instance->stream, header.source_size);
+    stream_rewind(instance->stream);
+
+    Stream* index_stream = buffered_file_stream_alloc(storage);
+    bool index_built = false;
+
+    do {
+        if(keys_read != instance->total_keys) break;
+        if(!buffered_file_stream_open(
+               index_stream,
+               furi_string_get_cstr(instance->index_path),
+               FSAM_WRITE,
+               FSOM_CREATE_ALWAYS))
+            break;
+
+        // Header is rewritten once data checksum is known
+        if(stream_write(index_stream, (uint8_t*)&header, sizeof(header)) != sizeof(header))
+            break;
+        keys_dict_index_write_keys(instance, index_stream, keys, &header.data_crc);
+        qsort(keys, instance->total_keys, sizeof(uint64_t), keys_dict_index_compare);
+        keys_dict_index_write_keys(instance, index_stream, keys, &header.data_crc);
+
+        if(!stream_rewind(index_stream)) break;
+        if(stream_write(index_stream, (uint8_t*)&header, sizeof(header)) != sizeof(header))
+            break;
+
+        index_built = buffered_file_stream_sync(index_stream) &&
+                      (buffered_file_stream_get_error(index_stream) == FSE_OK);
+    } while(false);
+
+    buffered_file_stream_close(index_stream);
+    stream_free(index_stream);
+
+    furi_string_free(key_str);
+    free(keys);
+
+    if(index_built) {
+        FURI_LOG_I(TAG, "Built index with %zu keys", instance->total_keys);
+    } else {
+        FURI_LOG_W(TAG, "Failed to build index");
+        storage_simply_remove(storage, furi_string_get_cstr(instance->index_path));
+    }
+
+    return index_built;
+}
+
+static bool keys_dict_index_read_key(
+    KeysDict* instance,
+    KeysDictIndexSection section,
+    size_t key_index,
+    uint8_t* key) {
+    return stream_seek(
+               instance->index_stream,
+               keys_dict_index_key_offset(instance, section, key_index),
+               StreamOffsetFromStart) &&
+           (stream_read(instance->index_stream, key, instance->key_size) == instance->key_size);
+}
+
+static bool keys_dict_index_is_key_present(KeysDict* instance, const uint8_t* key) {
+    uint8_t key_dut[KEYS_DICT_INDEX_KEY_SIZE_MAX];
+    size_t left = 0;
+    size_t right = instance->total_keys;
+    bool key_found = false;
+
+    while(!key_found && left < right) {
+        size_t middle = left + (right - left) / 2;
+        if(!keys_dict_index_read_key(instance, KeysDictIndexSectionSorted, middle, key_dut)) {
+            break;
+        }
+
+        int result = memcmp(key_dut, key, instance->key_size);
+        if(result == 0) {
+            key_found = true;
+        } else if(result < 0) {
+            left = middle + 1;
+        } else {
+            right = middle;
+        }
+    }
+
+    // Restore the position of the ordered keys iterator
+    stream_seek(
+        instance->index_stream,
+        keys_dict_index_key_offset(
+            instance, KeysDictIndexSectionOrdered, instance->index_next_key),
+        StreamOffsetFromStart);
+
+    return key_found;
 }
 
 bool keys_dict_check_presence(const char* path) {
@@ -82,6 +349,10 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
 
     instance->total_keys = 0;
 
+    instance->index_path = furi_string_alloc_printf("%s%s", path, KEYS_DICT_INDEX_EXTENSION);
+    instance->index_stream = NULL;
+    instance->index_next_key = 0;
+
     bool file_exists =
         buffered_file_stream_open(instance->stream, path, FSAM_READ_WRITE, open_mode);
 
@@ -92,9 +363,12 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
         keys_dict_add_ending_new_line(instance);
     }
 
+    bool index_loaded = file_exists && key_size <= KEYS_DICT_INDEX_KEY_SIZE_MAX &&
+                        keys_dict_index_open(instance, storage);
+
     FuriString* line = furi_string_alloc();
 
-    bool is_endfile = false;
+    bool is_endfile = index_loaded;
 
     // In this loop we only count the entries in the file
     // We prefer not to load the whole file in memory for space reasons
@@ -105,7 +379,19 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
         }
     }
     stream_rewind(instance->stream);
-    FURI_LOG_I(TAG, "Loaded dictionary with %zu keys", instance->total_keys);
+
+    // Large dictionaries get a binary index, rebuilt whenever the text file changes
+    if(file_exists && !index_loaded && key_size <= KEYS_DICT_INDEX_KEY_SIZE_MAX &&
+       instance->total_keys >= KEYS_DICT_INDEX_KEYS_MIN) {
+        index_loaded = keys_dict_index_build(instance, storage) &&
+                       keys_dict_index_open(instance, storage);
+    }
+
+    FURI_LOG_I(
+        TAG,
+        "Loaded dictionary with %zu keys%s",
+        instance->total_keys,
+        index_loaded ? " from index" : "");
 
     furi_string_free(line);
 
@@ -116,6 +402,9 @@ void keys_dict_free(KeysDict* instance) {
     furi_check(instance);
     furi_check(instance->stream);
 
+    keys_dict_index_close(instance);
+    furi_string_free(instance->index_path);
+
     buffered_file_stream_close(instance->stream);
     stream_free(instance->stream);
     free(instance);
@@ -163,6 +452,14 @@ bool keys_dict_rewind(KeysDict* instance) {
     furi_check(instance);
     furi_check(instance->stream);
 
+    if(instance->index_stream) {
+        instance->index_next_key = 0;
+        return stream_seek(
+            instance->index_stream,
+            keys_dict_index_key_offset(instance, KeysDictIndexSectionOrdered, 0),
+            StreamOffsetFromStart);
+    }
+
     return stream_rewind(instance->stream);
 }
 
@@ -187,6 +484,13 @@ bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size) {
     furi_check(instance->key_size == key_size);
     furi_check(key);
 
+    if(instance->index_stream) {
+        bool key_read = instance->index_next_key < instance->total_keys &&
+                        stream_read(instance->index_stream, key, key_size) == key_size;
+        if(key_read) instance->index_next_key++;
+        return key_read;
+    }
+
     FuriString* temp_key = furi_string_alloc();
 
     bool key_read = keys_dict_get_next_key_str(instance, temp_key);
@@ -239,6 +543,10 @@ bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key
     furi_check(instance->key_size == key_size);
     furi_check(key);
 
+    if(instance->index_stream) {
+        return keys_dict_index_is_key_present(instance, key);
+    }
+
     FuriString* temp_key = furi_string_alloc();
 
     keys_dict_int_to_str(instance, key, temp_key);
@@ -276,6 +584,12 @@ bool keys_dict_add_key(KeysDict* instance, const uint8_t* key, size_t key_size)
     furi_check(instance->key_size == key_size);
     furi_check(key);
 
+    // Text file is about to change, it will be indexed again on next open
+    if(instance->index_stream) {
+        keys_dict_index_remove(instance);
+        stream_rewind(instance->stream);
+    }
+
     FuriString* temp_key = furi_string_alloc();
 
     keys_dict_int_to_str(instance, key, temp_key);
@@ -296,6 +610,11 @@ bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_siz
 
     bool key_removed = false;
 
+    // Text file is about to change, it will be indexed again on next open
+    if(instance->index_stream) {
+        keys_dict_index_remove(instance);
+    }
+
     uint8_t* temp_key = malloc(key_size);
 
     stream_rewind(instance->stream);
@@ -8,6 +8,14 @@
 extern "C" {
 #endif
 
+/** Extension appended to the list path to get its binary index path
+ *
+ * Lists with many keys get a binary index next to them: keys in file order
+ * plus a sorted copy for binary search. The text file stays the source of
+ * truth, index is rebuilt whenever the text file changes.
+ */
+#define KEYS_DICT_INDEX_EXTENSION ".idx"
+
 typedef enum {
     KeysDictModeOpenExisting,
     KeysDictModeOpenAlways,
@@ -11,6 +11,16 @@ typedef uint8_t* (*ProtocolGetData)(void* protocol);
 
 typedef void (*ProtocolDecoderStart)(void* protocol);
 typedef bool (*ProtocolDecoderFeed)(void* protocol, bool level, uint32_t duration);
+typedef bool (*ProtocolDecoderFeedBits)(void* protocol, bool value, uint32_t count);
+
+typedef void* (*ProtocolDemodAlloc)(void);
+typedef void (*ProtocolDemodFree)(void* demod);
+typedef void (*ProtocolDemodFeed)(
+    void* demod,
+    bool level,
+    uint32_t duration,
+    bool* value,
+    uint32_t* count);
 
 typedef bool (*ProtocolEncoderStart)(void* protocol);
 typedef LevelDuration (*ProtocolEncoderYield)(void* protocol);
@@ -18,9 +28,22 @@ typedef LevelDuration (*ProtocolEncoderYield)(void* protocol);
 typedef void (*ProtocolRenderData)(void* protocol, FuriString* result);
 typedef bool (*ProtocolWriteData)(void* protocol, void* data);
 
+/**
+ * Demodulator shared by decoders.
+ * Protocols with the same demod are fed with its bits by ProtocolDict,
+ * so an edge is demodulated once for all of them.
+ */
+typedef struct {
+    ProtocolDemodAlloc alloc;
+    ProtocolDemodFree free;
+    ProtocolDemodFeed feed;
+} ProtocolDemod;
+
 typedef struct {
     ProtocolDecoderStart start;
     ProtocolDecoderFeed feed;
+    const ProtocolDemod* demod; /**< Optional, feed_bits is used instead of feed in ProtocolDict */
+    ProtocolDecoderFeedBits feed_bits;
 } ProtocolDecoder;
 
 typedef struct {
@@ -1,12 +1,45 @@
 #include <furi.h>
 #include "protocol_dict.h"
 
+#define PROTOCOL_DICT_NO_DEMOD (-1)
+
+typedef struct {
+    const ProtocolDemod* base;
+    void* data;
+    uint32_t features;
+    bool value;
+    uint32_t count;
+} ProtocolDictDemod;
+
 struct ProtocolDict {
     const ProtocolBase** base;
     size_t count;
     void** data;
+    int8_t* demod_index;
+    ProtocolDictDemod* demods;
+    size_t demods_count;
 };
 
+static int8_t protocol_dict_add_demod(ProtocolDict* dict, const ProtocolBase* base) {
+    const ProtocolDemod* demod = base->decoder.demod;
+    if(!demod || !base->decoder.feed_bits) return PROTOCOL_DICT_NO_DEMOD;
+
+    size_t index = 0;
+    while((index < dict->demods_count) && (dict->demods[index].base != demod)) {
+        index++;
+    }
+
+    if(index == dict->demods_count) {
+        furi_check(index < INT8_MAX);
+        dict->demods[index].base = demod;
+        dict->demods[index].data = demod->alloc();
+        dict->demods_count++;
+    }
+
+    dict->demods[index].features |= base->features;
+    return index;
+}
+
 ProtocolDict* protocol_dict_alloc(const ProtocolBase** protocols, size_t count) {
     furi_check(protocols);
 
@@ -14,9 +47,13 @@ ProtocolDict* protocol_dict_alloc(const ProtocolBase** protocols, size_t count)
     dict->base = protocols;
     dict->count = count;
     dict->data = malloc(sizeof(void*) * dict->count);
+    dict->demod_index = malloc(sizeof(int8_t) * dict->count);
+    dict->demods = malloc(sizeof(ProtocolDictDemod) * dict->count);
+    dict->demods_count = 0;
 
     for(size_t i = 0; i < dict->count; i++) {
         dict->data[i] = dict->base[i]->alloc();
+        dict->demod_index[i] = protocol_dict_add_demod(dict, dict->base[i]);
     }
 
     return dict;
@@ -29,6 +66,12 @@ void protocol_dict_free(ProtocolDict* dict) {
         dict->base[i]->free(dict->data[i]);
     }
 
+    for(size_t i = 0; i < dict->demods_count; i++) {
+        dict->demods[i].base->free(dict->demods[i].data);
+    }
+
+    free(dict->demods);
+    free(dict->demod_index);
     free(dict->data);
     free(dict);
 }
@@ -106,55 +149,59 @@ uint32_t protocol_dict_get_features(ProtocolDict* dict, size_t protocol_index) {
     return dict->base[protocol_index]->features;
 }
 
-ProtocolId protocol_dict_decoders_feed(ProtocolDict* dict, bool level, uint32_t duration) {
-    furi_check(dict);
-
+static ProtocolId protocol_dict_decoders_feed_internal(
+    ProtocolDict* dict,
+    bool by_feature,
+    uint32_t feature,
+    bool level,
+    uint32_t duration) {
     bool done = false;
     ProtocolId ready_protocol_id = PROTOCOL_NO;
 
-    for(size_t i = 0; i < dict->count; i++) {
-        ProtocolDecoderFeed fn = dict->base[i]->decoder.feed;
+    // Demodulate once, bits go to every protocol of the demod below
+    for(size_t i = 0; i < dict->demods_count; i++) {
+        ProtocolDictDemod* demod = &dict->demods[i];
+        demod->count = 0;
+        if(!by_feature || (demod->features & feature)) {
+            demod->base->feed(demod->data, level, duration, &demod->value, &demod->count);
+        }
+    }
 
-        if(fn) {
-            if(fn(dict->data[i], level, duration)) {
-                if(!done) {
-                    ready_protocol_id = i;
-                    done = true;
-                }
+    for(size_t i = 0; i < dict->count; i++) {
+        const ProtocolBase* base = dict->base[i];
+        if(by_feature && (base->features & feature) == 0) continue;
+
+        bool ready = false;
+        if(dict->demod_index[i] != PROTOCOL_DICT_NO_DEMOD) {
+            const ProtocolDictDemod* demod = &dict->demods[dict->demod_index[i]];
+            if(demod->count) {
+                ready = base->decoder.feed_bits(dict->data[i], demod->value, demod->count);
             }
+        } else if(base->decoder.feed) {
+            ready = base->decoder.feed(dict->data[i], level, duration);
+        }
+
+        if(ready && !done) {
+            ready_protocol_id = i;
+            done = true;
         }
     }
 
     return ready_protocol_id;
 }
 
+ProtocolId protocol_dict_decoders_feed(ProtocolDict* dict, bool level, uint32_t duration) {
+    furi_check(dict);
+    return protocol_dict_decoders_feed_internal(dict, false, 0, level, duration);
+}
+
 ProtocolId protocol_dict_decoders_feed_by_feature(
     ProtocolDict* dict,
     uint32_t feature,
     bool level,
     uint32_t duration) {
     furi_check(dict);
-
-    bool done = false;
-    ProtocolId ready_protocol_id = PROTOCOL_NO;
-
-    for(size_t i = 0; i < dict->count; i++) {
-        uint32_t features = dict->base[i]->features;
-        if(features & feature) {
-            ProtocolDecoderFeed fn = dict->base[i]->decoder.feed;
-
-            if(fn) {
-                if(fn(dict->data[i], level, duration)) {
-                    if(!done) {
-                        ready_protocol_id = i;
-                        done = true;
-                    }
-                }
-            }
-        }
-    }
-
-    return ready_protocol_id;
+    return protocol_dict_decoders_feed_internal(dict, true, feature, level, duration);
 }
 
 ProtocolId protocol_dict_decoders_feed_by_id(
@@ -26,6 +26,11 @@ static bool buffered_file_stream_delete_and_insert(
     size_t delete_size,
     StreamWriteCB write_callback,
     const void* ctx);
+static size_t buffered_file_stream_peek(
+    BufferedFileStream* stream,
+    const uint8_t** data,
+    bool refill,
+    bool* at_end);
 
 static bool buffered_file_stream_flush(BufferedFileStream* stream);
 static bool buffered_file_stream_unread(BufferedFileStream* stream);
@@ -40,6 +45,7 @@ const StreamVTable buffered_file_stream_vtable = {
     .write = (StreamWriteFn)buffered_file_stream_write,
     .read = (StreamReadFn)buffered_file_stream_read,
     .delete_and_insert = (StreamDeleteAndInsertFn)buffered_file_stream_delete_and_insert,
+    .peek = (StreamPeekFn)buffered_file_stream_peek,
 };
 
 Stream* buffered_file_stream_alloc(Storage* storage) {
@@ -50,6 +56,7 @@ Stream* buffered_file_stream_alloc(Storage* storage) {
     stream->sync_pending = false;
 
     stream->stream_base.vtable = &buffered_file_stream_vtable;
+    stream->stream_base.line_buffer = NULL;
     return (Stream*)stream;
 }
 
@@ -222,6 +229,24 @@ static bool buffered_file_stream_delete_and_insert(
     return success;
 }
 
+static size_t buffered_file_stream_peek(
+    BufferedFileStream* stream,
+    const uint8_t** data,
+    bool refill,
+    bool* at_end) {
+    if(stream->sync_pending) {
+        if(!buffered_file_stream_flush(stream)) {
+            *at_end = true;
+            return 0;
+        }
+    }
+    if(refill || stream_cache_at_end(stream->cache)) {
+        stream_cache_refill(stream->cache, stream->file_stream);
+    }
+    *at_end = stream_eof(stream->file_stream);
+    return stream_cache_peek(stream->cache, data);
+}
+
 // Write the cache into the underlying stream and adjust seek position
 static bool buffered_file_stream_flush(BufferedFileStream* stream) {
     bool success = false;
@@ -32,6 +32,7 @@ const StreamVTable file_stream_vtable = {
     .write = (StreamWriteFn)file_stream_write,
     .read = (StreamReadFn)file_stream_read,
     .delete_and_insert = (StreamDeleteAndInsertFn)file_stream_delete_and_insert,
+    .peek = NULL,
 };
 
 Stream* file_stream_alloc(Storage* storage) {
@@ -42,6 +43,7 @@ Stream* file_stream_alloc(Storage* storage) {
     stream->storage = storage;
 
     stream->stream_base.vtable = &file_stream_vtable;
+    stream->stream_base.line_buffer = NULL;
     return (Stream*)stream;
 }
 
@@ -8,6 +8,9 @@
 
 void stream_free(Stream* stream) {
     furi_check(stream);
+    if(stream->line_buffer) {
+        furi_string_free(stream->line_buffer);
+    }
     stream->vtable->free(stream);
 }
 
@@ -147,10 +150,53 @@ static bool stream_write_struct(Stream* stream, const void* context) {
     return (stream_write(stream, write_data->data, write_data->size) == write_data->size);
 }
 
-bool stream_read_line(Stream* stream, FuriString* str_result) {
-    furi_check(stream);
-    furi_check(str_result);
+typedef enum {
+    StreamLinePeekFound,
+    StreamLinePeekEnd,
+    StreamLinePeekTooLong,
+} StreamLinePeekResult;
+
+// Find line in the stream own buffer and move past it, or onto its '\n', without copying
+static StreamLinePeekResult stream_read_line_peek(
+    Stream* stream,
+    const char** line,
+    size_t* line_size,
+    bool* has_eol,
+    bool consume_eol) {
+    const uint8_t* data = NULL;
+    bool at_end = false;
+    size_t size = stream->vtable->peek(stream, &data, false, &at_end);
+    size_t searched = 0;
+
+    while(true) {
+        const uint8_t* eol = (size > searched) ? memchr(data + searched, '\n', size - searched) :
+                                                 NULL;
+        if(eol || at_end) {
+            size_t length = eol ? (size_t)(eol - data) : size;
+            if(!eol && (length == 0)) return StreamLinePeekEnd;
+
+            if(!stream_seek(
+                   stream, length + ((eol && consume_eol) ? 1 : 0), StreamOffsetFromCurrent)) {
+                return StreamLinePeekEnd;
+            }
+
+            *line = (const char*)data;
+            *line_size = length;
+            *has_eol = (eol != NULL);
+            return StreamLinePeekFound;
+        }
 
+        searched = size;
+        size = stream->vtable->peek(stream, &data, true, &at_end);
+        if((size == searched) && !at_end) return StreamLinePeekTooLong;
+    }
+}
+
+static bool stream_read_line_copy(
+    Stream* stream,
+    FuriString* str_result,
+    bool consume_eol,
+    bool strip_cr) {
     furi_string_reset(str_result);
     uint8_t buffer[STREAM_BUFFER_SIZE];
 
@@ -162,14 +208,15 @@ bool stream_read_line(Stream* stream, FuriString* str_result) {
         bool error = false;
         for(uint16_t i = 0; i < bytes_were_read; i++) {
             if(buffer[i] == '\n') {
-                if(!stream_seek(stream, i - bytes_were_read + 1, StreamOffsetFromCurrent)) {
+                int32_t offset = i - bytes_were_read + (consume_eol ? 1 : 0);
+                if(!stream_seek(stream, offset, StreamOffsetFromCurrent)) {
                     error = true;
                     break;
                 }
                 furi_string_push_back(str_result, buffer[i]);
                 result = true;
                 break;
-            } else if(buffer[i] == '\r') {
+            } else if(buffer[i] == '\r' && strip_cr) {
                 // Ignore
             } else {
                 furi_string_push_back(str_result, buffer[i]);
@@ -184,6 +231,88 @@ bool stream_read_line(Stream* stream, FuriString* str_result) {
     return furi_string_size(str_result) != 0;
 }
 
+bool stream_read_line(Stream* stream, FuriString* str_result) {
+    furi_check(stream);
+    furi_check(str_result);
+
+    if(stream->vtable->peek) {
+        const char* line = NULL;
+        size_t line_size = 0;
+        bool has_eol = false;
+
+        StreamLinePeekResult result =
+            stream_read_line_peek(stream, &line, &line_size, &has_eol, true);
+        if(result == StreamLinePeekEnd) {
+            furi_string_reset(str_result);
+            return false;
+        } else if(result == StreamLinePeekFound) {
+            if(memchr(line, '\r', line_size)) {
+                furi_string_reset(str_result);
+                for(size_t i = 0; i < line_size; i++) {
+                    if(line[i] != '\r') furi_string_push_back(str_result, line[i]);
+                }
+            } else {
+                furi_string_set_strn(str_result, line, line_size);
+            }
+            if(has_eol) furi_string_push_back(str_result, '\n');
+            return furi_string_size(str_result) != 0;
+        }
+    }
+
+    return stream_read_line_copy(stream, str_result, true, true);
+}
+
+static bool stream_read_line_view_internal(
+    Stream* stream,
+    const char** line,
+    size_t* line_size,
+    bool consume_eol) {
+    furi_check(stream);
+    furi_check(line);
+    furi_check(line_size);
+
+    bool has_eol = false;
+
+    if(stream->vtable->peek) {
+        StreamLinePeekResult result =
+            stream_read_line_peek(stream, line, line_size, &has_eol, consume_eol);
+        if(result == StreamLinePeekEnd) {
+            return false;
+        } else if(result == StreamLinePeekFound) {
+            if(has_eol && (*line_size > 0) && ((*line)[*line_size - 1] == '\r')) {
+                (*line_size)--;
+            }
+            return true;
+        }
+    }
+
+    // No own buffer or the line doesn't fit into it
+    if(!stream->line_buffer) {
+        stream->line_buffer = furi_string_alloc();
+    }
+    // Keep '\r' inside the line, same as the peek path above
+    if(!stream_read_line_copy(stream, stream->line_buffer, consume_eol, false)) return false;
+
+    *line = furi_string_get_cstr(stream->line_buffer);
+    *line_size = furi_string_size(stream->line_buffer);
+    if((*line_size > 0) && ((*line)[*line_size - 1] == '\n')) {
+        (*line_size)--;
+        if((*line_size > 0) && ((*line)[*line_size - 1] == '\r')) {
+            (*line_size)--;
+        }
+    }
+
+    return true;
+}
+
+bool stream_read_line_view(Stream* stream, const char** line, size_t* line_size) {
+    return stream_read_line_view_internal(stream, line, line_size, true);
+}
+
+bool stream_read_line_view_keep_eol(Stream* stream, const char** line, size_t* line_size) {
+    return stream_read_line_view_internal(stream, line, line_size, false);
+}
+
 bool stream_rewind(Stream* stream) {
     furi_check(stream);
     return stream_seek(stream, 0, StreamOffsetFromStart);
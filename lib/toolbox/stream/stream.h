@@ -121,6 +121,30 @@ bool stream_delete_and_insert(
  */
 bool stream_read_line(Stream* stream, FuriString* str_result);
 
+/**
+ * Read line from a stream without copying it (supports LF and CRLF line endings)
+ * Line points to the stream internal buffer and is valid until the next stream operation.
+ * Lines from streams without own buffer, or longer than it, are copied to a stream owned buffer.
+ * @param stream Stream instance
+ * @param line pointer to store line start, line is not null-terminated
+ * @param line_size pointer to store line length, line ending is not included
+ * @return true if line was read, including empty one
+ * @return false if stream is at the end
+ */
+bool stream_read_line_view(Stream* stream, const char** line, size_t* line_size);
+
+/**
+ * Read line from a stream without copying it, same as stream_read_line_view,
+ * but the stream is left at the '\n' of the line instead of after it.
+ * Repeated calls return empty lines until the '\n' is skipped.
+ * @param stream Stream instance
+ * @param line pointer to store line start, line is not null-terminated
+ * @param line_size pointer to store line length, line ending is not included
+ * @return true if line was read, including empty one
+ * @return false if stream is at the end
+ */
+bool stream_read_line_view_keep_eol(Stream* stream, const char** line, size_t* line_size);
+
 /**
  * Moves the RW pointer to the start
  * @param stream Stream instance
@@ -77,6 +77,25 @@ size_t stream_cache_write(StreamCache* cache, const uint8_t* data, size_t size)
     return size_written;
 }
 
+size_t stream_cache_peek(StreamCache* cache, const uint8_t** data) {
+    furi_assert(cache->data_size >= cache->position);
+    *data = cache->data + cache->position;
+    return cache->data_size - cache->position;
+}
+
+size_t stream_cache_refill(StreamCache* cache, Stream* stream) {
+    furi_assert(cache->data_size >= cache->position);
+    const size_t size_left = cache->data_size - cache->position;
+    if(cache->position > 0) {
+        memmove(cache->data, cache->data + cache->position, size_left);
+    }
+    const size_t size_read =
+        stream_read(stream, cache->data + size_left, STREAM_CACHE_MAX_SIZE - size_left);
+    cache->data_size = size_left + size_read;
+    cache->position = 0;
+    return size_read;
+}
+
 int32_t stream_cache_seek(StreamCache* cache, int32_t offset) {
     furi_assert(cache->data_size >= cache->position);
     int32_t actual_offset = 0;
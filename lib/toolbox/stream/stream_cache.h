@@ -89,6 +89,23 @@ size_t stream_cache_write(StreamCache* cache, const uint8_t* data, size_t size);
  */
 int32_t stream_cache_seek(StreamCache* cache, int32_t offset);
 
+/**
+ * Get cached data from the internal cursor without advancing it.
+ * @param cache Pointer to a StreamCache instance.
+ * @param data Pointer to store cached data pointer.
+ * @return Size of cached data after the cursor.
+ */
+size_t stream_cache_peek(StreamCache* cache, const uint8_t** data);
+
+/**
+ * Move data after the internal cursor to the beginning of the cache
+ * and load the rest of the cache with new data from a stream.
+ * @param cache Pointer to a StreamCache instance
+ * @param stream Pointer to a Stream instance
+ * @return Size of newly cached data.
+ */
+size_t stream_cache_refill(StreamCache* cache, Stream* stream);
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,6 +24,14 @@ typedef bool (*StreamDeleteAndInsertFn)(
     size_t delete_size,
     StreamWriteCB write_cb,
     const void* ctx);
+/**
+ * Get contiguous data from the current position without moving it.
+ * Optional, streams without own buffer leave it NULL.
+ * @param refill try to make more data available, data pointer may change
+ * @param at_end set to true if the data goes up to the end of the stream
+ * @return size of available data
+ */
+typedef size_t (*StreamPeekFn)(Stream* stream, const uint8_t** data, bool refill, bool* at_end);
 
 struct StreamVTable {
     const StreamFreeFn free;
@@ -35,10 +43,12 @@ struct StreamVTable {
     const StreamWriteFn write;
     const StreamReadFn read;
     const StreamDeleteAndInsertFn delete_and_insert;
+    const StreamPeekFn peek;
 };
 
 struct Stream {
     const StreamVTable* vtable;
+    FuriString* line_buffer; // Used by stream_read_line_view if peek is not possible
 };
 
 #ifdef __cplusplus
@@ -24,6 +24,11 @@ static bool string_stream_delete_and_insert(
     size_t delete_size,
     StreamWriteCB write_callback,
     const void* ctx);
+static size_t string_stream_peek(
+    StringStream* stream,
+    const uint8_t** data,
+    bool refill,
+    bool* at_end);
 
 const StreamVTable string_stream_vtable = {
     .free = (StreamFreeFn)string_stream_free,
@@ -35,6 +40,7 @@ const StreamVTable string_stream_vtable = {
     .write = (StreamWriteFn)string_stream_write,
     .read = (StreamReadFn)string_stream_read,
     .delete_and_insert = (StreamDeleteAndInsertFn)string_stream_delete_and_insert,
+    .peek = (StreamPeekFn)string_stream_peek,
 };
 
 Stream* string_stream_alloc(void) {
@@ -42,6 +48,7 @@ Stream* string_stream_alloc(void) {
     stream->string = furi_string_alloc();
     stream->index = 0;
     stream->stream_base.vtable = &string_stream_vtable;
+    stream->stream_base.line_buffer = NULL;
     return (Stream*)stream;
 }
 
@@ -177,3 +184,15 @@ static size_t string_stream_write_char(StringStream* stream, char c) {
 
     return 1;
 }
+
+static size_t string_stream_peek(
+    StringStream* stream,
+    const uint8_t** data,
+    bool refill,
+    bool* at_end) {
+    UNUSED(refill);
+    // Whole string is always available
+    *data = (const uint8_t*)furi_string_get_cstr(stream->string) + stream->index;
+    *at_end = true;
+    return string_stream_size(stream) - stream->index;
+}
@@ -7,15 +7,38 @@
 #include <furi_hal_memory.h>
 
 #define SECTOR_SIZE 512
-#define N_SECTORS 8
+
+/*
+ * Two queue cache:
+ * - probation, FIFO of sectors requested once, single reads and read ahead land here
+ * - protected, LRU of sectors requested again, this is where FAT and directory sectors go
+ * File data is usually read once, so it can only wash out the probation part.
+ * Probation slots go first, read ahead needs them in a row.
+ */
+#define N_PROBATION_SECTORS 6
+#define N_PROTECTED_SECTORS 6
+#define N_SECTORS (N_PROBATION_SECTORS + N_PROTECTED_SECTORS)
+
+_Static_assert(
+    SECTOR_CACHE_READ_AHEAD_MAX <= N_PROBATION_SECTORS,
+    "Read ahead must fit into probation");
 
 typedef struct {
     uint32_t itr;
+    uint32_t tick;
+    uint32_t last_sector;
+    uint32_t sequential;
+    uint32_t read_ahead_slot;
+    uint32_t read_ahead_sector;
+    uint32_t read_ahead_count;
     uint32_t sectors[N_SECTORS];
+    uint32_t last_used[N_SECTORS];
+    bool requested[N_PROBATION_SECTORS];
     uint8_t sector_data[N_SECTORS][SECTOR_SIZE];
 } SectorCache;
 
 static SectorCache* cache = NULL;
+static SectorCacheStats cache_stats = {0};
 
 void sector_cache_init(void) {
     if(cache == NULL) {
@@ -27,22 +50,114 @@ void sector_cache_init(void) {
     }
 }
 
-uint8_t* sector_cache_get(uint32_t n_sector) {
-    if(cache != NULL && n_sector != 0) {
-        for(int sector_i = 0; sector_i < N_SECTORS; ++sector_i) {
-            if(cache->sectors[sector_i] == n_sector) {
-                return cache->sector_data[sector_i];
-            }
+static int sector_cache_find(uint32_t n_sector) {
+    // Protected first, probation may hold an older copy of a promoted sector
+    for(int sector_i = N_SECTORS - 1; sector_i >= 0; --sector_i) {
+        if(cache->sectors[sector_i] == n_sector) {
+            return sector_i;
         }
     }
-    return NULL;
+    return -1;
+}
+
+static int sector_cache_promote(int probation_i) {
+    int protected_i = N_PROBATION_SECTORS;
+    for(int sector_i = N_PROBATION_SECTORS; sector_i < N_SECTORS; ++sector_i) {
+        if(cache->sectors[sector_i] == 0) {
+            protected_i = sector_i;
+            break;
+        }
+        if(cache->last_used[sector_i] < cache->last_used[protected_i]) {
+            protected_i = sector_i;
+        }
+    }
+
+    cache->sectors[protected_i] = cache->sectors[probation_i];
+    cache->last_used[protected_i] = ++cache->tick;
+    memcpy(cache->sector_data[protected_i], cache->sector_data[probation_i], SECTOR_SIZE);
+    cache->sectors[probation_i] = 0;
+
+    return protected_i;
+}
+
+static uint32_t sector_cache_probation_take(uint32_t count) {
+    if(cache->itr + count > N_PROBATION_SECTORS) {
+        cache->itr = 0;
+    }
+
+    uint32_t probation_i = cache->itr;
+    cache->itr += count;
+
+    for(uint32_t i = 0; i < count; ++i) {
+        cache->sectors[probation_i + i] = 0;
+    }
+
+    return probation_i;
+}
+
+uint8_t* sector_cache_get(uint32_t n_sector) {
+    if(cache == NULL || n_sector == 0) return NULL;
+
+    cache->sequential = (n_sector == cache->last_sector + 1) ? cache->sequential + 1 : 0;
+    cache->last_sector = n_sector;
+
+    int sector_i = sector_cache_find(n_sector);
+    if(sector_i < 0) {
+        cache_stats.misses++;
+        return NULL;
+    }
+
+    cache_stats.hits++;
+    if(sector_i >= N_PROBATION_SECTORS) {
+        cache->last_used[sector_i] = ++cache->tick;
+    } else if(!cache->requested[sector_i]) {
+        // Read ahead sector, this is the first request
+        cache->requested[sector_i] = true;
+        cache_stats.read_ahead_hits++;
+    } else {
+        sector_i = sector_cache_promote(sector_i);
+    }
+
+    return cache->sector_data[sector_i];
 }
 
 void sector_cache_put(uint32_t n_sector, uint8_t* data) {
-    if(cache == NULL) return;
-    cache->sectors[cache->itr % N_SECTORS] = n_sector;
-    memcpy(cache->sector_data[cache->itr % N_SECTORS], data, SECTOR_SIZE);
-    cache->itr++;
+    if(cache == NULL || n_sector == 0) return;
+
+    uint32_t probation_i = sector_cache_probation_take(1);
+    cache->sectors[probation_i] = n_sector;
+    cache->requested[probation_i] = true;
+    memcpy(cache->sector_data[probation_i], data, SECTOR_SIZE);
+}
+
+uint8_t* sector_cache_read_ahead_begin(uint32_t n_sector, uint32_t* count) {
+    furi_check(count);
+
+    // Only right after a miss in a run of sequential requests
+    if(cache == NULL || n_sector == 0 || cache->read_ahead_count) return NULL;
+    if(cache->sequential == 0 || cache->last_sector != n_sector) return NULL;
+    if(n_sector > UINT32_MAX - SECTOR_CACHE_READ_AHEAD_MAX) return NULL;
+
+    cache->read_ahead_count = SECTOR_CACHE_READ_AHEAD_MAX;
+    cache->read_ahead_sector = n_sector;
+    cache->read_ahead_slot = sector_cache_probation_take(cache->read_ahead_count);
+
+    *count = cache->read_ahead_count;
+    return cache->sector_data[cache->read_ahead_slot];
+}
+
+void sector_cache_read_ahead_end(bool success) {
+    if(cache == NULL || cache->read_ahead_count == 0) return;
+
+    if(success) {
+        for(uint32_t i = 0; i < cache->read_ahead_count; ++i) {
+            cache->sectors[cache->read_ahead_slot + i] = cache->read_ahead_sector + i;
+            cache->requested[cache->read_ahead_slot + i] = (i == 0);
+        }
+        cache_stats.read_ahead += cache->read_ahead_count - 1;
+    }
+
+    cache->read_ahead_count = 0;
 }
 
 void sector_cache_invalidate_range(uint32_t start_sector, uint32_t end_sector) {
@@ -53,4 +168,9 @@ void sector_cache_invalidate_range(uint32_t start_sector, uint32_t end_sector) {
             cache->sectors[sector_i] = 0;
         }
     }
-}
\ No newline at end of file
+}
+
+void sector_cache_get_stats(SectorCacheStats* stats) {
+    furi_check(stats);
+    *stats = cache_stats;
+}
@@ -1,10 +1,21 @@
 #pragma once
 #include <stdint.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Sectors read at once when sequential access is detected */
+#define SECTOR_CACHE_READ_AHEAD_MAX (4U)
+
+typedef struct {
+    uint32_t hits; /**< Sectors found in cache */
+    uint32_t misses; /**< Sectors read from card */
+    uint32_t read_ahead; /**< Sectors read ahead of request */
+    uint32_t read_ahead_hits; /**< Sectors read ahead and then requested */
+} SectorCacheStats;
+
 /**
  * @brief Init sector cache system
  */
@@ -24,6 +35,22 @@ uint8_t* sector_cache_get(uint32_t n_sector);
  */
 void sector_cache_put(uint32_t n_sector, uint8_t* data);
 
+/**
+ * @brief Start read ahead after a cache miss
+ * Read ahead is only started for sequential access, sector_cache_read_ahead_end
+ * must be called after the sectors are read into the returned buffer.
+ * @param n_sector Missed sector number, the first one to read
+ * @param count Number of sectors to read
+ * @return Pointer to a buffer for count sectors or NULL if read ahead is not needed
+ */
+uint8_t* sector_cache_read_ahead_begin(uint32_t n_sector, uint32_t* count);
+
+/**
+ * @brief Finish read ahead
+ * @param success true if all sectors were read, buffer is dropped otherwise
+ */
+void sector_cache_read_ahead_end(bool success);
+
 /**
  * @brief Invalidate sector cache for given range
  * @param start_sector Start sector number
@@ -31,6 +58,12 @@ void sector_cache_put(uint32_t n_sector, uint8_t* data);
  */
 void sector_cache_invalidate_range(uint32_t start_sector, uint32_t end_sector);
 
+/**
+ * @brief Get cache counters, they are kept over cache init
+ * @param stats Pointer to SectorCacheStats to fill
+ */
+void sector_cache_get_stats(SectorCacheStats* stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -863,6 +863,23 @@ static FuriStatus sd_device_read(uint32_t* buff, uint32_t sector, uint32_t count
     return status;
 }
 
+static bool sd_cache_read_ahead(uint32_t address, uint32_t* data) {
+    uint32_t count = 0;
+    uint8_t* read_ahead_data = sector_cache_read_ahead_begin(address, &count);
+    if(!read_ahead_data) {
+        return false;
+    }
+
+    // Failure is not fatal, the usual read with retries follows
+    bool success = sd_device_read((uint32_t*)read_ahead_data, address, count) == FuriStatusOk;
+    sector_cache_read_ahead_end(success);
+    if(success) {
+        memcpy(data, read_ahead_data, SD_BLOCK_SIZE);
+    }
+
+    return success;
+}
+
 static FuriStatus sd_device_write(const uint32_t* buff, uint32_t sector, uint32_t count) {
     FuriStatus status = FuriStatusError;
 
@@ -981,6 +998,10 @@ FuriStatus furi_hal_sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t cou
         if(sd_cache_get(sector, buff)) {
             return FuriStatusOk;
         }
+
+        if(sd_cache_read_ahead(sector, buff)) {
+            return FuriStatusOk;
+        }
     }
 
     status = sd_device_read(buff, sector, count);
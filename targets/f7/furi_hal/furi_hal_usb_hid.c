@@ -11,6 +11,7 @@
 #define HID_EP_SZ 0x10
 
 #define HID_INTERVAL 2
+#define HID_KB_QUEUE_SIZE 16
 
 #define HID_VID_DEFAULT 0x046D
 #define HID_PID_DEFAULT 0xC529
@@ -257,6 +258,11 @@ static void* cb_ctx;
 static uint8_t led_state;
 static bool boot_protocol = false;
 
+/* Typed keyboard reports, sent from the endpoint callback while it is not empty */
+static struct HidReportKB hid_kb_queue[HID_KB_QUEUE_SIZE];
+static volatile uint8_t hid_kb_queue_head = 0;
+static volatile uint8_t hid_kb_queue_tail = 0;
+
 bool furi_hal_hid_is_connected(void) {
     return hid_connected;
 }
@@ -308,6 +314,82 @@ bool furi_hal_hid_kb_release_all(void) {
     return hid_send_report(ReportIdKeyboard);
 }
 
+/* Endpoint must be taken, either by semaphore or by the last transfer */
+static void hid_kb_queue_send(void) {
+    struct HidReportKB* report = &hid_kb_queue[hid_kb_queue_tail];
+    hid_kb_queue_tail = (hid_kb_queue_tail + 1) % HID_KB_QUEUE_SIZE;
+    if(boot_protocol == true) {
+        usbd_ep_write(usb_dev, HID_EP_IN, &report->boot, sizeof(report->boot));
+    } else {
+        usbd_ep_write(usb_dev, HID_EP_IN, report, sizeof(*report));
+    }
+}
+
+static bool hid_kb_queue_push(const struct HidReportKB* report) {
+    uint8_t head_next = (hid_kb_queue_head + 1) % HID_KB_QUEUE_SIZE;
+
+    uint32_t start = furi_get_tick();
+    while(head_next == hid_kb_queue_tail) {
+        if((hid_connected == false) || (furi_get_tick() - start > HID_INTERVAL * 2)) {
+            return false;
+        }
+        furi_delay_tick(1);
+    }
+
+    hid_kb_queue[hid_kb_queue_head] = *report;
+    hid_kb_queue_head = head_next;
+
+    /* Endpoint is idle, otherwise the queue is picked up on the end of transfer */
+    if(furi_semaphore_acquire(hid_semaphore, 0) == FuriStatusOk) {
+        if(hid_kb_queue_tail != hid_kb_queue_head) {
+            hid_kb_queue_send();
+        } else {
+            furi_semaphore_release(hid_semaphore);
+        }
+    }
+    return true;
+}
+
+bool furi_hal_hid_kb_type(const uint16_t* buttons, size_t count) {
+    furi_check(buttons);
+    if((hid_semaphore == NULL) || (hid_connected == false)) return false;
+
+    const struct HidReportKB* held = &hid_report.keyboard;
+    struct HidReportKB report = *held;
+    uint8_t key_nb = HID_KB_MAX_KEYS; // Slot of the typed key
+    bool state = true;
+
+    for(size_t i = 0; (i < count) && state; i++) {
+        uint8_t key = buttons[i] & 0xFF;
+        uint8_t mods = held->boot.mods | (buttons[i] >> 8);
+
+        /* Next key replaces the previous one in the same report,
+         * the same key or other modifiers need a release report first */
+        if((key_nb < HID_KB_MAX_KEYS) &&
+           ((report.boot.btn[key_nb] == key) || (report.boot.mods != mods))) {
+            report = *held;
+            key_nb = HID_KB_MAX_KEYS;
+            state = hid_kb_queue_push(&report);
+        }
+
+        if(key_nb == HID_KB_MAX_KEYS) {
+            for(key_nb = 0; key_nb < HID_KB_MAX_KEYS; key_nb++) {
+                if(report.boot.btn[key_nb] == 0) break;
+            }
+            if(key_nb == HID_KB_MAX_KEYS) return false;
+        }
+
+        report.boot.btn[key_nb] = key;
+        report.boot.mods = mods;
+        if(state) state = hid_kb_queue_push(&report);
+    }
+
+    if(state && (key_nb < HID_KB_MAX_KEYS)) {
+        state = hid_kb_queue_push(held);
+    }
+    return state;
+}
+
 bool furi_hal_hid_mouse_move(int8_t dx, int8_t dy) {
     hid_report.mouse.x = dx;
     hid_report.mouse.y = dy;
@@ -374,6 +456,9 @@ static void hid_init(usbd_device* dev, FuriHalUsbInterface* intf, void* ctx) {
     hid_report.keyboard.report_id = ReportIdKeyboard;
     hid_report.mouse.report_id = ReportIdMouse;
     hid_report.consumer.report_id = ReportIdConsumer;
+    /* Reports typed before the interface change are dropped */
+    hid_kb_queue_head = 0;
+    hid_kb_queue_tail = 0;
 
     usb_hid.dev_descr->iManufacturer = 0;
     usb_hid.dev_descr->iProduct = 0;
@@ -406,6 +491,7 @@ static void hid_init(usbd_device* dev, FuriHalUsbInterface* intf, void* ctx) {
 static void hid_deinit(usbd_device* dev) {
     usbd_reg_config(dev, NULL);
     usbd_reg_control(dev, NULL);
+    hid_kb_queue_tail = hid_kb_queue_head;
 
     free(usb_hid.str_manuf_descr);
     free(usb_hid.str_prod_descr);
@@ -425,6 +511,7 @@ static void hid_on_suspend(usbd_device* dev) {
     UNUSED(dev);
     if(hid_connected) {
         hid_connected = false;
+        hid_kb_queue_tail = hid_kb_queue_head;
         furi_semaphore_release(hid_semaphore);
         if(callback != NULL) {
             callback(false, cb_ctx);
@@ -436,7 +523,9 @@ static bool hid_send_report(uint8_t report_id) {
     if((hid_semaphore == NULL) || (hid_connected == false)) return false;
     if((boot_protocol == true) && (report_id != ReportIdKeyboard)) return false;
 
-    FuriStatus status = furi_semaphore_acquire(hid_semaphore, HID_INTERVAL * 2);
+    /* Typed reports are sent first */
+    FuriStatus status =
+        furi_semaphore_acquire(hid_semaphore, HID_INTERVAL * (HID_KB_QUEUE_SIZE + 2));
     if(status == FuriStatusErrorTimeout) {
         return false;
     }
@@ -461,7 +550,11 @@ static bool hid_send_report(uint8_t report_id) {
 static void hid_txrx_ep_callback(usbd_device* dev, uint8_t event, uint8_t ep) {
     UNUSED(dev);
     if(event == usbd_evt_eptx) {
-        furi_semaphore_release(hid_semaphore);
+        if(hid_kb_queue_tail != hid_kb_queue_head) {
+            hid_kb_queue_send();
+        } else {
+            furi_semaphore_release(hid_semaphore);
+        }
     } else if(boot_protocol == true) {
         usbd_ep_read(usb_dev, ep, &led_state, sizeof(led_state));
     } else {
@@ -222,6 +222,21 @@ bool furi_hal_hid_kb_release(uint16_t button);
  */
 bool furi_hal_hid_kb_release_all(void);
 
+/** Type keys one after another
+ *
+ * The next key is pressed in the same report that releases the previous one.
+ * A separate release report goes first if the key is the same as the previous
+ * one or the modifiers differ. Reports are queued and sent
+ * one per polling interval, keys pressed with furi_hal_hid_kb_press stay
+ * pressed.
+ *
+ * @param      buttons  key codes
+ * @param      count    number of key codes
+ *
+ * @return     true if all reports were queued
+ */
+bool furi_hal_hid_kb_type(const uint16_t* buttons, size_t count);
+
 /** Set mouse movement and send HID report
  *
  * @param      dx  x coordinate delta